@@ -10,16 +10,21 @@
 #ifndef APPLICATION_H
 #define APPLICATION_H
 
+#include <cmath>
 #include <iostream>
 #include <SDL2/SDL.h>
 
+#include "Benchmark.h"
 #include "Game/KeyHandler.h"
+#include "Game/KeyRecorder.h"
 #include "Game/Player/Action.h"
 #include "Game/Game.h"
 #include "Helpers.h"
 #include "Options.h"
+#include "Profiler.h"
 //#include "SavedGame.h"
 #include "Sound.h"
+#include "TextureRegistry.h"
 #include "SoundHandler.h"
 #include "Sprite.h"
 #include "Text.h"
@@ -58,9 +63,15 @@ private:
   int app_map;
   std::string app_path;
 
+  /* Headless frame time benchmark. Only set for benchmark runs */
+  Benchmark* benchmark;
+
   /* Handler for state of the keyboard */
   KeyHandler key_handler;
 
+  /* Input recording or replay. Only set for record and replay runs */
+  KeyRecorder* key_recorder;
+
   /* The running game */
   Game* game_handler;
 
@@ -96,9 +107,13 @@ private:
   SDL_Window* window;
 
   /*------------------- Constants -----------------------*/
+  const static uint8_t kFRAME_TICKS_MAX;  /* Max update ticks per frame */
+  const static uint16_t kFRAME_TIME_MAX; /* Max ms of frame time accumulated */
+  const static uint8_t kLIMIT_SPIN;      /* ms the frame limiter spins for */
   const static std::string kLOADING_SCREEN;  /* The loading fixed screen before title */
   const static std::string kLOGO_ICON; /* The logo icon path */
   const static std::string kPATH;      /* The main application path */
+  const static std::string kTEXTURE_DUMP; /* The texture registry dump path */
   const static bool kPATH_ENCRYPTED;   /* The main path - is it encrypted */
   const static int kPATH_MAP;          /* The default map index */
   const static uint8_t kUPDATE_CHANGE_LIMIT; /* The # of different frame times
@@ -113,9 +128,15 @@ private:
   /* Display loading frame */
   void displayLoadingFrame();
 
+  /* Returns the benchmark scene name of the running view. Empty if none */
+  std::string getBenchmarkScene();
+
   /* Goes through all available events that are currently on the stack */
   void handleEvents();
 
+  /* Limits the frame rate to the configured limit, if VSync is not enabled */
+  void limitFrame(uint64_t frame_start);
+
   /* Load */
   bool load();
 
@@ -157,6 +178,12 @@ public:
   /* Runs the application */
   bool run(bool skip_title = false);
 
+  /* Sets the benchmark to record frames into. Runs headless until complete */
+  void setBenchmark(Benchmark* benchmark);
+
+  /* Sets the key recorder to record input into or replay input from */
+  void setKeyRecorder(KeyRecorder* key_recorder);
+
   /* Sets the application path s*/
   void setPath(std::string path, int level = 0, bool skip_title = false);
 
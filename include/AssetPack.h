@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Class Name: AssetPack
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Single file archive of the image and audio resources. The
+ *              packer walks the resource directory and stores every image and
+ *              audio file in one file, followed by a table of contents of
+ *              their relative paths. At runtime the pack is mapped once and
+ *              each lookup is handed to SDL_image and SDL_mixer as an
+ *              SDL_RWops over the mapped bytes, in place of opening the loose
+ *              file. Paths not in the pack fall back to the loose file.
+ *
+ * Format (little endian)
+ * ----------------------
+ * Header:  "FISA" | u32 version | u32 entry count | u64 table of contents
+ *          offset
+ * Data:    the raw bytes of each file, in table of contents order
+ * TOC:     per entry: str16 relative path | u64 offset | u32 length
+ *
+ * Notes
+ * -----
+ * [1]: The pack is written into the resource directory as assets.fpk and is
+ *      a build artifact: an edited loose file is not seen until it is packed
+ *      again.
+ * [2]: The mapping is kept until close(), since music streams from it while
+ *      playing. close() must follow the release of all loaded audio.
+ ******************************************************************************/
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_mixer.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Table of contents entry of one packed file */
+struct AssetEntry
+{
+  uint64_t offset;
+  uint32_t length;
+};
+
+class AssetPack
+{
+private:
+  /* All packed files, by path relative to the root */
+  static std::unordered_map<std::string, AssetEntry> entries;
+
+  /* The mapped pack and its size */
+  static const char* region;
+  static uint64_t region_size;
+
+  /* Read copy of the pack, where mapping is not available */
+  static std::string region_copy;
+
+  /* The resource directory the pack paths are relative to */
+  static std::string root;
+
+  /*------------------- Constants -----------------------*/
+  const static std::vector<std::string> kEXTENSIONS; /* Packed extensions */
+  const static uint32_t kHEADER_SIZE; /* Bytes of the pack header */
+  const static std::string kMAGIC;    /* Leading identifier of a pack */
+  const static std::string kNAME;     /* File name of the pack */
+  const static uint32_t kVERSION;     /* Current pack format version */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Returns the relative key of a resource path. Empty if outside the root */
+  static std::string getKey(const std::string& path);
+
+  /* Returns the path in normal form, with single forward separators */
+  static std::string getNormalPath(const std::string& path);
+
+  /* Maps the pack file into the region */
+  static bool mapRegion(const std::string& path);
+
+  /* Little endian value reading from the region */
+  static bool takeValue(uint64_t& pos, uint64_t& value, uint8_t bytes);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Packs the image and audio files of the resource directory */
+  static bool build(std::string directory);
+
+  /* Unmaps the open pack */
+  static void close();
+
+  /* Is the resource packed or a loose file */
+  static bool exists(const std::string& path);
+
+  /* Returns the number of packed files of the open pack */
+  static uint32_t getCount();
+
+  /* Is a pack open */
+  static bool isOpen();
+
+  /* Loads an image, from the pack or else the loose file */
+  static SDL_Surface* loadImage(const std::string& path);
+
+  /* Loads music, from the pack or else the loose file */
+  static Mix_Music* loadMusic(const std::string& path);
+
+  /* Loads a WAV sound chunk, from the pack or else the loose file */
+  static Mix_Chunk* loadSound(const std::string& path);
+
+  /* Opens the pack of the resource directory, if there is one */
+  static bool open(std::string directory);
+
+  /* Returns a read stream over a packed file. Null if it is not packed */
+  static SDL_RWops* openFile(const std::string& path);
+};
+
+#endif // ASSETPACK_H
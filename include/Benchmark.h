@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Class Name: Benchmark
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Headless frame time benchmark. Collects the update and render
+ *              times of a fixed number of frames driven through the
+ *              Application run loop and dumps the per frame timings plus the
+ *              min/median/p99 summary as CSV. Also holds the scripted input
+ *              that is fed into the key handler while the frames run.
+ *
+ * Notes
+ * -----
+ * [1]: Only frames where the game is in a renderable scene (map, battle,
+ *      menu) are recorded. Loading frames are skipped.
+ * [2]: Each recorded frame runs exactly one update tick at the configured
+ *      tick rate, so the scripted input plays out the same on every run.
+ ******************************************************************************/
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <SDL2/SDL.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/* Single recorded frame */
+struct BenchFrame
+{
+  std::string scene;
+  double render_ms;
+  double update_ms;
+};
+
+/* Scripted key event, relative to the recorded frame index */
+struct BenchKey
+{
+  uint32_t frame;
+  SDL_Keycode keycode;
+  bool pressed;
+};
+
+class Benchmark
+{
+public:
+  /* Constructor function */
+  Benchmark(uint32_t frame_count = kDEFAULT_FRAMES,
+            std::string output_path = kDEFAULT_OUTPUT);
+
+private:
+  /* Number of frames to record before finishing */
+  uint32_t frame_count;
+
+  /* Recorded frames */
+  std::vector<BenchFrame> frames;
+
+  /* Output path for the per frame CSV */
+  std::string output_path;
+
+  /* Scripted key input, sorted by frame */
+  std::vector<BenchKey> script;
+  uint32_t script_index;
+
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kSCRIPT_ACTION; /* Frames between action key strikes */
+  const static uint32_t kSCRIPT_HOLD;   /* Frames each direction is held */
+
+public:
+  const static uint32_t kDEFAULT_FRAMES;   /* Default number of frames */
+  const static std::string kDEFAULT_OUTPUT; /* Default CSV output path */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Builds the default walking script */
+  void buildScript();
+
+  /* Returns the value at the given percentile of a sorted set */
+  static double percentile(const std::vector<double>& sorted, double pc);
+
+  /* Writes the summary rows for one scene */
+  void writeSummary(std::ofstream& out, std::string scene);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Adds a recorded frame */
+  void addFrame(std::string scene, double update_ms, double render_ms);
+
+  /* Returns the number of frames recorded */
+  uint32_t getFrameCount();
+
+  /* Returns the scripted key events that trigger on the next frame */
+  std::vector<BenchKey> getScriptKeys();
+
+  /* Returns true once all frames have been recorded */
+  bool isComplete();
+
+  /* Writes the per frame CSV and the summary CSV */
+  bool write();
+};
+
+#endif // BENCHMARK_H
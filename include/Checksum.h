@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Class Name: Checksum
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Incremental integrity checksum of the encrypted files. The
+ *              data is fed line by line as it is written or decrypted, so the
+ *              check needs no second copy or pass over the file. Two kinds
+ *              are supported: MD5 (the original, for existing files) and a
+ *              fast 64 bit hash (XXH64), which is the default for new files.
+ *
+ * Notes
+ * -----
+ * [1]: The kind of a file is identified by its digest line: the 64 bit hash
+ *      digest is tagged ("XH64:" and 16 hex digits), an MD5 digest is 32 hex
+ *      digits.
+ * [2]: The digest of each kind has a fixed length, so a placeholder digest
+ *      can be written first and replaced in place once the data is known.
+ ******************************************************************************/
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <cstdint>
+#include <string>
+
+#include "Md5.h"
+
+/* Kind of checksum */
+enum class ChecksumType : uint8_t
+{
+  MD5 = 0,
+  HASH64 = 1
+};
+
+class Checksum
+{
+public:
+  /* Constructor function */
+  Checksum(ChecksumType type = ChecksumType::HASH64);
+
+private:
+  /* The kind of checksum */
+  ChecksumType type;
+
+  /* MD5 state */
+  MD5 md5;
+
+  /* 64 bit hash state: the accumulators, the partial stripe and total size */
+  uint64_t accumulators[4];
+  unsigned char stripe[32];
+  uint32_t stripe_size;
+  uint64_t total_size;
+
+  /*------------------- Constants -----------------------*/
+  const static uint64_t kPRIME1; /* XXH64 primes */
+  const static uint64_t kPRIME2;
+  const static uint64_t kPRIME3;
+  const static uint64_t kPRIME4;
+  const static uint64_t kPRIME5;
+  const static uint32_t kSTRIPE; /* Bytes of one hash stripe */
+  const static std::string kTAG; /* Leading tag of a 64 bit hash digest */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Hash stripe helpers */
+  static uint64_t mixRound(uint64_t accumulator, uint64_t input);
+  static uint64_t read64(const unsigned char* data);
+  static uint64_t rotate(uint64_t value, int bits);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Returns the digest line of the data so far. Updates may continue */
+  std::string digest() const;
+
+  /* Returns the kind of checksum */
+  ChecksumType getType() const;
+
+  /* Returns the 64 bit hash of the data so far */
+  uint64_t hash() const;
+
+  /* Restarts the checksum with no data */
+  void reset(ChecksumType type = ChecksumType::HASH64);
+
+  /* Adds data to the checksum */
+  void update(const char* data, size_t length);
+  void update(const std::string& data);
+
+  /*===================== PUBLIC STATIC FUNCTIONS ============================*/
+public:
+  /* Returns the kind of checksum of a digest line */
+  static ChecksumType detect(const std::string& digest);
+};
+
+#endif // CHECKSUM_H
@@ -816,4 +816,75 @@ enum class WindowStatus : std::uint8_t
   HIDING
 };
 
+/*
+ * Description: Interned XML element names, for loaders that dispatch on the
+ *              element of a data leaf. The token of each element is looked up
+ *              once, as the element is read, by XmlData::tokenize().
+ *
+ * UNKNOWN - an element name that is not interned
+ * <NAME>  - the element of the same name, in lower case (except FAST_BATTLE)
+ */
+enum class XmlToken : std::uint16_t
+{
+  UNKNOWN = 0,
+  ACTION,
+  APP,
+  AUDIO_LEVEL,
+  AUTORUN,
+  BASE,
+  BATTLESCENE,
+  BATTLE_ANIMATIONS,
+  BEARACKS,
+  CLASS,
+  CORE,
+  CURRENTMAP,
+  DATE,
+  ENHANCER,
+  FADE,
+  FAST_BATTLE,
+  FRAME_LIMIT,
+  FULLSCREEN,
+  GAME,
+  GUI_ENABLED,
+  HEIGHT,
+  INVENTORY,
+  ITEM,
+  LEARNED,
+  LINEAR_FILTERING,
+  LOWER,
+  MAIN,
+  MAP,
+  MAPIO,
+  MAPITEM,
+  MAPNPC,
+  MAPPERSON,
+  MAPTHING,
+  MUSIC,
+  MUSIC_LEVEL,
+  NAME,
+  OPTIONS,
+  OVERLAY,
+  PARTY,
+  PATH,
+  PERSON,
+  PLAYER,
+  RACE,
+  SCALING_TEXT,
+  SCALING_UI,
+  SECTION,
+  SKILL,
+  SKILLSET,
+  SLEUTH,
+  SOUND,
+  SPRITE,
+  TICK_RATE,
+  TILEEVENT,
+  UNDERLAY,
+  UPPER,
+  VOL,
+  VSYNC,
+  WEATHER,
+  WIDTH
+};
+
 #endif // ENUMDB_H
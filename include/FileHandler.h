@@ -38,6 +38,24 @@
  *          //         </person>
  *
  *          stop();
+ *
+ *          Streamed XML file read
+ *          ----------------------
+ *          setFilename("name");
+ *          setFileType(FileType::XML);
+ *          setStreamEnabled(true);
+ *          start();
+ *          readXmlStream([](const XmlLeaf& leaf) { return true; });
+ *          stop();
+ *
+ *          Sectioned XML file read
+ *          -----------------------
+ *          setFilename("name");
+ *          setFileType(FileType::XML);
+ *          setStreamEnabled(true);
+ *          start();
+ *          readXmlSections("game", sections); // Raw text of <game> children
+ *          stop();
  *****************************************************************************/
 #ifndef FILEHANDLER_H
 #define FILEHANDLER_H
@@ -46,14 +64,13 @@
 #include <ctime>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "Helpers.h"
-#include "Md5.h"
+#include "Checksum.h"
 #include "tinyxml2.h"
 #include "XmlData.h"
-
-/* Macros */
-#define MX (((z>>5^y<<2) + (y>>3^z<<4)) ^ ((sum^y) + (kKEY[(p&3)^e] ^ z)))
+#include "XmlStream.h"
 
 class FileHandler
 {
@@ -86,8 +103,13 @@ private:
   /* Set if the encryption system is enabled */
   bool encryption_enabled;
 
+  /* Word array reused by the line encryption and decryption */
+  std::vector<uint32_t> crypt_words;
+
+  /* Running checksum of the data that has been written */
+  Checksum checksum;
+
   /* The filename information */
-  std::string file_data; /* The data that has been written */
   std::string file_date; /* The date of the file */
   std::string file_name; /* The name of the file */
   std::string file_name_temp; /* The temporary file name for writing */
@@ -95,84 +117,75 @@ private:
   FileType file_type;
   bool file_write;
 
+  /* Set if XML reads stream the leaves instead of building the document */
+  bool stream_enabled;
+
+  /* The decrypted source of a streamed XML read */
+  std::string stream_data;
+
   /* XML handlers for reading/writing */
   tinyxml2::XMLDocument* xml_document;
   tinyxml2::XMLNode* xml_node;
 
   /*------------------- Constants -----------------------*/
   const static int kASCII_IN_LONG;   /* # of ascii's that will fit in long */
-  const static uint32_t kDELTA;      /* Sum bias for encryption */
   const static int kENCRYPTION_MIN;  /* Min line length for encryption */
   const static int kENCRYPTION_PAD;  /* Padding for encrypted values */
   const static int kFILE_NAME_LIMIT; /* File end number limit */
   const static int kFILE_START;      /* File start for temp data */
+  const static int kHASH_BLOCK;      /* Bytes read per block when hashing */
   const static int kINT_BIT_SHIFT;   /* Shift int to next spot */
   const static int kINT_BUFFER;      /* Only use most significant int */
-  const static uint32_t kKEY[];      /* Key array for encryption */
   const static int kLONG_BIT_SHIFT;  /* Number of bits to shift long to
                                       * next spot */
   const static int kLONG_BUFFER;     /* Only use most significant long */
-  const static int kMAX_ASCII;       /* Max ascii out of bounds */
   const static int kMIN_LINE;        /* Minimum line length for encryption */
   const static int kPADDING_ASCII;   /* Start of padding characters */
-  const static int kXXTEA_ROUNDS;    /* Number of rounds for encryption */
+  const static uint32_t kPARALLEL_BATCHES; /* Lane batches per pool task */
+  const static uint32_t kPARALLEL_MIN_BYTES; /* Min file size to decrypt
+                                              * on the worker pool */
 
 /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
   /* Clean up function, frees appropriate pointers */
   void cleanUp();
 
-  /* Decrypt raw data in an array of ints */
-  bool decryptData(uint32_t* data);
+  /* Decrypt an encrypted line in place */
+  int decryptBlock(char* line, int length, char* output);
 
   /* Determines element XML count */
   void determineCount();
 
-  /* Decrypt line of data */
-  std::string decryptLine(std::string line, bool* success = 0);
-
-  /* Encrypt raw data in an array of ints */
-  bool encryptData(uint32_t* data);
-
-  /* Encrypt line of data */
-  std::string encryptLine(std::string line, bool* success = 0);
-
   /* Close the file using fstream in the class */
   bool fileClose();
 
   /* Open the file using fstream in the class */
   bool fileOpen();
 
-  /* Converts an array of ints into an array of longs -> 4 ints in one long */
-  uint32_t* intToLong(int* line_data, int length);
-
-  /* Converts an array of ints to a string line, representing the characters */
-  std::string intToString(int* line_data, int length, bool decrypting = 0);
+  /* Converts an encrypted line into its words -> 8 characters in one word */
+  int lineToWords(const char* line, int length, uint32_t* words);
 
-  /* Converts an array of longs into an array of ints -> one long -> 4 ints */
-  int* longToInt(uint32_t* line_data, int length);
+  /* Reads the full file in one pass, decrypted and with lines joined */
+  bool readBulk(std::string& data);
 
   /* The base read line class, reads data from the file */
   std::string readLine(bool* done = nullptr, bool* success = nullptr,
                        std::fstream* file_stream = nullptr);
 
-  /* Confirms if the MD5 matches the file */
-  bool readMd5();
+  /* Confirms if the checksum (MD5 or 64 bit hash) matches the file */
+  bool readChecksum();
 
   /* Ascertains the temp file name to be used in the program */
   bool setTempFileName();
 
-  /* Convert a string to an array of ints, each representing a character */
-  int stringToInt(std::string line, int** line_data, bool encrypting = 0);
-
   /* Returns the control to the top of the file */
   bool topOfFile();
 
   /* The base write line class, pushes data to the file */
-  bool writeLine(std::string line, bool md5_line = false);
+  bool writeLine(std::string line, bool checksum_line = false);
 
-  /* Takes a number and wraps it around, if it exceeds the limit */
-  int wrapNumber(int value, int limit);
+  /* Converts decrypted words back into a line, without the padding */
+  int wordsToLine(const uint32_t* words, int length, char* output);
 
   /* Returns the next data node from the current pointer */
   tinyxml2::XMLNode* xmlNextData(tinyxml2::XMLNode* starting_node);
@@ -189,9 +202,16 @@ private:
 
 /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
+  /* Decrypt line of data, as read from an encrypted file */
+  std::string decryptLine(std::string line, bool* success = 0);
+
+  /* Encrypt line of data, as written to an encrypted file */
+  std::string encryptLine(std::string line, bool* success = 0);
+
   /* Finds the element sequence in the stack (not including data entry) and
    * puts the active node pointer at that location. */
-  tinyxml2::XMLNode* findElement(XmlData data, bool save_location = false);
+  tinyxml2::XMLNode* findElement(const XmlData& data,
+                                 bool save_location = false);
 
   /* Returns a count of the number of elements */
   int getCount();
@@ -216,7 +236,8 @@ public:
 
   /* Finds the element in the stack (not including data entry) and then purges
    * all children. */
-  tinyxml2::XMLNode* purgeElement(XmlData data, bool save_location = false);
+  tinyxml2::XMLNode* purgeElement(const XmlData& data,
+                                  bool save_location = false);
 
   /* Reads the following line as a string. Only valid for REGULAR files */
   std::string readRegularLine(bool* done = nullptr, bool* success = nullptr);
@@ -225,6 +246,14 @@ public:
    * done */
   XmlData readXmlData(bool* done = nullptr, bool* success = nullptr);
 
+  /* Splits the children of the root element into raw text sections. Only
+   * valid for XML reads started with streaming enabled, until stop() */
+  bool readXmlSections(std::string root, std::vector<XmlSectionView>& sections);
+
+  /* Streams every XML data leaf after the date to the visitor, in order.
+   * Only valid for XML reads started with streaming enabled */
+  bool readXmlStream(const std::function<bool(const XmlLeaf&)>& visitor);
+
   /* Save - triggers the write to file without closing the document */
   bool save();
 
@@ -237,6 +266,9 @@ public:
   /* Sets the type that the file is that will be read */
   bool setFileType(FileType type);
 
+  /* Sets if XML reads are streamed instead of parsed into a document */
+  bool setStreamEnabled(bool enable);
+
   /* Sets if the class is read or write (TRUE if write) */
   bool setWriteEnabled(bool enable);
 
@@ -258,7 +290,7 @@ public:
   bool writeXmlData(std::string element, uint32_t data);
 
   /* Writes the data as described in the xml data set */
-  bool writeXmlDataSet(XmlData data, bool save_location = false);
+  bool writeXmlDataSet(const XmlData& data, bool save_location = false);
 
   /* Writes a starting XML element */
   bool writeXmlElement(std::string element,
@@ -278,6 +310,18 @@ public:
 
 /*===================== PUBLIC STATIC  FUNCTIONS ===========================*/
 public:
+  /* Copies the directory and all within it, over any existing files */
+  static bool dirCopy(std::string old_dirname, std::string new_dirname);
+
+  /* Creates the directory and its parents, if they do not exist */
+  static bool dirCreate(std::string dirname);
+
+  /* Deletes the directory and all within it, if it exists */
+  static bool dirDelete(std::string dirname);
+
+  /* Check if the directory exists */
+  static bool dirExists(std::string dirname);
+
   /* Copies the file and based on the overwrite flag */
   static bool fileCopy(std::string old_filename, std::string new_filename,
                        bool overwrite = false);
@@ -288,6 +332,12 @@ public:
   /* Check if the file exists */
   static bool fileExists(std::string filename);
 
+  /* Returns the 64 bit content hash of the file, if it exists */
+  static bool fileHash(std::string filename, uint64_t& hash);
+
+  /* Returns the size and modified time of the file, if it exists */
+  static bool fileInfo(std::string filename, uint64_t& size, int64_t& time);
+
   /* Rename the file, if it exists and the new name doesn't */
   static bool fileRename(std::string old_filename, std::string new_filename,
                          bool overwrite = false);
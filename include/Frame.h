@@ -12,19 +12,45 @@
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
+#include <atomic>
 #include <cmath>
 #include <cstdio>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "Helpers.h"
+#include "RenderBatch.h"
+#include "TextureCache.h"
 
 #include "SDL2_gfxPrimitives.h"
 
 /* PI */
 #define PI 3.14159265359
 
+class Frame;
+
+/* Image of a frame, decoded to surfaces ahead of the texture upload */
+struct FrameDecode
+{
+  uint16_t angle;
+  bool atlas;
+  std::shared_ptr<std::atomic<bool>> claimed;
+  bool enable_greyscale;
+  std::string error;
+  Frame* frame;
+  std::string key;
+  bool no_warnings;
+  std::string path;
+  SDL_Renderer* renderer;
+  SDL_Surface* surface;
+  SDL_Surface* surface_grey;
+  std::future<void> task;
+};
+
 /* Class for frame handling */
 class Frame
 {
@@ -48,6 +74,9 @@ private:
   /* The stored alpha value for rendering */
   uint8_t alpha;
 
+  /* The image decode pending upload, while deferred loading */
+  FrameDecode* decode;
+
   /* The frame control color mode */
   uint8_t color_alpha;
   ColorMode color_mode;
@@ -67,7 +96,7 @@ private:
   /* The previous element in the linked list */
   Frame* previous;
 
-  /* Source rect settings */
+  /* Source rect settings: the rect of the atlas page, if packed */
   SDL_Rect rect_src;
   bool rect_src_valid;
 
@@ -75,6 +104,9 @@ private:
   SDL_Texture* texture;
   SDL_Texture* texture_grey;
 
+  /* The cache key of the shared textures. Empty if not shared */
+  std::string texture_key;
+
   /* The width of the stored texture */
   int width;
 
@@ -84,6 +116,21 @@ private:
   const static float kGREY_FOR_GREEN;  /* Grey scale convert for green factor */
   const static float kGREY_FOR_RED;    /* Grey scale convert for red factor */
 
+  /*------------------- Static Members -----------------------*/
+  /* The image decodes pending upload, while deferred loading is on */
+  static bool decode_atlas;
+  static bool decode_deferred;
+  static std::unordered_set<std::string> decode_keys;
+  static std::vector<FrameDecode*> decode_queue;
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Sets the textures shared with other frames */
+  void setShared(const std::string& key, const TextureCacheEntry& shared);
+
+  /* Creates the textures from the decoded image */
+  bool uploadImage(FrameDecode& image);
+
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Executes the necessary image adjustments, as per the file data handlers */
@@ -126,10 +173,17 @@ public:
   /* Returns if an image is set */
   bool isTextureSet(bool grey_scale = false);
 
+  /* Returns if the image is still decoding, under deferred loading */
+  bool isTexturePending();
+
   /* Render the texture to the given renderer with the given parameters */
   bool render(SDL_Renderer* renderer, int x = 0, int y = 0, int w = 0,
               int h = 0, SDL_Rect* src_rect = nullptr, bool for_sprite = false);
 
+  /* Adds the frame to the batch, if it is packed in the atlas */
+  bool renderBatch(RenderBatch& batch, int x, int y, int w, int h,
+                   SDL_Color color);
+
   /* Sets the alpha rating of the texture rendering */
   void setAlpha(uint8_t alpha = 255);
 
@@ -174,8 +228,16 @@ private:
                                     SDL_Renderer* renderer, bool aliasing,
                                     bool flat_side = false);
 
+  /* Decodes the image to surfaces. Safe to call off the main thread */
+  static void decodeImage(FrameDecode& image);
+
   /*===================== PUBLIC STATIC  FUNCTIONS ===========================*/
 public:
+  /* Deferred loading: images set are decoded by the workers and uploaded at
+   * the end, on the main thread */
+  static void beginDeferredLoad(bool atlas = true);
+  static void endDeferredLoad();
+
   /* Draws a line given a vector of coordinates */
   static void drawLine(std::vector<Coordinate> line_points,
                        SDL_Renderer* renderer);
@@ -352,7 +352,7 @@ public:
   bool isNoInteraction();
 
   /* Load data from file */
-  bool loadData(XmlData data, int file_index, int section_index);
+  bool loadData(const XmlData& data, int file_index, int section_index);
 
   /* Save data to file */
   bool saveData(FileHandler* fh, std::string wrapper = "eventset");
@@ -576,18 +576,19 @@ public:
 
   /* Updates the conversation values of the pointed object, based on the XML
    * file data */
-  static void updateConversation(Conversation* reference, XmlData data,
+  static void updateConversation(Conversation* reference, const XmlData& data,
                                  int index, int section_index);
 
   /* Updates the event from the data in the file */
-  static Event updateEvent(Event event, XmlData data, int file_index,
+  static Event updateEvent(Event event, const XmlData& data, int file_index,
                            int section_index);
 
   /* Updates the event with one shot information */
   static Event updateEventOneShot(Event event, bool one_shot);
 
   /* Update the locked struct from the data in the file */
-  static Locked updateLocked(Locked locked_curr, XmlData data, int file_index);
+  static Locked updateLocked(Locked locked_curr, const XmlData& data,
+                             int file_index);
 };
 
 #endif // EVENTSET_H
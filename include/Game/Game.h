@@ -13,6 +13,7 @@
 
 #include <SDL2/SDL.h>
 #include <chrono>
+#include <future>
 #include <memory>
 
 // #include "Game/Battle/AIModuleTester.h"
@@ -24,6 +25,7 @@
 //#include "Game/Player/Bubby.h"
 #include "Game/Player/Inventory.h"
 #include "Game/Save.h"
+#include "GamePack.h"
 #include "Options.h"
 #include "SoundHandler.h"
 
@@ -113,16 +115,28 @@ private:
   std::string player_name;
   Sex player_sex;
 
-  /* Current save properties */
+  /* The background compile of the base file into its pack, which caches the
+   * parsed core data for the next start */
+  std::future<void> pack_task;
+
+  /* Current save properties - the slot file and the running map file */
   FileHandler save_handle;
+  FileHandler save_map_handle;
   uint8_t save_slot;
 
+  /* The background write of the last save and its state. The handle is owned
+   * by the task until it is waited on */
+  std::future<void> save_task;
+  bool save_task_menu;
+  bool save_task_success;
+
   /* Number of ticks since inception */
   uint64_t ticks_total;
 
   /* ------------ Constants --------------- */
 public:
   static const std::string kSAVE_IMG_BACK; /* Back of save img path */
+  static const std::string kSAVE_MAPS_BACK; /* Back of save maps path */
   static const std::string kSAVE_PATH_AUTO; /* The auto path addition */
   static const std::string kSAVE_PATH_BACK; /* Back of save path */
   static const std::string kSAVE_PATH_FRONT; /* Front of save path */
@@ -207,6 +221,9 @@ private:
   /* Returns the core struct item data for correlation purposes */
   std::vector<ItemData> getItemData();
 
+  /* Returns the load screen summary of the running game */
+  Save getSaveSummary(uint8_t slot);
+
   /* Load game */
   bool load(std::string base_file, SDL_Renderer* renderer,
             uint8_t slot = 0, bool encryption = false,
@@ -216,8 +233,15 @@ private:
   bool loadData(FileHandler* fh, SDL_Renderer* renderer,
                 bool core_data = false, bool save_data = false,
                 std::string level = "");
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 bool from_save = false);
+  bool loadData(GamePack* pack, SDL_Renderer* renderer,
+                bool core_data = false, bool save_data = false,
+                std::string level = "");
+
+  /* Load a single game data record, within the game element */
+  bool loadDataRecord(XmlData& data, SDL_Renderer* renderer, bool core_data,
+                      bool save_data, std::string level);
 
   /* Menu preparation functionality */
   void menuPreparation();
@@ -229,6 +253,21 @@ private:
    * in the game */
   void pollEvents();
 
+  /* Reads the load screen information of a save slot from the save file */
+  bool readSaveSlot(Save& slot, std::string path, std::string path_img,
+                    bool encryption);
+
+  /* Splits a save of one file into the slot and its map files, if needed */
+  bool saveSplit(std::string save_path);
+
+  /* Waits for the background save write, if any. Returns its success */
+  bool saveWait();
+
+  /* Writes the save files from the documents built in the save handles */
+  bool saveWrite(std::string save_path, std::string old_path,
+                 std::string img_path, std::string img_copy_path, Save summary,
+                 bool failed);
+
   /* Remove functions for game objects */
   void removeActions();
   void removeAll(); /* Properly staged remove all call */
@@ -306,8 +345,12 @@ public:
   /* Renders the title screen */
   bool render(SDL_Renderer* renderer);
 
-  /* Save game based on the current slot number */
-  bool save(uint8_t slot = 0, bool from_menu = false);
+  /* Returns if a background save write is still running */
+  bool isSaving();
+
+  /* Save game based on the current slot number. In background, the state is
+   * captured and the file is written from a worker thread */
+  bool save(uint8_t slot = 0, bool from_menu = false, bool background = false);
 
   /* Clears the passed in save slot number */
   bool saveClear(uint8_t slot);
@@ -322,6 +365,9 @@ public:
   void setPlayerName(std::string player_name);
   void setPlayerSex(Sex player_sex);
 
+  /* Sets the render interpolation progress between update ticks */
+  void setRenderAlpha(float alpha);
+
   /* Sets the active renderer to be used */
   void setRenderer(SDL_Renderer* renderer);
 
@@ -348,6 +394,10 @@ public:
   static std::string getSlotPath(uint8_t slot, std::string base_path = "",
                                  bool image = false, bool precall = false);
 
+  /* Returns the path of a map file of the save (the directory if no map) */
+  static std::string getSlotMapPath(std::string save_path,
+                                    std::string level = "");
+
   /* Saves screenshot of the current game as it stands */
   static bool saveScreenshot(std::string path, SDL_Rect rect,
                              SDL_Renderer* renderer, uint8_t factor = 4);
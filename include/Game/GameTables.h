@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Class Name: GameTables
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Binary snapshot of the core tables of a game, as constructed
+ *              from the base file: the actions, skills, skill sets, classes,
+ *              races, items and base persons. The snapshot is stored in the
+ *              pack of the base file (see GamePack), so the next start
+ *              restores the objects directly instead of building them again
+ *              from the records.
+ *
+ * Format (little endian)
+ * ----------------------
+ * Tables:  u32 version | u32 object count per table, in the order above
+ *          | per table: the fields of each object, in table order
+ * Ref:     u32 index of the object within its table + 1, 0 for none
+ * Sprite:  u8 present | the render settings | u32 count
+ *          | per build data: str32 head path | i32 frames | str32 tail path
+ * Frame:   u8 present | str32 image path
+ *
+ * Notes
+ * -----
+ * [1]: The objects refer to each other by table index, and are all created
+ *      before any field is read so the references are fixed up in one pass.
+ *      A table that refers to an object outside the tables, or holds state
+ *      the snapshot has no place for, is not written at all.
+ * [2]: Sprites keep only their build data and are built on the first render,
+ *      as when loaded from the XML. Thumbnail images are decoded by the
+ *      workers while the rest of the tables are read.
+ ******************************************************************************/
+#ifndef GAMETABLES_H
+#define GAMETABLES_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Player/Item.h"
+#include "Game/Player/Person.h"
+
+/* The core tables, as held by the game */
+struct CoreTables
+{
+  std::vector<Action*>& actions;
+  std::vector<Skill*>& skills;
+  std::vector<SkillSet*>& skill_sets;
+  std::vector<Category*>& classes;
+  std::vector<Category*>& races;
+  std::vector<Item*>& items;
+  std::vector<Person*>& persons;
+};
+
+class GameTables
+{
+public:
+  /* Constructor function */
+  GameTables(CoreTables tables);
+
+private:
+  /* The snapshot being written or read, and the read position */
+  std::string buffer;
+  uint32_t pos;
+
+  /* Table index of each object, while writing */
+  std::unordered_map<const void*, uint32_t> refs;
+
+  /* Renderer the thumbnails are set with, while reading */
+  SDL_Renderer* renderer;
+
+  /* The tables written from or read into */
+  CoreTables tables;
+
+  /* Has every value been written or read so far */
+  bool valid;
+
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kVERSION; /* Current snapshot format version */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Little endian value and string encoding */
+  template <typename T> void put(T value);
+  void put(float value);
+  void put(double value);
+  void put(const std::string& value);
+  template <typename T> void take(T& value);
+  void take(float& value);
+  void take(double& value);
+  void take(std::string& value);
+  uint32_t takeCount(uint32_t bytes);
+
+  /* Reference encoding, as the index within the table */
+  template <typename T> void putRef(T* object, const std::vector<T*>& table);
+  template <typename T> void takeRef(T*& object, const std::vector<T*>& table);
+
+  /* Shared object encoding */
+  void putAttributes(const AttributeSet& set);
+  void putFrame(Frame* frame);
+  void putSet(SkillSet* set);
+  void putSetElements(const SkillSet& set);
+  void putSprite(Sprite* sprite);
+  void takeAttributes(AttributeSet& set);
+  void takeFrame(Frame*& frame);
+  void takeSet(SkillSet*& set);
+  void takeSetElements(SkillSet& set);
+  void takeSprite(Sprite*& sprite);
+
+  /* Table object encoding */
+  void putAction(const Action& action);
+  void putCategory(const Category& category);
+  void putItem(const Item& item);
+  void putPerson(const Person& person);
+  void putSkill(const Skill& skill);
+  void takeAction(Action& action);
+  void takeCategory(Category& category);
+  void takeItem(Item& item);
+  void takePerson(Person& person);
+  void takeSkill(Skill& skill);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Restores the tables from the snapshot. The tables must be empty */
+  bool restore(const std::string& snapshot, SDL_Renderer* renderer);
+
+  /* Writes the snapshot of the tables */
+  bool snapshot(std::string& snapshot);
+};
+
+#endif // GAMETABLES_H
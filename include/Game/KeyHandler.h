@@ -93,6 +93,10 @@ private:
   /* The running text entry string */
   std::string text;
 
+  /* Injected keyboard state, used in place of the SDL state when enabled */
+  bool state_injection;
+  std::vector<uint8_t> state_injected;
+
   /* ------------ Constants --------------- */
   static const SDL_Keycode kMOVE_LEFT_DEFAULT; /* Default moving left key */
   static const SDL_Keycode kMOVE_LEFT_SECD;
@@ -161,6 +165,10 @@ public:
   bool isStruck(GameKey game_key);
   bool isStruck(SDL_Keycode keycode, bool* found);
 
+  /* Injects a key press or release, in place of the physical keyboard */
+  void injectEvent(SDL_Keycode keycode, bool pressed);
+  void injectEvent(SDL_KeyboardEvent key_event);
+
   /* Load a default set of Keys */
   void loadDefaults();
 
@@ -190,6 +198,9 @@ public:
   bool setKeyPrimary(GameKey game_key, SDL_Keycode new_keycode);
   bool setKeySecondary(GameKey game_key, SDL_Keycode new_keycode);
 
+  /* Sets if the injected key state replaces the physical keyboard state */
+  void setInjection(bool enabled);
+
   /* Assign a new enumerated mode to the KeyHandler */
   void setMode(KeyMode mode);
 
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Class Name: KeyRecorder
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Records and replays the keyboard input of a session, beneath
+ *              the KeyHandler. Every SDL_KeyboardEvent is stored with the
+ *              update tick index it was handled before, along with the RNG
+ *              seed and tick rate of the session. Replaying the recording
+ *              (one tick per frame, seeded the same) reproduces the same map
+ *              walk, NPC behaviour and battles, which makes for repeatable
+ *              end to end performance runs.
+ *
+ * Notes
+ * -----
+ * [1]: The recording file is a regular, unencrypted FileHandler file:
+ *        seed <seed>
+ *        tick_rate <ticks per second>
+ *        key <tick> <type> <state> <repeat> <scancode> <keycode> <mod>
+ *        ...
+ *        end <total ticks>
+ * [2]: Recording or replay must be started before the game is loaded, since
+ *      the generators are seeded at that point.
+ * [3]: A replay must be started with the same game file and level as the
+ *      recording, since only the input is recorded.
+ ******************************************************************************/
+#ifndef KEYRECORDER_H
+#define KEYRECORDER_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+#include "FileHandler.h"
+#include "Helpers.h"
+
+/* Record mode of the key recorder */
+enum class RecordMode
+{
+  DISABLED,
+  RECORDING,
+  REPLAYING
+};
+
+/* Recorded key event, with the update tick it was handled before */
+struct RecordKey
+{
+  uint32_t tick;
+  SDL_KeyboardEvent event;
+};
+
+class KeyRecorder
+{
+public:
+  /* Constructor function */
+  KeyRecorder();
+
+private:
+  /* Recorded (or loaded) key events, sorted by tick */
+  std::vector<RecordKey> events;
+  uint32_t event_index;
+
+  /* Record mode */
+  RecordMode mode;
+
+  /* Path of the recording file */
+  std::string path;
+
+  /* Seed of the recorded session */
+  uint32_t seed;
+
+  /* Current update tick and the tick that the replay ends on */
+  uint32_t tick;
+  uint32_t tick_end;
+
+  /* Tick rate of the recorded session */
+  uint32_t tick_rate;
+
+  /* Replay wall time, for the timing output */
+  Timer replay_timer;
+
+  /*------------------- Constants -----------------------*/
+  const static std::string kKEY_END;  /* End line identifier */
+  const static std::string kKEY_KEY;  /* Key event line identifier */
+  const static std::string kKEY_SEED; /* Seed line identifier */
+  const static std::string kKEY_TICK_RATE; /* Tick rate line identifier */
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Ticks the recorder, after each update tick */
+  void addTick();
+
+  /* Returns the key events to inject before the current tick, on replay */
+  std::vector<SDL_KeyboardEvent> getEvents();
+
+  /* Returns the record mode */
+  RecordMode getMode();
+
+  /* Returns the current update tick */
+  uint32_t getTick();
+
+  /* Returns the tick rate of the recorded session. 0 if unset */
+  uint32_t getTickRate();
+
+  /* Returns true once the replay has reached the end of the recording */
+  bool isComplete();
+
+  /* Records a key event, handled before the current tick */
+  void recordEvent(SDL_KeyboardEvent event);
+
+  /* Sets the tick rate that the recorded session runs at */
+  void setTickRate(uint32_t tick_rate);
+
+  /* Starts recording or replaying. Seeds the random number generators */
+  bool startRecording(std::string path);
+  bool startReplay(std::string path);
+
+  /* Stops the recorder. Writes the recording file, if recording */
+  bool stop();
+};
+
+#endif // KEYRECORDER_H
@@ -31,12 +31,30 @@
 // #include "Options.h"
 // #include "Sprite.h"
 
+/* Pre-rendered static tile layers of a square of tiles */
+struct TileChunk
+{
+  /* Lower and upper layers of the tiles that do not animate */
+  SDL_Texture* lower;
+  SDL_Texture* upper;
+
+  /* Tiles with animated layers, rendered live */
+  std::vector<Tile*> live_lower;
+  std::vector<Tile*> live_upper;
+
+  /* Are the textures up to date with the tiles */
+  bool valid;
+};
+
 /* Sub map structure - contains all data related only to each sub */
 struct SubMap
 {
   /* Tile data */
   std::vector<std::vector<Tile*>> tiles;
 
+  /* Tile chunks, each of kCHUNK_TILES by kCHUNK_TILES tiles */
+  std::vector<std::vector<TileChunk>> chunks;
+
   /* Thing data (and children) */
   std::vector<MapInteractiveObject*> ios;
   std::vector<MapItem*> items;
@@ -151,12 +169,18 @@ private:
   // /* The sectors on the map (for rooms, caves, houses etc) */
   // QList<Sector> sectors;
 
+  /* Render interpolation progress between the last and next update tick */
+  float render_alpha;
+
   /* Speed factor - for map based elements */
   float speed_factor;
 
   /* The set of map data */
   std::vector<SubMap> sub_map;
 
+  /* Quads of the tile layer being rendered, reused every frame */
+  RenderBatch tile_batch;
+
   /* The system options, used for rendering, settings, etc. */
   Options* system_options;
 
@@ -191,6 +215,8 @@ private:
   uint16_t zoom_size;
 
   /*------------------- Constants -----------------------*/
+  const static uint8_t kCHUNK_KEEP; /* Chunks kept around the view */
+  const static uint16_t kCHUNK_TILES; /* Tiles per side of a tile chunk */
   const static float kFADE_FACTOR; /* 1/x fade factor for ms cycle time */
   const static uint8_t kFADE_HOLD; /* The hold point in opacity to delay */
   const static uint16_t kFADE_HOLD_DELAY; /* The ms to delay at the hold */
@@ -219,16 +245,16 @@ public:
 /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
   /* Adds sprite data, as per data from the file */
-  bool addSpriteData(XmlData data, std::string id, int file_index,
+  bool addSpriteData(const XmlData& data, std::string id, int file_index,
                      SDL_Renderer* renderer, std::string base_game_path);
 
   /* Adds tile data, as per data from the file */
-  bool addTileData(XmlData data, uint16_t section_index);
+  bool addTileData(const XmlData& data, uint16_t section_index);
 
   /* Adds thing data, as per data from the file */
-  bool addThingBaseData(XmlData data, int file_index, SDL_Renderer* renderer,
-                        std::string base_game_path);
-  bool addThingData(XmlData data, uint16_t section_index,
+  bool addThingBaseData(const XmlData& data, int file_index,
+                        SDL_Renderer* renderer, std::string base_game_path);
+  bool addThingData(const XmlData& data, uint16_t section_index,
                     SDL_Renderer* renderer, bool from_save = false);
 
   /* Audio start/stop triggers */
@@ -236,6 +262,10 @@ private:
   void audioStop();
   void audioUpdate(bool sub_change = false);
 
+  /* Pre-renders the static tile layers of a chunk */
+  bool buildChunk(SDL_Renderer* renderer, uint16_t section, uint16_t chunk_x,
+                  uint16_t chunk_y);
+
   /* Change the mode that the game is running */
   bool changeMode(MapMode mode);
 
@@ -288,6 +318,10 @@ private:
   /* Initiates a thing action, based on the action key being hit */
   void initiateThingInteraction(MapPerson* initiator);
 
+  /* Marks the chunks of the section (or all sections), or of one tile, to be
+   * pre-rendered again */
+  void invalidateChunks(int section = -1, int tile_x = -1, int tile_y = -1);
+
   /* Returns if the color is currently in a transition status */
   bool isColorTransitioning();
 
@@ -302,10 +336,17 @@ private:
 
   /* Parse coordinate info from file to give the designated tile coordinates
    * to update */
-  bool parseCoordinateInfo(std::string row, std::string col, uint16_t index,
-                           uint16_t* r_start, uint16_t* r_end,
+  bool parseCoordinateInfo(std::string_view row, std::string_view col,
+                           uint16_t index, uint16_t* r_start, uint16_t* r_end,
                            uint16_t* c_start, uint16_t* c_end);
 
+  /* Releases the chunk textures away from the view, or all of them */
+  void releaseChunks(bool all = false);
+
+  /* Renders the lower or upper tile layers in view from the chunks */
+  bool renderChunks(SDL_Renderer* renderer, bool upper, int offset_x,
+                    int offset_y);
+
   /* Save the passed in sub map based on the map ID and other information */
   bool saveSubMap(FileHandler* fh, const uint32_t &id = 0,
                   const std::string &wrapper = "section",
@@ -326,7 +367,7 @@ private:
   bool setTiles(MapThing* ref);
 
   /* Splits the ID into a vector of IDs */
-  std::vector<std::vector<int32_t>> splitIdString(std::string id,
+  std::vector<std::vector<int32_t>> splitIdString(std::string_view id,
                                                   bool matrix = false);
 
   /* Lay triggers based on passed in information */
@@ -450,7 +491,7 @@ public:
   void keyUpEvent(KeyHandler& key_handler);
 
   /* Loads the map data */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_game_path, bool from_save = false);
   void loadDataFinish(SDL_Renderer* renderer);
 
@@ -483,6 +524,9 @@ public:
   /* Sets the operational event handler */
   void setEventHandler(EventHandler* event_handler);
 
+  /* Sets the render interpolation progress between update ticks */
+  void setRenderAlpha(float alpha);
+
   /* Sets the speed factor of update call on the map side */
   bool setSpeedFactor(float factor = 1.0);
 
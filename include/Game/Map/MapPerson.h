@@ -138,7 +138,7 @@ protected:
 public:
   /* Adds person information from the XML file. Will be virtually re-called
    * by all children for proper operation */
-  virtual bool addThingInformation(XmlData data, int file_index,
+  virtual bool addThingInformation(const XmlData& data, int file_index,
                                    int section_index, SDL_Renderer* renderer,
                                    std::string base_path = "",
                                    bool from_save = false);
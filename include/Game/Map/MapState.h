@@ -56,8 +56,9 @@ private:
 /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Adds the matrix information from the XML data classifier from file */
-  bool addFileInformation(XmlData data, int file_index, int section_index,
-                          SDL_Renderer* renderer, std::string base_path = "");
+  bool addFileInformation(const XmlData& data, int file_index,
+                          int section_index, SDL_Renderer* renderer,
+                          std::string base_path = "");
 
   /* Clear out the state definition and data from the class */
   void clear();
@@ -85,6 +85,9 @@ protected:
   bool movement_paused;
   uint16_t speed;
 
+  /* Movement of the last update tick (in tiles), for render interpolation */
+  Floatinate render_delta;
+
   /* Next new location for thing - may differ from starting point */
   uint16_t next_section;
   bool next_valid;
@@ -201,7 +204,7 @@ protected:
 public:
   /* Adds thing information from the XML file. Will be virtually re-called
    * by all children for proper operation */
-  virtual bool addThingInformation(XmlData data, int file_index,
+  virtual bool addThingInformation(const XmlData& data, int file_index,
                                    int section_index, SDL_Renderer* renderer,
                                    std::string base_path = "",
                                    bool from_save = false);
@@ -296,6 +299,9 @@ public:
   /* Returns the speed that the thing is moving at */
   uint16_t getSpeed() const;
 
+  /* Returns the render offset (pixels) back to the interpolated location */
+  Floatinate getRenderLag(float alpha);
+
   /* Returns the starting coordinates - as set by setLocationStart() */
   uint16_t getStartingSection();
   uint16_t getStartingX();
@@ -416,6 +422,9 @@ public:
   /* Sets the sound ID reference. Less than 0 unsets */
   void setSoundID(int32_t id);
 
+  /* Sets the movement of the last update tick, for render interpolation */
+  void setRenderDelta(Floatinate delta);
+
   /* Sets the things speed */
   void setSpeed(uint16_t speed);
 
@@ -44,9 +44,11 @@ private:
   uint16_t tile_width;
   uint16_t width;
 
-  /* The location of the viewport */
+  /* The location of the viewport, and at the previous update tick */
   float x;
+  float x_prev;
   float y;
+  float y_prev;
 
   /* The lock qualifiers, for who the viewport is centered on */
   LockStatus lock_on;
@@ -112,11 +114,13 @@ public:
   int getXStart();
   uint16_t getXTileEnd();
   uint16_t getXTileStart();
+  float getXRender(float alpha);
   float getY();
   int getYEnd();
   int getYStart();
   uint16_t getYTileEnd();
   uint16_t getYTileStart();
+  float getYRender(float alpha);
 
   /* Returns if travelling */
   bool isTravelForce();
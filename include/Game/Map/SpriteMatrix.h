@@ -33,6 +33,7 @@ private:
 
   /* -------------------------- Constants ------------------------- */
   const static float kBASE_FRAME_COUNT; /* Base num frames for tuning anim */
+  const static uint8_t kMAX_RANGES; /* Path range x/y set stack buffer */
 
 /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
@@ -61,8 +62,8 @@ private:
 /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Adds the matrix information from the XML data classifier from file */
-  bool addFileInformation(XmlData data, int file_index, SDL_Renderer* renderer,
-                          std::string base_path = "");
+  bool addFileInformation(const XmlData& data, int file_index,
+                          SDL_Renderer* renderer, std::string base_path = "");
 
   /* Returns the sprite at a given coordinate - unprotected */
   TileSprite* at(uint16_t x, uint16_t y);
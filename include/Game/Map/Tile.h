@@ -24,6 +24,7 @@ class MapThing;
 #include "EnumDb.h"
 #include "Game/EventHandler.h"
 #include "Helpers.h"
+#include "RenderBatch.h"
 #include "Sprite.h"
 
 class Tile
@@ -181,6 +182,10 @@ public:
   bool insertLower(Sprite* lower, uint8_t index);
   bool insertUpper(Sprite* upper, uint8_t index);
 
+  /* Returns if a sprite of the lower or upper layers animates */
+  bool isAnimatedLower() const;
+  bool isAnimatedUpper() const;
+
   /* Returns if the Base Layer is set (ie. at least one) */
   bool isBaseSet() const;
 
@@ -220,6 +225,13 @@ public:
   bool renderLower(SDL_Renderer* renderer, int offset_x = 0, int offset_y = 0);
   bool renderUpper(SDL_Renderer* renderer, int offset_x = 0, int offset_y = 0);
 
+  /* Paints one layer of the active sprites, batching the sprites that can be.
+   * Lower layers are the base, the enhancer, then the lower sprites */
+  bool renderLower(SDL_Renderer* renderer, RenderBatch& batch, uint8_t layer,
+                   int offset_x = 0, int offset_y = 0);
+  bool renderUpper(SDL_Renderer* renderer, RenderBatch& batch, uint8_t layer,
+                   int offset_x = 0, int offset_y = 0);
+
   /* Sets the base portion of the layer and the passability */
   bool setBase(Sprite* base);
   bool setBasePassability(Direction dir, bool set_value);
@@ -261,8 +273,10 @@ public:
   void setY(uint16_t y);
 
   /* Updates the relevent enter and exit events, from file data */
-  bool updateEventEnter(XmlData data, int file_index, uint16_t section_index);
-  bool updateEventExit(XmlData data, int file_index, uint16_t section_index);
+  bool updateEventEnter(const XmlData& data, int file_index,
+                        uint16_t section_index);
+  bool updateEventExit(const XmlData& data, int file_index,
+                       uint16_t section_index);
 
   /* Unsets the base layer(s) */
   void unsetBase();
@@ -296,6 +310,12 @@ public:
   /* Unsets the upper layer(s) */
   void unsetUpper();
   bool unsetUpper(uint8_t index);
+
+  /*===================== PUBLIC STATIC FUNCTIONS ============================*/
+public:
+  /* Returns the number of render layers, for the layer render calls */
+  static uint8_t getLowerLayerCount();
+  static uint8_t getUpperLayerCount();
 };
 
 #endif // TILE_H
@@ -46,8 +46,9 @@ private:
 /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Adds sprite information from the XML data classifier from the file */
-  bool addFileInformation(XmlData data, int index, SDL_Renderer* renderer,
-                          std::string base_path = "", bool no_warnings = false);
+  bool addFileInformation(const XmlData& data, int index,
+                          SDL_Renderer* renderer, std::string base_path = "",
+                          bool no_warnings = false);
 
   /* Call to add passability, as extracted from file data */
   void addPassability(std::string data);
@@ -189,6 +189,9 @@ public:
   /* Annihilates an action object - default destructor */
   ~Action() = default;
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Set of ActionFlags for the current action */
   ActionFlags action_flags;
@@ -55,6 +55,9 @@ public:
   /* Default destructor */
   ~AttributeSet() = default;
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Flags for the state of the Attribtue */
   AttributeState flags{static_cast<AttributeState>(0)};
@@ -66,6 +66,9 @@ public:
            const std::string &denonym, const AttributeSet &base_stats,
            const AttributeSet &max_stats, SkillSet* const skills = nullptr);
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Has the attribute min and max sets been built? */
   static bool attr_sets_built;
@@ -130,7 +133,7 @@ public:
   bool isImmune(const Infliction &check_immunity);
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer);
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer);
 
   /* Prints out the state of the object */
   void print(const bool &simple = false, const bool &flags = false);
@@ -133,7 +133,7 @@ public:
   uint32_t hasRoom(Item* const item, uint32_t amount = 1);
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_path);
 
   /* Prints out the state of the inventory */
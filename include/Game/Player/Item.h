@@ -102,6 +102,9 @@ public:
   /* Annihilates an Item object */
   virtual ~Item();
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Static ID counter for the Item class */
   static int32_t id;
@@ -209,7 +212,7 @@ public:
   bool isBaseItem();
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_path);
 
   /* Prints the value of the flags of the Item */
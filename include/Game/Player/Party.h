@@ -110,7 +110,7 @@ public:
   bool isInParty(Person* const check_person);
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_path);
 
   /* Move a member between the Reserve and the Standard party */
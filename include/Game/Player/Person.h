@@ -72,6 +72,9 @@ public:
   /* Annihilates a Person object */
   ~Person();
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Action x and y render location */
   int16_t action_x;
@@ -240,7 +243,7 @@ public:
   bool isPowerGuarder();
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_path);
 
   /* Lose an amount of experience */
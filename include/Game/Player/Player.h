@@ -101,7 +101,7 @@ public:
   uint32_t getSteps();
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_path);
 
   /* Removes a bearacks member by index by calling Party's remove function */
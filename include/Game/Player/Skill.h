@@ -65,6 +65,9 @@ public:
   /* Destructor function */
   ~Skill();
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Pointer to the animation played by the Skill during Battle */
   Sprite* animation;
@@ -147,7 +150,7 @@ public:
   bool isValid();
 
   /* Load data from file */
-  bool loadData(XmlData data, int index, SDL_Renderer* renderer,
+  bool loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                 std::string base_path);
 
   /* Prints out the information about the current Skill state */
@@ -57,6 +57,9 @@ public:
   /* Annihilates a SkillSet object - default destructor */
   ~SkillSet() = default;
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* The ID of the set */
   int id;
@@ -7,7 +7,10 @@
 * Notes
 * -----
 *
-* [1]:
+* [1]: The load screen fields are also written next to the save as a fixed
+*      format summary (<save>.summary), stamped with the token written near
+*      the top of the save with each write. The summary is only used while
+*      the stamp matches, which only needs the start of the save read.
 *
 * TODO
 * ----
@@ -67,6 +70,9 @@ private:
   /* The save snapshot path */
   std::string snapshot_path;
 
+  /* The token of the save write, shared with its summary */
+  std::string stamp;
+
   /* The play time data for the save file */
   uint32_t time_hrs;
   uint32_t time_min;
@@ -74,6 +80,10 @@ private:
 
   /* ------------ Constants --------------- */
   static const SDL_Color kCOLOR_TEXT;
+  static const std::string kSUMMARY_EXTENSION;
+  static const std::string kSUMMARY_MAGIC;
+  static const uint32_t kSUMMARY_PREFIX;
+  static const uint32_t kSUMMARY_VERSION;
   static const int32_t kUNSET_ID;
 
 public:
@@ -115,17 +125,26 @@ public:
   /* Returns the save snapshot path */
   std::string getSnapshotPath();
 
+  /* Returns the token of the save write */
+  std::string getStamp();
+
   /* Returns the time data elements */
   uint32_t getTimeHours();
   uint32_t getTimeMinutes();
   uint32_t getTimeSeconds();
 
+  /* Loads the summary of the save, if it matches the save file */
+  bool loadSummary(std::string save_path);
+
   /* Prints the class data - primarily for testing */
   void print();
 
   /* Return the Render frame for this Save */
   SDL_Texture* createRenderFrame(SDL_Renderer* renderer);
 
+  /* Writes the summary of the save, stamped with the save write */
+  bool saveSummary(std::string save_path);
+
   /* Assigns configuration to the save file */
   bool setConfig(Options* config);
 
@@ -143,6 +162,7 @@ public:
   /* Assign the date data to the object */
   void setDate(uint32_t date_year, uint32_t date_month, uint32_t date_day,
                uint32_t date_hour, uint32_t date_minute);
+  bool setDate(std::string date_time);
 
   /* Set the value of a given SaveState flag */
   void setFlag(SaveState set_flags, const bool& set_value = true);
@@ -153,6 +173,9 @@ public:
   /* Sets the save snapshot path */
   void setSnapshotPath(std::string path);
 
+  /* Sets the token of the save write */
+  void setStamp(std::string stamp);
+
   /* Assign time data to the object */
   void setTime(uint32_t time_hrs, uint32_t time_min, uint32_t time_sec);
 
@@ -160,6 +183,14 @@ public:
  * PUBLIC STATIC FUNCTIONS
  *========================================================================*/
 public:
+  /* Creates a new token for a save write */
+  static std::string createStamp();
+
+  /* Returns the summary path of the save path */
+  static std::string getSummaryPath(std::string save_path);
+
+  /* Reads the token of the save write from the start of the save */
+  static std::string readStamp(std::string save_path);
 };
 
 #endif // SAVE_H
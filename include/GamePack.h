@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Class Name: GamePack
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Compiled binary form of a game (or save) XML file. The compiler
+ *              reads every data leaf of the XML once and writes it as a typed
+ *              record into a section: one section for the core data and one
+ *              per map level. A table of contents holds the byte offset,
+ *              length and record count of each section, so a load reads the
+ *              core section and the single requested map directly instead of
+ *              scanning the full document for each. The game also keeps it
+ *              as a cache of the base file: a base file loaded from XML is
+ *              compiled in the background for the next start, together with
+ *              the core tables constructed from it (see GameTables). These
+ *              replace the records of the tables, so the next start restores
+ *              the core objects instead of building them again.
+ *
+ * Format (little endian)
+ * ----------------------
+ * Header:  "FISP" | u32 version | u32 flags | u64 source size
+ *          | i64 source modified time | u64 source content hash
+ *          | u32 section count
+ *          | u64 table of contents offset
+ * Record:  u8 element count | per element: str16 element, key, value
+ *          | u8 data type | data (u8 bool, i32 int, f32 float or str32)
+ * Tables:  the core table snapshot, as written by GameTables
+ * TOC:     per section: u8 type | str16 key | u64 offset | u32 length
+ *          | u32 record count
+ *
+ * Notes
+ * -----
+ * [1]: The pack is written next to the source as <source>.pack. It is only
+ *      used while the source size and content hash (see Checksum) match the
+ *      header, so an edited or re-saved source falls back to the XML until
+ *      it is compiled again. The hash is only computed when the size or the
+ *      modified time differ from the header: a source with both unchanged is
+ *      trusted as is. A copied or touched source with the same content stays
+ *      current, and its new time is stored so the next open trusts it.
+ * [2]: The pack of an encrypted source is encrypted too (the encrypted flag):
+ *      each section is padded to whole words and encrypted with Xxtea, so
+ *      a save pack does not leave its records readable next to the save. The
+ *      table of contents only holds the map level ids and stays plain.
+ * [3]: The tables section is optional. A pack without it, as compiled from
+ *      the command line, holds the records of the core tables instead. The
+ *      game rebuilds the tables from the XML if the snapshot cannot be
+ *      restored.
+ ******************************************************************************/
+#ifndef GAMEPACK_H
+#define GAMEPACK_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "XmlData.h"
+
+/* Pack section types */
+enum class PackSectionType : uint8_t
+{
+  CORE = 0,
+  MAP = 1,
+  TABLES = 2
+};
+
+/* Table of contents entry of one section */
+struct PackSection
+{
+  PackSectionType type;
+  std::string key;
+  uint64_t offset;
+  uint32_t length;
+  uint32_t count;
+};
+
+class GamePack
+{
+public:
+  /* Constructor function */
+  GamePack();
+
+  /* Destructor function */
+  ~GamePack();
+
+private:
+  /* The open pack file */
+  std::ifstream pack_stream;
+
+  /* Path of the open pack */
+  std::string pack_path;
+
+  /* Are the sections of the open pack encrypted */
+  bool pack_encrypted;
+
+  /* Table of contents of the open pack */
+  std::vector<PackSection> sections;
+
+  /*------------------- Constants -----------------------*/
+  const static std::string kEXTENSION; /* Pack file extension */
+  const static uint32_t kFLAG_ENCRYPTED; /* Header flag: sections encrypted */
+  const static uint32_t kHEADER_SIZE;  /* Bytes of the pack header */
+  const static std::string kMAGIC;     /* Leading identifier of a pack */
+  const static std::vector<std::string> kTABLE_ELEMENTS; /* Table records */
+  const static std::string kTEMP_EXTENSION; /* Pack being compiled */
+  const static uint32_t kVERSION;      /* Current pack format version */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Pads the section buffer to whole words and encrypts it, or decrypts it */
+  static bool cryptSection(std::string& buffer, bool encrypt);
+
+  /* Decodes one record from the section buffer */
+  static bool decodeRecord(const std::string& buffer, uint32_t& pos,
+                           XmlData& data);
+
+  /* Encodes one record onto the section buffer */
+  static void encodeRecord(std::string& buffer, XmlData& data);
+
+  /* Little endian value and string encoding */
+  static void putString(std::string& buffer, const std::string& value,
+                        bool wide = false);
+  static void putValue(std::string& buffer, uint64_t value, uint8_t bytes);
+  static bool takeString(const std::string& buffer, uint32_t& pos,
+                         std::string& value, bool wide = false);
+  static bool takeValue(const std::string& buffer, uint32_t& pos,
+                        uint64_t& value, uint8_t bytes);
+
+  /* Stores the source modified time in the header of the open pack */
+  bool putSourceTime(int64_t source_time);
+
+  /* Reads the bytes of the section */
+  bool readBuffer(const PackSection& section, std::string& buffer);
+
+  /* Reads all records of the section */
+  bool readSection(PackSectionType type, std::string key,
+                   std::vector<XmlData>& records);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Closes the open pack */
+  void close();
+
+  /* Is a pack open */
+  bool isOpen();
+
+  /* Opens the pack of the source file, if it is current */
+  bool open(std::string source);
+
+  /* Reads the core data records */
+  bool readCore(std::vector<XmlData>& records);
+
+  /* Reads the records of the map level. Empty if the level is not packed */
+  bool readMap(std::string level, std::vector<XmlData>& records);
+
+  /* Reads the core table snapshot. Empty if the tables are not packed */
+  bool readTables(std::string& tables);
+
+  /*===================== PUBLIC STATIC FUNCTIONS ============================*/
+public:
+  /* Compiles the XML source file into its pack. Safe on a worker thread */
+  static bool compile(std::string source, bool encryption = false,
+                      const std::string& tables = "");
+
+  /* Returns the pack path of the source file */
+  static std::string getPackPath(std::string source);
+};
+
+#endif // GAMEPACK_H
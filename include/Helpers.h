@@ -32,6 +32,7 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "EnumDb.h"
@@ -49,6 +50,11 @@ public:
   {
     return std::chrono::duration_cast<second_>(clock_::now() - beg_).count();
   }
+  uint32_t elapsedMicro() const
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(clock_::now() -
+                                                                beg_).count();
+  }
 
 private:
   typedef std::chrono::high_resolution_clock clock_;
@@ -128,6 +134,16 @@ struct UCoordinate
   }
 };
 
+/* Ordered range of values, min to max. A single value has min equal to max */
+struct ValueRange
+{
+  ValueRange() : min{0}, max{0} {};
+  ValueRange(uint16_t min, uint16_t max) : min{min}, max{max} {};
+
+  uint16_t min;
+  uint16_t max;
+};
+
 class Helpers
 {
 public:
@@ -138,6 +154,7 @@ public:
 private:
   /* Mersenne Twister Engines */
   static const uint32_t seed_original;
+  static uint32_t seed_current;
   static std::mt19937 rand_eng;
   static std::mt19937_64 rand_64_eng;
   static SDL_Texture* mask_black; /* Fading manipulator */
@@ -169,6 +186,12 @@ public:
   /* Generates and returns an unsigned p-random 64-bit unsigned int */
   static uint64_t randU64();
 
+  /* Returns the seed that the generators were last seeded with */
+  static uint32_t getSeed();
+
+  /* Re-seeds the generators, for reproducible runs (ex. input replay) */
+  static void setSeed(uint32_t seed);
+
   /* Rolls an X-Sided die S times */
   static int rollXS(const int& x_sides, const int& s_times);
 
@@ -328,26 +351,45 @@ public:
   /* Methods for trimming white space from left of string ends */
   static std::string ltrim(std::string s);
 
+  /* Returns the next delimited token at the position and moves past it */
+  static std::string_view nextToken(std::string_view line, char delim,
+                                    size_t& pos);
+
   /* Takes a range and parses it to determine the x and y, min and max parts */
-  static bool parseRange(std::string sequence, uint32_t& x_min, uint32_t& x_max,
-                         uint32_t& y_min, uint32_t& y_max);
+  static bool parseRange(std::string_view sequence, uint32_t& x_min,
+                         uint32_t& x_max, uint32_t& y_min, uint32_t& y_max);
 
   /* Parses a comma delimited range and separates into integers */
   static std::vector<std::vector<uint16_t>> parseRangeSet(std::string sequence);
 
+  /* Parses a comma delimited range into the buffer. Returns the range count */
+  static uint32_t parseRangeSet(std::string_view sequence, ValueRange* ranges,
+                                uint32_t max_ranges);
+
   /* Methods for trimming white space from right of string ends */
   static std::string rtrim(std::string s);
 
   /* Splits the string using the given delimiter */
   static std::vector<std::string> split(const std::string& s, char delim);
 
+  /* Finds the first and last tokens of a split, without splitting between */
+  static bool splitEnds(std::string_view line, char delim,
+                        std::string_view& first, std::string_view& last);
+
+  /* Splits into views of the line in the buffer. Returns the token count */
+  static uint32_t splitView(std::string_view line, char delim,
+                            std::string_view* tokens, uint32_t max_tokens);
+
   /* Methods for trimming whitespace from both ends of std::strings */
   static std::string trim(std::string s);
 
+  /* Converts the leading integer of the view, as atoi() would */
+  static int32_t viewToInt(std::string_view view);
+
   /* Update load calls for global structs */
-  static LayOver updateLayOver(LayOver lay_over, XmlData data, int file_index,
-                               std::string base_directory);
-  static BattleScene updateScene(BattleScene scene, XmlData data,
+  static LayOver updateLayOver(LayOver lay_over, const XmlData& data,
+                               int file_index, std::string base_directory);
+  static BattleScene updateScene(BattleScene scene, const XmlData& data,
                                  int file_index, std::string base_directory);
 
   /*======================= GRAPHICAL FUNCTIONS =============================*/
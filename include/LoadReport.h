@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Class Name: LoadReport
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Per phase breakdown of the game load time. Each load phase
+ *              (file read, XML parse, core data, map sprites/tiles/things,
+ *              load finish and the lazy sprite texture builds of the first
+ *              frame) is timed by a LoadScope into an atomic total. Once the
+ *              first frame after the load is rendered, the breakdown is
+ *              appended as a row to a CSV report so load times can be tracked
+ *              across game builds.
+ *
+ * Notes
+ * -----
+ * [1]: Phase times are inclusive. Only the time spent while a load is being
+ *      reported is recorded - file access from saves or options is ignored.
+ * [2]: The report is disabled unless an output path is set.
+ ******************************************************************************/
+#ifndef LOADREPORT_H
+#define LOADREPORT_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "Helpers.h"
+
+/* Reported load phases. COUNT must remain last */
+enum class LoadPhase : uint8_t
+{
+  FILE_READ = 0,
+  XML_PARSE = 1,
+  CORE_DATA = 2,
+  MAP_SPRITES = 3,
+  MAP_TILES = 4,
+  MAP_THINGS = 5,
+  MAP_FINISH = 6,
+  SPRITE_BUILD = 7,
+  COUNT = 8
+};
+
+class LoadReport
+{
+private:
+  /* Is a load currently being reported */
+  static std::atomic<bool> active;
+
+  /* Game file and level of the reported load */
+  static std::string game_file;
+  static int game_level;
+
+  /* Total time from the start of the load to the first frame */
+  static Timer load_timer;
+  static uint64_t load_time;
+
+  /* Output path of the CSV report. Empty if disabled */
+  static std::string output_path;
+
+  /* Number of times each phase was entered */
+  static std::vector<std::atomic<uint32_t>> phase_counts;
+
+  /* Time spent in each phase, in microseconds */
+  static std::vector<std::atomic<uint64_t>> phase_times;
+
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kPHASE_COUNT; /* Number of reported phases */
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Completes the report after the first frame, and writes it */
+  static bool finish();
+
+  /* Returns the column name of the phase */
+  static std::string getPhaseName(LoadPhase phase);
+
+  /* Is a load currently being reported */
+  static bool isActive();
+
+  /* Marks the end of the load itself. The first frame is still reported */
+  static void loadEnd();
+
+  /* Records the time spent in the phase */
+  static void record(LoadPhase phase, uint32_t microseconds);
+
+  /* Sets the output path of the CSV report. Empty disables the report */
+  static void setOutput(std::string path);
+
+  /* Starts reporting a load of the game file and level */
+  static void start(std::string file, int level);
+};
+
+/* Scoped load phase - records the time from construction to destruction */
+class LoadScope : public Timer
+{
+public:
+  LoadScope(LoadPhase phase) : Timer(), phase{phase} {};
+  ~LoadScope()
+  {
+    if(LoadReport::isActive())
+      LoadReport::record(phase, elapsedMicro());
+  }
+
+private:
+  LoadPhase phase;
+};
+
+#endif // LOADREPORT_H
@@ -88,6 +88,10 @@ public:
   uint32_t scaling_text;
   uint32_t scaling_ui;
 
+  /* Simulation tick rate and render frame limit (when vsync is disabled) */
+  uint32_t frame_limit;
+  uint32_t tick_rate;
+
   /*--------------------- Constants --------------------*/
   const static std::uint32_t kDEF_SCREEN_WIDTH;
   const static std::uint32_t kDEF_SCREEN_HEIGHT;
@@ -95,6 +99,10 @@ public:
   const static uint32_t kDEF_MUSIC_LEVEL;
   const static uint32_t kDEF_SCALING_TEXT;
   const static uint32_t kDEF_SCALING_UI;
+  const static uint32_t kDEF_FRAME_LIMIT;
+  const static uint32_t kDEF_TICK_RATE;
+  const static uint32_t kMAX_TICK_RATE;
+  const static uint32_t kMIN_TICK_RATE;
 
   /*======================== PRIVATE FUNCTIONS ===============================*/
 private:
@@ -140,6 +148,9 @@ public:
   /* Returns a pointer to a constructed font by enumerated value */
   TTF_Font* getFontTTF(FontName font);
 
+  /* Render frame limit getter, in frames per second */
+  uint32_t getFrameLimit();
+
   /* Music getter */
   int32_t getMusicLevel();
 
@@ -155,6 +166,9 @@ public:
   uint16_t getScreenHeight();
   uint16_t getScreenWidth();
 
+  /* Simulation tick rate getter, in updates per second */
+  uint32_t getTickRate();
+
   /* Returns true if the sound is enabled */
   bool isAudioEnabled();
 
@@ -168,7 +182,7 @@ public:
   bool isVsyncEnabled();
 
   /* Load Options data from Save File */
-  bool loadData(XmlData data, int index);
+  bool loadData(const XmlData& data, int index);
 
   /* Save Options data to Save File */
   bool saveData(FileHandler* fh);
@@ -179,6 +193,9 @@ public:
   /* Sets an option flag to a given state */
   void setFlag(OptionState flags, bool set_value = true);
 
+  /* Render frame limit setter, in frames per second (0 is unlimited) */
+  void setFrameLimit(int32_t new_limit);
+
   /* Sound setter */
   void setMusicLevel(int32_t new_level);
 
@@ -189,6 +206,9 @@ public:
   /* Sets the sound handler used. If unset, no sounds will play */
   void setSoundHandler(SoundHandler* new_handler);
 
+  /* Simulation tick rate setter, in updates per second */
+  void setTickRate(int32_t new_rate);
+
   /* Update the options state */
   void update();
 
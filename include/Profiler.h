@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Class Name: Profiler
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Scoped zone profiler for the hot paths of the run loop. Each
+ *              zone is timed by a ProfileScope (a Timer which records on
+ *              destruction) into a per frame ring buffer of atomic counters, so
+ *              recording never locks. The ring buffer is summarized into
+ *              rolling averages and a frame time graph by an overlay that is
+ *              drawn on top of the frame.
+ *
+ * Notes
+ * -----
+ * [1]: Zone times are inclusive. A zone nested in another (ex. Map render
+ *      inside of the application render) is also counted in the outer zone.
+ * [2]: Zones are accumulated if entered more than once in a frame.
+ ******************************************************************************/
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "Helpers.h"
+#include "Text.h"
+
+/* Profiled zones. COUNT must remain last */
+enum class ProfileZone : uint8_t
+{
+  APP_UPDATE = 0,
+  APP_RENDER = 1,
+  MAP_UPDATE = 2,
+  MAP_RENDER = 3,
+  BATTLE_UPDATE = 4,
+  BATTLE_RENDER = 5,
+  MENU_RENDER = 6,
+  SOUND_PROCESS = 7,
+  COUNT = 8
+};
+
+class Profiler
+{
+private:
+  /* Index of the frame currently being recorded (unbounded, wrapped on use) */
+  static std::atomic<uint32_t> frame_index;
+
+  /* Timer of the frame currently being recorded */
+  static Timer frame_timer;
+
+  /* Ring buffer of total frame times, in microseconds */
+  static std::vector<std::atomic<uint32_t>> frame_times;
+
+  /* Overlay text lines and the number of frames until they are rebuilt */
+  static std::vector<Text*> overlay_lines;
+  static uint32_t overlay_refresh;
+
+  /* Is the overlay displayed on top of the frame */
+  static std::atomic<bool> overlay_enabled;
+
+  /* Ring buffer of zone times, in microseconds (frame major) */
+  static std::vector<std::atomic<uint32_t>> zone_times;
+
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kFRAME_BUDGET;     /* Frame budget, in microseconds */
+  const static uint32_t kFRAME_COUNT;      /* Frames in the ring buffer */
+  const static uint16_t kGRAPH_HEIGHT;     /* Height of the frame time graph */
+  const static uint16_t kOVERLAY_GAP;      /* Gap around the overlay elements */
+  const static uint32_t kOVERLAY_REFRESH;  /* Frames between text rebuilds */
+  const static uint32_t kZONE_COUNT;       /* Number of profiled zones */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Builds the overlay text lines from the current averages */
+  static void buildOverlay(SDL_Renderer* renderer, TTF_Font* font);
+
+  /* Returns the number of completed frames available in the ring buffer */
+  static uint32_t getFrameSpan();
+
+  /* Returns the ring buffer slot of the frame, offset back from current */
+  static uint32_t getSlot(uint32_t frames_back);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Completes the current frame and starts recording the next one */
+  static void frameEnd();
+
+  /* Average and maximum times over the ring buffer, in microseconds */
+  static uint32_t getAverage(ProfileZone zone);
+  static uint32_t getAverageFrame();
+  static uint32_t getMax(ProfileZone zone);
+  static uint32_t getMaxFrame();
+
+  /* Returns the display name of the zone */
+  static std::string getZoneName(ProfileZone zone);
+
+  /* Is the overlay displayed */
+  static bool isOverlayEnabled();
+
+  /* Records the time spent in the zone for the current frame */
+  static void record(ProfileZone zone, uint32_t microseconds);
+
+  /* Renders the overlay, if enabled */
+  static bool renderOverlay(SDL_Renderer* renderer, TTF_Font* font);
+
+  /* Sets if the overlay is displayed */
+  static void setOverlayEnabled(bool enabled);
+
+  /* Frees the overlay text */
+  static void unloadOverlay();
+};
+
+/* Scoped profiling zone - records the time from construction to destruction
+ * (or to an earlier stop() call) */
+class ProfileScope : public Timer
+{
+public:
+  ProfileScope(ProfileZone zone) : Timer(), zone{zone}, stopped{false} {};
+  ~ProfileScope()
+  {
+    stop();
+  }
+  void stop()
+  {
+    if(!stopped)
+      Profiler::record(zone, elapsedMicro());
+    stopped = true;
+  }
+
+private:
+  ProfileZone zone;
+  bool stopped;
+};
+
+#endif // PROFILER_H
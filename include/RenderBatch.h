@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Class Name: RenderBatch
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Batch of textured quads, submitted with one SDL_RenderGeometry
+ *              call per texture. Frames packed in the texture atlas add their
+ *              quads here in place of a copy each, so a layer of tiles costs
+ *              one draw call per atlas page.
+ *
+ * Notes
+ * -----
+ * [1]: The quads of one texture are drawn in the order added, but the order
+ *      between textures is not kept. Only quads that do not overlap (such as
+ *      one layer of tiles) can share a batch.
+ * [2]: The color of a quad modulates the texture (color and alpha mod). The
+ *      texture color and alpha mod are reset when the batch is submitted.
+ ******************************************************************************/
+#ifndef RENDERBATCH_H
+#define RENDERBATCH_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+/* Quads of one texture */
+struct BatchGroup
+{
+  SDL_Texture* texture;
+  int texture_height;
+  int texture_width;
+  std::vector<int> indices;
+  std::vector<SDL_Vertex> vertices;
+};
+
+class RenderBatch
+{
+public:
+  /* Constructor function */
+  RenderBatch();
+
+private:
+  /* The groups, by texture. Only the first groups_used are in the batch, the
+   * rest keep their allocations for the next batch */
+  std::vector<BatchGroup> groups;
+  uint32_t groups_used;
+
+  /* Number of quads in the batch */
+  uint32_t quads;
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Adds a quad of the source rect of the texture */
+  void addQuad(SDL_Texture* texture, const SDL_Rect& src,
+               const SDL_Rect& dest, SDL_Color color,
+               SDL_RendererFlip flip = SDL_FLIP_NONE);
+
+  /* Submits the quads, one draw call per texture, and empties the batch */
+  bool flush(SDL_Renderer* renderer);
+
+  /* Returns the number of quads in the batch */
+  uint32_t getQuadCount() const;
+};
+
+#endif // RENDERBATCH_H
@@ -66,7 +66,7 @@ public:
   bool isSoundSet(uint32_t id);
 
   /* Load data from file */
-  bool load(XmlData data, int index, std::string base_path);
+  bool load(const XmlData& data, int index, std::string base_path);
 
   /* Process the queue */
   void process();
@@ -13,6 +13,8 @@
 #define SPRITE_H
 
 #include <iostream>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "Helpers.h"
@@ -73,6 +75,9 @@ public:
     HALFCIRCLE
   };
 
+  /* The core table cache reads and restores the fields directly */
+  friend class GameTables;
+
 private:
   /* Time to complete animation */
   uint16_t animation_time;
@@ -150,6 +155,10 @@ private:
   const static double kMAX_BRIGHTNESS;  /* The max brightness value */
   const static int32_t kUNSET_SOUND_ID; /* The unset ID sound */
 
+  /*------------------- Static Members -----------------------*/
+  /* The sprites with frames pending decode, while deferred loading is on */
+  static std::unordered_set<Sprite*> pending_sprites;
+
 public:
   /*------------------- Public Constants -----------------------*/
   const static uint16_t kDEFAULT_ANIMATE_TIME; /* The default animation time */
@@ -163,6 +172,9 @@ private:
   /* Returns the angle, if one exists in the list of modifications */
   uint16_t parseAdjustments(std::vector<std::string> adjustments);
 
+  /* Unlinks the frames whose deferred decode failed, mapped to the next */
+  void removeFailed(std::unordered_map<Frame*, Frame*>& removed);
+
   /* Sets the color modification with the texture */
   void setColorMod();
 
@@ -177,9 +189,9 @@ protected:
   /*========================= PUBLIC FUNCTIONS ===============================*/
 public:
   /* Adds sprite information from the XML data classifier from the file */
-  bool addFileInformation(XmlData data, int index, SDL_Renderer* renderer,
-                          std::string base_path = "", bool no_warnings = false,
-                          bool build_data = true);
+  bool addFileInformation(const XmlData& data, int index,
+                          SDL_Renderer* renderer, std::string base_path = "",
+                          bool no_warnings = false, bool build_data = true);
 
   /* Creates a texture for a sprite (for Pleps) */
   void createTexture(SDL_Renderer* renderer);
@@ -303,6 +315,10 @@ public:
   bool render(SDL_Renderer* renderer, int x = 0, int y = 0, int w = 0,
               int h = 0);
 
+  /* Adds the sprite to the batch if it can be batched, else renders it */
+  bool renderBatch(RenderBatch& batch, SDL_Renderer* renderer, int x, int y,
+                   int w, int h);
+
   /* Take the temp. stored color balance values and restore them */
   void revertColorBalance();
 
@@ -394,6 +410,11 @@ public:
   /* Returns the degrees of the angle enumerator */
   static int getAngle(RotatedAngle angle);
 
+  /* Deferred loading: wraps the frame deferred load and drops the frames
+   * which failed to decode from their sprites at the end */
+  static void beginDeferredLoad();
+  static void endDeferredLoad();
+
   /* ========================= OPERATOR FUNCTIONS =========================== */
 public:
   Sprite& operator=(const Sprite& source);
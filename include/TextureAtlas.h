@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Class Name: TextureAtlas
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Packing of small frame images into large shared textures
+ *              (pages). Tile sized images loaded with the map are copied into
+ *              a page in shelf order, and the frame renders its rect of the
+ *              page in place of owning a texture. Each page has a greyscale
+ *              twin with the same layout for the greyscale duplicates.
+ *
+ * Notes
+ * -----
+ * [1]: Regions are not reused: a page is destroyed once all of its regions
+ *      are released, which happens when the map is unloaded.
+ * [2]: Regions are padded by a transparent pixel so scaled rendering does not
+ *      bleed the neighbouring image into the edges.
+ * [3]: Pages must only be changed from the render thread.
+ ******************************************************************************/
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+/* One atlas texture and its greyscale twin, packed in shelves */
+struct AtlasPage
+{
+  SDL_Renderer* renderer;
+  SDL_Texture* texture;
+  SDL_Texture* texture_grey;
+  int shelf_x;
+  int shelf_y;
+  int shelf_height;
+  uint32_t regions;
+};
+
+class TextureAtlas
+{
+private:
+  /* All live pages */
+  static std::vector<AtlasPage> pages;
+
+  /*------------------- Constants -----------------------*/
+  const static int kMAX_IMAGE;     /* Largest image side packed, in pixels */
+  const static int kPADDING;       /* Gap between the regions, in pixels */
+  const static int kPAGE_SIZE;     /* Side of a page, in pixels */
+  const static uint32_t kFORMAT;   /* Pixel format of the pages */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Copies the surface into the page texture at the rect */
+  static bool copySurface(SDL_Texture* texture, SDL_Surface* surface,
+                          const SDL_Rect& rect);
+
+  /* Creates a page texture */
+  static SDL_Texture* createPage(SDL_Renderer* renderer);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Packs the image, and its greyscale duplicate, into a page */
+  static bool add(SDL_Renderer* renderer, SDL_Surface* surface,
+                  SDL_Surface* surface_grey, SDL_Rect& rect,
+                  SDL_Texture*& texture, SDL_Texture*& texture_grey);
+
+  /* Returns the number of live pages */
+  static uint32_t getPageCount();
+
+  /* Releases a region of the page texture */
+  static void release(SDL_Texture* texture);
+};
+
+#endif // TEXTUREATLAS_H
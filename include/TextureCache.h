@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Class Name: TextureCache
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Shared, reference counted frame textures. Frames that load the
+ *              same image (path, rotation angle and greyscale option) with the
+ *              same renderer share one texture and its greyscale duplicate, so
+ *              each image is decoded and uploaded once. The textures are
+ *              destroyed when the last frame releases them.
+ *
+ * Notes
+ * -----
+ * [1]: Flip adjustments are applied when rendering and are not part of the
+ *      key. Frames sharing a texture set their alpha before each render.
+ * [2]: An image packed in the texture atlas is a rect of a page texture. The
+ *      region is released to the atlas in place of destroying the texture.
+ * [3]: Textures must only be acquired and released from the render thread.
+ ******************************************************************************/
+#ifndef TEXTURECACHE_H
+#define TEXTURECACHE_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/* Shared textures of one image */
+struct TextureCacheEntry
+{
+  SDL_Texture* texture;
+  SDL_Texture* texture_grey;
+  int width;
+  int height;
+  SDL_Rect rect;
+  bool rect_valid;
+  uint32_t references;
+};
+
+class TextureCache
+{
+private:
+  /* All shared images, by key */
+  static std::unordered_map<std::string, TextureCacheEntry> entries;
+
+  /* Number of loads served from the cache */
+  static uint64_t hits;
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Takes a reference to the textures of the image, if shared */
+  static bool acquire(const std::string& key, TextureCacheEntry& entry);
+
+  /* Adds the textures of a loaded image, with one reference */
+  static void add(const std::string& key, const TextureCacheEntry& entry);
+
+  /* Returns the number of shared images */
+  static uint32_t getCount();
+
+  /* Returns the number of loads served from the cache */
+  static uint64_t getHits();
+
+  /* Returns the key of an image */
+  static std::string getKey(SDL_Renderer* renderer, const std::string& path,
+                            uint16_t angle, bool enable_greyscale);
+
+  /* Drops a reference to the textures of the image */
+  static bool release(const std::string& key);
+};
+
+#endif // TEXTURECACHE_H
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Class Name: TextureRegistry
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Accounting of every SDL_Texture created by the engine. Textures
+ *              are created and destroyed through the registry, which records
+ *              the dimensions, estimated bytes, source (frame, greyscale
+ *              duplicate, sprite render target, text, ad-hoc build, atlas
+ *              page or map tile chunk) and the owning view (title, map,
+ *              battle, menu) of each. Totals are available to the profiler
+ *              overlay and the full set can be dumped to a CSV file.
+ *
+ * Notes
+ * -----
+ * [1]: The owner is the view that was active when the texture was created,
+ *      as set by setOwner() from the application and game views.
+ * [2]: Bytes are estimated from the pixel format (width * height * bytes per
+ *      pixel). Driver padding and mipmaps are not included.
+ * [3]: Textures must only be created and destroyed from the render thread.
+ ******************************************************************************/
+#ifndef TEXTUREREGISTRY_H
+#define TEXTUREREGISTRY_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <unordered_map>
+
+/* Owning view of a texture. COUNT must remain last */
+enum class TextureOwner : uint8_t
+{
+  GENERAL = 0,
+  TITLE = 1,
+  MAP = 2,
+  BATTLE = 3,
+  MENU = 4,
+  COUNT = 5
+};
+
+/* Source of a texture. COUNT must remain last */
+enum class TextureSource : uint8_t
+{
+  FRAME = 0,
+  FRAME_GREY = 1,
+  SPRITE_TARGET = 2,
+  TEXT = 3,
+  BUILD = 4,
+  ATLAS = 5,
+  CHUNK = 6,
+  COUNT = 7
+};
+
+/* Registered texture information */
+struct TextureEntry
+{
+  int width;
+  int height;
+  uint32_t bytes;
+  TextureOwner owner;
+  TextureSource source;
+};
+
+class TextureRegistry
+{
+private:
+  /* Owner that is assigned to newly created textures */
+  static TextureOwner owner;
+
+  /* All live textures */
+  static std::unordered_map<SDL_Texture*, TextureEntry> textures;
+
+  /* Total estimated bytes of all live textures */
+  static uint64_t total_bytes;
+
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kOWNER_COUNT;  /* Number of texture owners */
+  const static uint32_t kSOURCE_COUNT; /* Number of texture sources */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Registers a created texture */
+  static SDL_Texture* add(SDL_Texture* texture, TextureSource source);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Creates a registered texture, in place of SDL_CreateTexture() */
+  static SDL_Texture* create(SDL_Renderer* renderer, uint32_t format,
+                             int access, int w, int h,
+                             TextureSource source = TextureSource::BUILD);
+
+  /* Creates a registered texture, in place of SDL_CreateTextureFromSurface */
+  static SDL_Texture* createFromSurface(SDL_Renderer* renderer,
+                                        SDL_Surface* surface,
+                                        TextureSource source);
+
+  /* Destroys a texture and removes it, in place of SDL_DestroyTexture() */
+  static void destroy(SDL_Texture* texture);
+
+  /* Dumps the totals and all live textures to a CSV file */
+  static bool dump(std::string path);
+
+  /* Returns the estimated bytes of live textures (total, by owner, source) */
+  static uint64_t getBytes();
+  static uint64_t getBytes(TextureOwner owner);
+  static uint64_t getBytes(TextureSource source);
+
+  /* Returns the number of live textures */
+  static uint32_t getCount();
+
+  /* Returns the owner that is assigned to newly created textures */
+  static TextureOwner getOwner();
+
+  /* Returns the display names of the owner and source */
+  static std::string getOwnerName(TextureOwner owner);
+  static std::string getSourceName(TextureSource source);
+
+  /* Sets the owner that is assigned to newly created textures */
+  static void setOwner(TextureOwner owner);
+};
+
+#endif // TEXTUREREGISTRY_H
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Class Name: ThreadPool
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Fixed set of worker threads for CPU bound work off the main
+ *              thread. Tasks can be submitted individually (with a future to
+ *              wait on) or as a parallel loop over an index range, which the
+ *              calling thread also works on until every index is done.
+ *
+ * Notes
+ * -----
+ * [1]: parallelFor() may be called from within a pool task: the caller works
+ *      through the remaining indexes itself, so it never waits on a worker
+ *      that is not already running one of its indexes.
+ * [2]: Tasks must not touch SDL rendering, which is bound to the main thread.
+ ******************************************************************************/
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+  /* Constructor function - 0 threads uses one per core, less the caller */
+  ThreadPool(uint32_t thread_count = 0);
+
+  /* Destructor function - finishes the queued tasks and joins the threads */
+  ~ThreadPool();
+
+private:
+  /* Signals the workers of new tasks or the stop */
+  std::condition_variable condition;
+  std::mutex mutex;
+
+  /* Is the pool stopping */
+  bool stopping;
+
+  /* Queued tasks */
+  std::deque<std::function<void()>> tasks;
+
+  /* Worker threads */
+  std::vector<std::thread> threads;
+
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kMAX_THREADS; /* Maximum worker threads */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Queues a task for the workers */
+  void enqueue(std::function<void()> task);
+
+  /* Worker thread loop */
+  void work();
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Returns the number of worker threads */
+  uint32_t getThreadCount();
+
+  /* Runs the task for every index in [0, count), returning once all are
+   * done. The calling thread works on the indexes as well */
+  void parallelFor(uint32_t count, std::function<void(uint32_t)> task);
+
+  /* Queues a task, returning a future that is ready once it has run */
+  std::future<void> submit(std::function<void()> task);
+
+  /*===================== PUBLIC STATIC FUNCTIONS ============================*/
+public:
+  /* Returns the pool shared by the engine */
+  static ThreadPool& getShared();
+};
+
+#endif // THREADPOOL_H
@@ -9,8 +9,11 @@
 #define XMLDATA_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "EnumDb.h"
+
 class XmlData
 {
 public:
@@ -26,6 +29,9 @@ public:
   /* Destructor function */
   ~XmlData();
 
+  /* The streamed XML leaves fill the stacks in place */
+  friend class XmlLeaf;
+
   /* Public Enumerators */
   enum DataType {BOOLEAN = 1,
                  INTEGER = 2,
@@ -39,6 +45,9 @@ private:
   std::vector<std::string> key;
   std::vector<std::string> value;
 
+  /* Interned token of each element, for dispatch without string compares */
+  std::vector<XmlToken> token;
+
   /* The data from the XML */
   DataType data_type;
   bool bool_data;
@@ -73,34 +82,40 @@ public:
   void flipElements();
 
   /* Get data calls - success holds if the data is actually set in the class */
-  std::string getData(bool* success = nullptr);
-  bool getDataBool(bool* success = nullptr);
-  float getDataFloat(bool* success = nullptr);
-  int getDataInteger(bool* success = nullptr);
-  std::string getDataString(bool* success = nullptr);
+  std::string getData(bool* success = nullptr) const;
+  bool getDataBool(bool* success = nullptr) const;
+  float getDataFloat(bool* success = nullptr) const;
+  int getDataInteger(bool* success = nullptr) const;
+  std::string getDataString(bool* success = nullptr) const;
 
   /* Returns the data type */
-  DataType getDataType();
+  DataType getDataType() const;
 
   /* Element handling */
-  std::vector<std::string> getAllElements();
-  std::vector<std::string> getAllKeys();
-  std::vector<std::string> getAllKeyValues();
-  std::string getElement(uint16_t index);
-  std::string getKey(uint16_t index);
-  std::string getKeyValue(uint16_t index);
-  int getNumElements();
-  std::vector<std::string> getTailElements(uint16_t index);
+  std::vector<std::string> getAllElements() const;
+  std::vector<std::string> getAllKeys() const;
+  std::vector<std::string> getAllKeyValues() const;
+  std::string getElement(uint16_t index) const;
+  XmlToken getElementToken(uint16_t index) const;
+  std::string getKey(uint16_t index) const;
+  std::string getKeyValue(uint16_t index) const;
+  int getNumElements() const;
+  std::vector<std::string> getTailElements(uint16_t index) const;
 
   /* Determine the type of the data */
-  bool isDataBool();
-  bool isDataFloat();
-  bool isDataInteger();
-  bool isDataString();
-  bool isDataUnset();
+  bool isDataBool() const;
+  bool isDataFloat() const;
+  bool isDataInteger() const;
+  bool isDataString() const;
+  bool isDataUnset() const;
 
   /* Delete last element - clears data */
   bool removeLastElement();
+
+/*===================== PUBLIC STATIC FUNCTIONS ============================*/
+public:
+  /* Returns the interned token of the element name. UNKNOWN if not interned */
+  static XmlToken tokenize(std::string_view element);
 };
 
 #endif // XMLDATA_H
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Class Name: XmlStream
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Streaming reader of the game XML files. The source buffer is
+ *              scanned once from the start and every data leaf (the text
+ *              within an element) is handed to a visitor as a view: the text
+ *              and the stack of open elements, each with its first attribute,
+ *              as string views into the source. No document tree is built and
+ *              nothing is copied per leaf unless it holds an entity.
+ *              Element names are interned as each element opens, so leaves
+ *              carry the tokens of their stack at no extra cost.
+ *
+ * Notes
+ * -----
+ * [1]: The leaves match FileHandler::readXmlData() over the tinyxml2 document:
+ *      whitespace only text between elements is skipped, other text is kept
+ *      with its whitespace, CDATA sections are text and the standard and
+ *      numeric entities are decoded.
+ * [2]: A leaf and its views are only valid during the visitor call.
+ * [3]: sections() splits a document into the direct children of its root
+ *      element as raw text, so they can be moved elsewhere byte for byte.
+ ******************************************************************************/
+#ifndef XMLSTREAM_H
+#define XMLSTREAM_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "XmlData.h"
+
+/* One open element of the stack, with its first attribute and its token */
+struct XmlElementView
+{
+  std::string_view element;
+  std::string_view key;
+  std::string_view value;
+  XmlToken token;
+};
+
+/* One direct child of the root element, with its raw text. The text runs
+ * from the start of the line it opens on to the end of the line it closes on,
+ * when nothing else shares those lines. The first attribute value is decoded */
+struct XmlSectionView
+{
+  std::string_view element;
+  std::string value;
+  std::string_view text;
+};
+
+/* One data leaf - the element stack and the text within the last element */
+class XmlLeaf
+{
+public:
+  /* Constructor function */
+  XmlLeaf(const std::vector<XmlElementView>& elements, std::string_view text);
+
+private:
+  /* The open elements, from the root */
+  const std::vector<XmlElementView>& elements;
+
+  /* The text of the leaf */
+  std::string_view text;
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Element stack access by depth. Empty if the depth is out of range */
+  std::string_view getElement(uint32_t index) const;
+  XmlToken getElementToken(uint32_t index) const;
+  std::string_view getKey(uint32_t index) const;
+  std::string_view getKeyValue(uint32_t index) const;
+
+  /* Returns the number of elements in the stack */
+  uint32_t getNumElements() const;
+
+  /* Returns the text of the leaf */
+  std::string_view getText() const;
+
+  /* Fills the XmlData with the leaf, reusing its existing strings */
+  bool toXmlData(XmlData& data) const;
+};
+
+class XmlStream
+{
+private:
+  /*------------------- Constants -----------------------*/
+  const static std::string kWHITESPACE; /* Characters skipped between nodes */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Decodes the entities of the view into the scratch string, if any */
+  static std::string_view decode(std::string_view view, std::string& scratch);
+
+  /*===================== PUBLIC STATIC FUNCTIONS ============================*/
+public:
+  /* Parses the source, calling the visitor for each leaf in document order.
+   * The visitor returns false to stop early, which is not a failure */
+  static bool parse(std::string_view source,
+                    const std::function<bool(const XmlLeaf&)>& visitor);
+
+  /* Splits the children of the root element into raw sections, in order */
+  static bool sections(std::string_view source, std::string_view root,
+                       std::vector<XmlSectionView>& sections);
+};
+
+#endif // XMLSTREAM_H
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * Class Name: Xxtea
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Block oriented XXTEA engine for the file encryption. A line is
+ *              a contiguous span of 32 bit words that is encrypted in place
+ *              with a sliding window of four words (wrapping at the end of
+ *              the line), so no intermediate arrays are allocated. Lines of
+ *              the same length are independent, so they can also be
+ *              decrypted several at once in vector lanes.
+ *
+ * Notes
+ * -----
+ * [1]: The lanes use the GCC/Clang vector extensions: 8 lanes when built
+ *      with AVX2, otherwise 4 (SSE2, or scalar code on other targets).
+ * [2]: The window order and rounds match the original FileHandler line
+ *      encryption, so existing encrypted files remain readable.
+ ******************************************************************************/
+#ifndef XXTEA_H
+#define XXTEA_H
+
+#include <cstdint>
+
+class Xxtea
+{
+private:
+  /*------------------- Constants -----------------------*/
+  const static uint32_t kDELTA;  /* Sum bias for encryption */
+  const static uint32_t kKEY[];  /* Key array for encryption */
+  const static uint32_t kROUNDS; /* Number of rounds for encryption */
+  const static uint32_t kWINDOW; /* Words in one encryption window */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Decrypts and encrypts one window of words (or vector lanes) in place */
+  template <typename T> static void decryptWindow(T* data);
+  template <typename T> static void encryptWindow(T* data);
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Number of lines that decryptLanes() processes at once */
+  const static uint32_t kLANES;
+
+  /* Decrypts a line of words in place */
+  static bool decrypt(uint32_t* data, uint32_t length);
+
+  /* Decrypts up to kLANES lines of the same length in place, together */
+  static bool decryptLanes(uint32_t** lines, uint32_t count, uint32_t length);
+
+  /* Encrypts a line of words in place */
+  static bool encrypt(uint32_t* data, uint32_t length);
+
+  /* Returns the minimum number of words in a line */
+  static uint32_t getMinLength();
+};
+
+#endif // XXTEA_H
@@ -8,11 +8,16 @@
  *              the screen.
  ******************************************************************************/
 #include "Application.h"
+#include "AssetPack.h"
 
 /* Constant Implementation - see header file for descriptions */
 const std::string Application::kLOADING_SCREEN = "assets/images/backgrounds/loading.png";
 const std::string Application::kLOGO_ICON = "assets/images/icon.png";
 const bool Application::kPATH_ENCRYPTED = false;
+const uint8_t Application::kFRAME_TICKS_MAX = 5;
+const uint16_t Application::kFRAME_TIME_MAX = 250;
+const uint8_t Application::kLIMIT_SPIN = 2;
+const std::string Application::kTEXTURE_DUMP = "textures.csv";
 const uint8_t Application::kUPDATE_CHANGE_LIMIT = 5;
 const uint8_t Application::kUPDATE_RATE = 32;
 
@@ -30,7 +35,9 @@ Application::Application(std::string base_path, std::string app_path,
   this->app_path = app_path;
   this->app_directory = Helpers::getParentDirectory(app_path);
   this->app_map = app_map;
+  benchmark = nullptr;
   initialized = false;
+  key_recorder = nullptr;
   renderer = NULL;
   window = NULL;
 
@@ -130,6 +137,22 @@ void Application::displayLoadingFrame()
   SDL_RenderPresent(renderer);
 }
 
+/* Returns the benchmark scene name of the running view. Empty if none */
+std::string Application::getBenchmarkScene()
+{
+  if(mode == GAME && mode_next == NONE)
+  {
+    if(game_handler->getMode() == Game::MAP)
+      return "map";
+    else if(game_handler->getMode() == Game::BATTLE)
+      return "battle";
+    else if(game_handler->getMode() == Game::MENU)
+      return "menu";
+  }
+
+  return "";
+}
+
 /* Goes through all available events that are currently on the stack */
 void Application::handleEvents()
 {
@@ -140,6 +163,22 @@ void Application::handleEvents()
 
   while(SDL_PollEvent(&event) != 0)
   {
+    /* Key recorder: record key events against the tick. On replay, only the
+     * injected key events (no window) are handled */
+    if(key_recorder != nullptr &&
+       (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP))
+    {
+      if(key_recorder->getMode() == RecordMode::REPLAYING)
+      {
+        if(event.key.windowID != 0)
+          continue;
+      }
+      else
+      {
+        key_recorder->recordEvent(event.key);
+      }
+    }
+
     /* If quit initialized, end the game loop */
     if(event.type == SDL_QUIT)
     {
@@ -199,6 +238,13 @@ void Application::handleEvents()
       }
 #endif
 
+      /* -- Profiler overlay toggle -- */
+      if(event.key.keysym.sym == SDLK_F9)
+        Profiler::setOverlayEnabled(!Profiler::isOverlayEnabled());
+      /* -- Texture registry dump -- */
+      else if(event.key.keysym.sym == SDLK_F12)
+        TextureRegistry::dump(kTEXTURE_DUMP);
+
       /* Send the key to the relevant view */
       if(mode == TITLESCREEN)
       {
@@ -233,6 +279,29 @@ void Application::handleEvents()
   }
 }
 
+/* Limits the frame rate to the configured limit, if VSync is not enabled */
+void Application::limitFrame(uint64_t frame_start)
+{
+  uint32_t limit = system_options->getFrameLimit();
+
+  if(!system_options->isVsyncEnabled() && limit > 0)
+  {
+    uint64_t counter_freq = SDL_GetPerformanceFrequency();
+    uint64_t frame_end = frame_start + counter_freq / limit;
+    uint64_t now = SDL_GetPerformanceCounter();
+
+    /* Sleep off most of the remaining time, then spin for the precision */
+    if(frame_end > now)
+    {
+      uint32_t remaining = (frame_end - now) * 1000 / counter_freq;
+      if(remaining > kLIMIT_SPIN)
+        SDL_Delay(remaining - kLIMIT_SPIN);
+      while(SDL_GetPerformanceCounter() < frame_end)
+        ;
+    }
+  }
+}
+
 /* Load */
 bool Application::load()
 {
@@ -271,11 +340,11 @@ bool Application::load()
       success &= read_success;
 
       /* Only proceed if defined for core application */
-      if(data.getElement(index) == "app")
+      if(data.getElementToken(index) == XmlToken::APP)
       {
         /* Sounds */
-        if(data.getElement(index + 1) == "music" ||
-           data.getElement(index + 1) == "sound")
+        if(data.getElementToken(index + 1) == XmlToken::MUSIC ||
+           data.getElementToken(index + 1) == XmlToken::SOUND)
         {
           sound_handler.load(data, index + 1, app_directory);
         }
@@ -313,9 +382,12 @@ bool Application::load()
 /* Renders the current view and all relevant visual data */
 void Application::render(uint32_t cycle_time)
 {
+  ProfileScope zone_scope(ProfileZone::APP_RENDER);
+
   /* Handle the individual action items, depending on whats running */
   if(mode == TITLESCREEN)
   {
+    TextureRegistry::setOwner(TextureOwner::TITLE);
     title_screen.render(renderer, key_handler);
   }
   else if(mode == GAME)
@@ -336,6 +408,11 @@ void Application::render(uint32_t cycle_time)
   {
     cycle_time = cycle_time;
   }
+
+  /* Profiler overlay, on top of the frame */
+  zone_scope.stop();
+  Profiler::renderOverlay(renderer,
+                          system_options->getFontTTF(FontName::M_STANDARD));
 }
 
 /* Revert to temporary mode */
@@ -361,6 +438,7 @@ void Application::uninitialize()
   if(renderer != NULL)
   {
     Helpers::deleteMasks();
+    Profiler::unloadOverlay();
     SDL_DestroyRenderer(renderer);
   }
   renderer = NULL;
@@ -432,6 +510,7 @@ int Application::updateCycleTime(int cycle_time)
 /* Handles actions in views, depending on what's active */
 bool Application::updateViews(int cycle_time)
 {
+  ProfileScope zone_scope(ProfileZone::APP_UPDATE);
   bool quit = false;
 
   /* Update the key handler */
@@ -458,6 +537,8 @@ bool Application::updateViews(int cycle_time)
   /* Handle any appropriate actions of the individual views */
   if(mode == TITLESCREEN)
   {
+    TextureRegistry::setOwner(TextureOwner::TITLE);
+
     /* Update the title screen, which returns if an action is available */
     if(title_screen.update(cycle_time, key_handler))
     {
@@ -566,7 +647,7 @@ bool Application::initialize()
     else
     {
       std::string icon_path = system_options->getBasePath() + kLOGO_ICON;
-      SDL_Surface* surface = IMG_Load(icon_path.c_str());
+      SDL_Surface* surface = AssetPack::loadImage(icon_path);
       SDL_SetWindowIcon(window, surface);
     }
   }
@@ -578,6 +659,8 @@ bool Application::initialize()
     uint32_t flags = SDL_RENDERER_ACCELERATED;
     if(system_options->isVsyncEnabled())
       flags |= SDL_RENDERER_PRESENTVSYNC;
+    if(benchmark != nullptr)
+      flags = SDL_RENDERER_SOFTWARE;
 
 #ifdef _WIN32_OPENGL
     /* Force OpenGL to be used as the rendering driver if there are more than
@@ -695,10 +778,11 @@ bool Application::isInitialized()
 /* Runs the application */
 bool Application::run(bool skip_title)
 {
-  uint32_t count = 1;
-  uint32_t cycle_time = kUPDATE_RATE;
+  double accumulator = 0.0;
+  uint64_t counter_freq = SDL_GetPerformanceFrequency();
+  uint64_t counter_last = SDL_GetPerformanceCounter();
   bool quit = false;
-  uint32_t ticks = 0;
+  double tick_carry = 0.0;
 
   if(isInitialized())
   {
@@ -709,56 +793,105 @@ bool Application::run(bool skip_title)
     /* Main application loop */
     while(!quit)
     {
-      /* Determine the previous cycle time for using throughout the update
-       * sequence for rendering */
-      uint32_t new_ticks = SDL_GetTicks();
-      if(new_ticks > ticks + 200)
+      uint64_t frame_start = SDL_GetPerformanceCounter();
+      double tick_ms = 1000.0 / system_options->getTickRate();
+
+      /* Accumulate the real time since the last frame. Long stalls (loading,
+       * window drags) are clamped so the simulation does not spiral */
+      double frame_ms = (frame_start - counter_last) * 1000.0 / counter_freq;
+      counter_last = frame_start;
+      accumulator += std::min(frame_ms, static_cast<double>(kFRAME_TIME_MAX));
+
+      /* Replay: one tick per frame and the recorded input for the tick */
+      bool replay = (key_recorder != nullptr &&
+                     key_recorder->getMode() == RecordMode::REPLAYING);
+      if(replay)
       {
-        cycle_time = 200 / count;
-
-        // // TODO: Cycle fix hack!
-        // if(cycle_time > 33)
-        //   cycle_time = 16;
-
-        count = 0;
-        ticks = new_ticks;
+        accumulator = tick_ms;
+        for(auto& key_event : key_recorder->getEvents())
+          key_handler.injectEvent(key_event);
       }
 
-      // std::cout << cycle_time << std::endl;
-      // cycle_time = new_ticks - ticks;
-      // ticks = new_ticks;
-      // if(system_options->isVsyncEnabled())
-      //  cycle_time = updateCycleTime(cycle_time);
+      /* Benchmark: one tick per frame and scripted input for the frame */
+      std::string bench_scene = "";
+      if(benchmark != nullptr)
+      {
+        accumulator = tick_ms;
+        bench_scene = getBenchmarkScene();
+        if(!bench_scene.empty() && !replay)
+          for(auto& bench_key : benchmark->getScriptKeys())
+            key_handler.injectEvent(bench_key.keycode, bench_key.pressed);
+      }
 
       /* Handle events - key press, window events, and such */
       handleEvents();
 
-      /* Update the view control (moving sprites, players, etc.)
-       * This returns true if the application should shut down */
-      if(updateViews(cycle_time))
-        quit = true;
+      /* Update the view control (moving sprites, players, etc.) in fixed
+       * ticks. This returns true if the application should shut down */
+      Timer frame_timer;
+      uint8_t ticks = 0;
+      while(accumulator >= tick_ms && !quit)
+      {
+        /* Whole ms cycle time, with the remainder carried to the next tick */
+        tick_carry += tick_ms;
+        int cycle_time = static_cast<int>(tick_carry);
+        tick_carry -= cycle_time;
+
+        if(updateViews(cycle_time))
+          quit = true;
+        accumulator -= tick_ms;
+        if(key_recorder != nullptr)
+          key_recorder->addTick();
+
+        /* Drop the backlog if the updates can not keep up */
+        if(++ticks >= kFRAME_TICKS_MAX)
+          accumulator = std::fmod(accumulator, tick_ms);
+      }
+      double update_ms = frame_timer.elapsed() * 1000.0;
+
+      /* Interpolate the render between the last tick and the next */
+      game_handler->setRenderAlpha(accumulator / tick_ms);
 
       /* Play through sound queue */
       sound_handler.process();
 
       /* Clear screen */
+      frame_timer.reset();
       if(mode != PAUSED)
       {
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
 
         /* Render the application view */
-        render(cycle_time);
+        render(static_cast<uint32_t>(tick_ms));
 
         /* Update screen */
         SDL_RenderPresent(renderer);
       }
+      double render_ms = frame_timer.elapsed() * 1000.0;
+
+      Profiler::frameEnd();
 
-      count++;
+      /* Replay: finish once all of the recorded ticks have run */
+      if(replay && key_recorder->isComplete())
+        quit = true;
 
-      /* Delay if VSync is not enabled */
-      if(!system_options->isVsyncEnabled())
-        SDL_Delay(12);
+      /* Benchmark: record the frame and finish once all are recorded */
+      if(benchmark != nullptr)
+      {
+        if(!bench_scene.empty())
+          benchmark->addFrame(bench_scene, update_ms, render_ms);
+        if(benchmark->isComplete() || quit)
+        {
+          benchmark->write();
+          quit = true;
+        }
+      }
+      /* Limit the frame rate if VSync is not enabled. Replays run unlimited */
+      else if(!replay)
+      {
+        limitFrame(frame_start);
+      }
     }
 
     return true;
@@ -766,6 +899,32 @@ bool Application::run(bool skip_title)
   return false;
 }
 
+/* Sets the benchmark to record frames into. Runs headless until complete */
+void Application::setBenchmark(Benchmark* benchmark)
+{
+  this->benchmark = benchmark;
+  key_handler.setInjection(benchmark != nullptr);
+}
+
+/* Sets the key recorder. Replays run at the recorded tick rate with the
+ * injected key state */
+void Application::setKeyRecorder(KeyRecorder* key_recorder)
+{
+  this->key_recorder = key_recorder;
+  if(key_recorder != nullptr)
+  {
+    if(key_recorder->getMode() == RecordMode::REPLAYING)
+    {
+      system_options->setTickRate(key_recorder->getTickRate());
+      key_handler.setInjection(true);
+    }
+    else
+    {
+      key_recorder->setTickRate(system_options->getTickRate());
+    }
+  }
+}
+
 /* Sets the application path */
 void Application::setPath(std::string path, int level, bool skip_title)
 {
@@ -0,0 +1,430 @@
+/*******************************************************************************
+ * Class Name: AssetPack
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Single file archive of the image and audio resources. The
+ *              packer walks the resource directory and stores every image and
+ *              audio file in one file, followed by a table of contents of
+ *              their relative paths. At runtime the pack is mapped once and
+ *              each lookup is handed to SDL_image and SDL_mixer as an
+ *              SDL_RWops over the mapped bytes, in place of opening the loose
+ *              file. Paths not in the pack fall back to the loose file.
+ ******************************************************************************/
+#include "AssetPack.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Constant Implementation - see header file for descriptions */
+const std::vector<std::string> AssetPack::kEXTENSIONS = {
+    ".bmp", ".flac", ".jpg", ".mp3", ".ogg", ".png", ".wav"};
+const uint32_t AssetPack::kHEADER_SIZE = 20;
+const std::string AssetPack::kMAGIC = "FISA";
+const std::string AssetPack::kNAME = "assets.fpk";
+const uint32_t AssetPack::kVERSION = 1;
+
+/* Static Implementation - see header file for descriptions */
+std::unordered_map<std::string, AssetEntry> AssetPack::entries;
+const char* AssetPack::region = nullptr;
+uint64_t AssetPack::region_size = 0;
+std::string AssetPack::region_copy;
+std::string AssetPack::root;
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the key of a resource path in the pack: the normal
+ *              path relative to the root directory, with forward separators.
+ *
+ * Inputs: const std::string& path - the full resource path
+ * Output: std::string - the relative key. Empty if outside the root
+ */
+std::string AssetPack::getKey(const std::string& path)
+{
+  std::string key = getNormalPath(path);
+  if(key.size() <= root.size() || key.compare(0, root.size(), root) != 0)
+    return "";
+
+  return key.substr(root.size());
+}
+
+/*
+ * Description: Returns the path in normal form: backslashes folded to forward
+ *              separators, then duplicate separators, "." and ".." removed
+ *              lexically. Nothing is read from the disk.
+ *
+ * Inputs: const std::string& path - the path
+ * Output: std::string - the normal path
+ */
+std::string AssetPack::getNormalPath(const std::string& path)
+{
+  std::string folded = path;
+  std::replace(folded.begin(), folded.end(), '\\', '/');
+  return std::filesystem::path(folded).lexically_normal().generic_string();
+}
+
+/*
+ * Description: Maps the pack file read only into the region. Where mapping is
+ *              not available, the file is read into memory in one pass.
+ *
+ * Inputs: const std::string& path - the pack file path
+ * Output: bool - true if the region holds the pack
+ */
+bool AssetPack::mapRegion(const std::string& path)
+{
+#ifndef _WIN32
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if(fd < 0)
+    return false;
+
+  struct stat info;
+  void* mapped = MAP_FAILED;
+  if(fstat(fd, &info) == 0 && info.st_size > 0)
+    mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if(mapped == MAP_FAILED)
+    return false;
+  region = static_cast<const char*>(mapped);
+  region_size = info.st_size;
+#else
+  std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+  if(!in.good())
+    return false;
+
+  in.seekg(0, std::ios::end);
+  region_copy.resize(in.tellg());
+  in.seekg(0, std::ios::beg);
+  in.read(&region_copy[0], region_copy.size());
+  if(!in.good() || region_copy.empty())
+  {
+    region_copy.clear();
+    return false;
+  }
+  region = region_copy.data();
+  region_size = region_copy.size();
+#endif
+
+  return true;
+}
+
+/*
+ * Description: Reads a little endian value from the region and moves the
+ *              position past it.
+ *
+ * Inputs: uint64_t& pos - the read position
+ *         uint64_t& value - the read value
+ *         uint8_t bytes - the number of bytes of the value
+ * Output: bool - true if the value was within the region
+ */
+bool AssetPack::takeValue(uint64_t& pos, uint64_t& value, uint8_t bytes)
+{
+  if(pos > region_size || bytes > region_size - pos)
+    return false;
+
+  value = 0;
+  for(uint8_t i = 0; i < bytes; i++)
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(region[pos + i]))
+             << (8 * i);
+  pos += bytes;
+  return true;
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Packs every image and audio file under the resource directory
+ *              into its pack. The files are written in path order, one at a
+ *              time, followed by the table of contents.
+ *
+ * Inputs: std::string directory - the resource directory, ending in a slash
+ * Output: bool - true if the pack was written
+ */
+bool AssetPack::build(std::string directory)
+{
+  namespace fs = std::filesystem;
+  std::vector<std::string> keys;
+  std::error_code error;
+
+  /* Find the packed files, relative to the directory */
+  for(fs::recursive_directory_iterator it(directory, error), end;
+      !error && it != end; it.increment(error))
+  {
+    if(!it->is_regular_file(error))
+      continue;
+
+    std::string extension = it->path().extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   ::tolower);
+    if(std::find(kEXTENSIONS.begin(), kEXTENSIONS.end(), extension) !=
+       kEXTENSIONS.end())
+    {
+      keys.push_back(
+          it->path().lexically_relative(directory).generic_string());
+    }
+  }
+  if(error)
+  {
+    std::cerr << "[ERROR] Asset directory \"" << directory
+              << "\" could not be read: " << error.message() << std::endl;
+    return false;
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::string pack_path = directory + kNAME;
+  std::ofstream out(pack_path.c_str(),
+                    std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!out.good())
+  {
+    std::cerr << "[ERROR] Asset pack \"" << pack_path
+              << "\" could not be opened" << std::endl;
+    return false;
+  }
+
+  /* The header is written once the table of contents offset is known */
+  std::string buffer(kHEADER_SIZE, '\0');
+  out.write(buffer.data(), buffer.size());
+
+  /* Data, with the table of contents built alongside */
+  uint64_t offset = kHEADER_SIZE;
+  std::string toc;
+  auto putValue = [](std::string& buffer, uint64_t value, uint8_t bytes) {
+    for(uint8_t i = 0; i < bytes; i++)
+      buffer += static_cast<char>((value >> (8 * i)) & 0xFF);
+  };
+  for(auto& key : keys)
+  {
+    std::ifstream in((directory + key).c_str(),
+                     std::ios::in | std::ios::binary);
+    buffer.assign(std::istreambuf_iterator<char>(in),
+                  std::istreambuf_iterator<char>());
+    if(in.bad() || key.size() > UINT16_MAX || buffer.size() > UINT32_MAX)
+    {
+      std::cerr << "[ERROR] Asset \"" << key << "\" could not be packed"
+                << std::endl;
+      return false;
+    }
+    out.write(buffer.data(), buffer.size());
+
+    putValue(toc, key.size(), 2);
+    toc += key;
+    putValue(toc, offset, 8);
+    putValue(toc, buffer.size(), 4);
+    offset += buffer.size();
+  }
+  out.write(toc.data(), toc.size());
+
+  /* Header */
+  buffer = kMAGIC;
+  putValue(buffer, kVERSION, 4);
+  putValue(buffer, keys.size(), 4);
+  putValue(buffer, offset, 8);
+  out.seekp(0);
+  out.write(buffer.data(), buffer.size());
+  out.close();
+
+  return out.good();
+}
+
+/*
+ * Description: Unmaps the open pack and clears its table of contents. Any
+ *              stream or music still reading from the pack is invalid after.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void AssetPack::close()
+{
+#ifndef _WIN32
+  if(region != nullptr)
+    munmap(const_cast<char*>(region), region_size);
+#endif
+
+  entries.clear();
+  region = nullptr;
+  region_size = 0;
+  region_copy.clear();
+  region_copy.shrink_to_fit();
+  root = "";
+}
+
+/*
+ * Description: Returns if the resource can be loaded: it is in the open pack
+ *              or is a loose file. Nothing is read.
+ *
+ * Inputs: const std::string& path - the full resource path
+ * Output: bool - true if the resource exists
+ */
+bool AssetPack::exists(const std::string& path)
+{
+  if(region != nullptr && entries.find(getKey(path)) != entries.end())
+    return true;
+
+  std::error_code error;
+  return std::filesystem::is_regular_file(path, error);
+}
+
+/*
+ * Description: Returns the number of packed files of the open pack.
+ *
+ * Inputs: none
+ * Output: uint32_t - the number of files. 0 if no pack is open
+ */
+uint32_t AssetPack::getCount()
+{
+  return entries.size();
+}
+
+/*
+ * Description: Returns if a pack is open.
+ *
+ * Inputs: none
+ * Output: bool - true if a pack is open
+ */
+bool AssetPack::isOpen()
+{
+  return (region != nullptr);
+}
+
+/*
+ * Description: Loads an image surface. A packed image is decoded from the
+ *              pack, any other path from its loose file.
+ *
+ * Inputs: const std::string& path - the full image path
+ * Output: SDL_Surface* - the loaded surface. Null on failure
+ */
+SDL_Surface* AssetPack::loadImage(const std::string& path)
+{
+  SDL_RWops* stream = openFile(path);
+  if(stream != nullptr)
+    return IMG_Load_RW(stream, 1);
+  return IMG_Load(path.c_str());
+}
+
+/*
+ * Description: Loads music. Packed music streams from the pack while it
+ *              plays, any other path from its loose file.
+ *
+ * Inputs: const std::string& path - the full music path
+ * Output: Mix_Music* - the loaded music. Null on failure
+ */
+Mix_Music* AssetPack::loadMusic(const std::string& path)
+{
+  SDL_RWops* stream = openFile(path);
+  if(stream != nullptr)
+    return Mix_LoadMUS_RW(stream, 1);
+  return Mix_LoadMUS(path.c_str());
+}
+
+/*
+ * Description: Loads a WAV sound chunk. A packed sound is decoded from the
+ *              pack, any other path from its loose file.
+ *
+ * Inputs: const std::string& path - the full sound path
+ * Output: Mix_Chunk* - the loaded chunk. Null on failure
+ */
+Mix_Chunk* AssetPack::loadSound(const std::string& path)
+{
+  SDL_RWops* stream = openFile(path);
+  if(stream != nullptr)
+    return Mix_LoadWAV_RW(stream, 1);
+  return Mix_LoadWAV(path.c_str());
+}
+
+/*
+ * Description: Opens the pack of the resource directory and reads its table
+ *              of contents. Without a pack, all resources stay loose files.
+ *
+ * Inputs: std::string directory - the resource directory, ending in a slash
+ * Output: bool - true if a pack is open
+ */
+bool AssetPack::open(std::string directory)
+{
+  close();
+
+  std::string pack_path = directory + kNAME;
+  if(!mapRegion(pack_path))
+    return false;
+
+  /* Header */
+  uint64_t pos = kMAGIC.size();
+  uint64_t version = 0;
+  uint64_t count = 0;
+  uint64_t toc_offset = 0;
+  bool success = region_size >= kHEADER_SIZE &&
+                 std::string(region, kMAGIC.size()) == kMAGIC;
+  success &= takeValue(pos, version, 4) && version == kVERSION;
+  success &= takeValue(pos, count, 4) && takeValue(pos, toc_offset, 8);
+  success &= toc_offset >= kHEADER_SIZE && toc_offset <= region_size;
+
+  /* Table of contents */
+  pos = toc_offset;
+  for(uint64_t i = 0; success && i < count; i++)
+  {
+    uint64_t key_size = 0;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+
+    success &= takeValue(pos, key_size, 2) && key_size <= region_size - pos;
+    if(success)
+    {
+      std::string key(region + pos, key_size);
+      pos += key_size;
+      success &= takeValue(pos, offset, 8) && takeValue(pos, length, 4) &&
+                 offset >= kHEADER_SIZE && offset <= toc_offset &&
+                 length <= toc_offset - offset;
+      if(success)
+        entries[key] = {offset, static_cast<uint32_t>(length)};
+    }
+  }
+
+  if(!success)
+  {
+    std::cerr << "[WARNING] Asset pack \"" << pack_path
+              << "\" is invalid. Using the loose files" << std::endl;
+    close();
+    return false;
+  }
+
+  /* The root in normal form, with a trailing separator. The current
+   * directory is no prefix at all */
+  root = getNormalPath(directory);
+  if(root == ".")
+    root = "";
+  else if(!root.empty() && root.back() != '/')
+    root += '/';
+  return true;
+}
+
+/*
+ * Description: Returns a read stream over the bytes of a packed file. The
+ *              stream is closed by its loader (or SDL_RWclose()).
+ *
+ * Inputs: const std::string& path - the full resource path
+ * Output: SDL_RWops* - the stream. Null if no pack is open or it is not packed
+ */
+SDL_RWops* AssetPack::openFile(const std::string& path)
+{
+  if(region == nullptr)
+    return nullptr;
+
+  auto found = entries.find(getKey(path));
+  if(found == entries.end())
+    return nullptr;
+
+  return SDL_RWFromConstMem(region + found->second.offset,
+                            found->second.length);
+}
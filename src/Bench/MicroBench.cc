@@ -0,0 +1,429 @@
+/*******************************************************************************
+ * Class Name: MicroBench [Implementation]
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Standalone microbenchmarks of the engine primitives that are
+ *              hit millions of times during load and battle: line encryption,
+ *              checksums, XmlData, the Helpers string parsers and the battle
+ *              stat math. Each benchmark is run for a minimum time and reports
+ *              the nanoseconds and heap allocations per operation. No window
+ *              or renderer is created.
+ *
+ * Usage: FISE-microbench-<arch> [name filter] [output csv]
+ *
+ * Notes
+ * -----
+ * [1]: Allocations are counted by replacing the global operator new for this
+ *      executable only.
+ ******************************************************************************/
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Checksum.h"
+#include "FileHandler.h"
+#include "Game/Battle/BattleActor.h"
+#include "Game/Battle/BattleEvent.h"
+#include "Game/Battle/BattleSkill.h"
+#include "Game/Battle/BattleStats.h"
+#include "Game/Player/Action.h"
+#include "Game/Player/AttributeSet.h"
+#include "Game/Player/Category.h"
+#include "Game/Player/Person.h"
+#include "Game/Player/Skill.h"
+#include "Helpers.h"
+#include "Md5.h"
+#include "XmlData.h"
+#include "Xxtea.h"
+
+/*=============================================================================
+ * ALLOCATION COUNTING
+ *============================================================================*/
+
+static std::atomic<uint64_t> alloc_count{0};
+
+void* operator new(std::size_t size)
+{
+  alloc_count.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = std::malloc(size > 0 ? size : 1);
+  if(ptr == nullptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+/*=============================================================================
+ * BENCHMARK RUNNER
+ *============================================================================*/
+
+/* Single benchmark result */
+struct MicroResult
+{
+  std::string name;
+  uint64_t iterations;
+  double ns_op;
+  double allocs_op;
+};
+
+class MicroBench
+{
+public:
+  /* Constructor function */
+  MicroBench(std::string filter) : filter{filter}, sink{0} {};
+
+private:
+  /* Only benchmarks with names containing the filter are run */
+  std::string filter;
+
+  /* Completed results */
+  std::vector<MicroResult> results;
+
+  /* Sink for computed values, so they are not optimized out */
+  volatile uint64_t sink;
+
+  /*------------------- Constants -----------------------*/
+  const static uint64_t kMIN_ITERATIONS; /* Iterations of the first pass */
+  const static double kMIN_TIME_NS;      /* Minimum measured time per run */
+
+  /*======================== PRIVATE FUNCTIONS ===============================*/
+private:
+  /* Runs the operation until the minimum time and records the result */
+  void run(std::string name, std::function<uint64_t()> operation);
+
+  /* Benchmark groups */
+  void runBattle();
+  void runFileHandler();
+  void runHelpers();
+  void runXmlData();
+
+  /*========================= PUBLIC FUNCTIONS ===============================*/
+public:
+  /* Runs all benchmarks matching the filter */
+  void runAll();
+
+  /* Writes the results as CSV */
+  bool write(std::string path);
+};
+
+/* Constant Implementation - see class for descriptions */
+const uint64_t MicroBench::kMIN_ITERATIONS = 16;
+const double MicroBench::kMIN_TIME_NS = 250000000.0;
+
+/*
+ * Description: Runs the operation in passes of doubling iterations until a
+ *              pass takes at least kMIN_TIME_NS, then records the ns and
+ *              allocations per operation of that pass.
+ *
+ * Inputs: std::string name - the benchmark name
+ *         std::function<uint64_t()> operation - one operation. The returned
+ *                                               value is sunk
+ * Output: none
+ */
+void MicroBench::run(std::string name, std::function<uint64_t()> operation)
+{
+  if(!filter.empty() && name.find(filter) == std::string::npos)
+    return;
+
+  uint64_t iterations = kMIN_ITERATIONS;
+  double elapsed = 0.0;
+  uint64_t allocs = 0;
+
+  /* Warm up */
+  sink = sink + operation();
+
+  while(true)
+  {
+    uint64_t alloc_start = alloc_count.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+
+    for(uint64_t i = 0; i < iterations; i++)
+      sink = sink + operation();
+
+    auto end = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+    allocs = alloc_count.load(std::memory_order_relaxed) - alloc_start;
+
+    if(elapsed >= kMIN_TIME_NS)
+      break;
+    iterations *= 2;
+  }
+
+  MicroResult result = {name, iterations, elapsed / iterations,
+                        static_cast<double>(allocs) / iterations};
+  results.push_back(result);
+
+  std::cout << std::left << std::setw(40) << name << std::right
+            << std::setw(12) << iterations << std::fixed
+            << std::setprecision(1) << std::setw(14) << result.ns_op
+            << std::setprecision(2) << std::setw(12) << result.allocs_op
+            << std::endl;
+}
+
+/*
+ * Description: Battle math benchmarks - stat lookups with modifiers,
+ *              AttributeSet arithmetic and the full damage calculation.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MicroBench::runBattle()
+{
+  AttributeSet attr_a(5);
+  AttributeSet attr_b(3);
+
+  run("AttributeSet::operator+=/-=", [&]() -> uint64_t {
+    attr_a += attr_b;
+    attr_a -= attr_b;
+    return attr_a.getStat(Attribute::VITA);
+  });
+  run("AttributeSet copy", [&]() -> uint64_t {
+    AttributeSet copy(attr_a);
+    return copy.getStat(Attribute::PRAG);
+  });
+
+  BattleStats stats(attr_a, attr_a);
+  stats.addModifier(Attribute::PRAG, ModifierType::ADDITIVE, 25.0);
+  stats.addModifier(Attribute::PRAG, ModifierType::MULTIPLICATIVE, 1.2);
+  run("BattleStats::getValue", [&]() -> uint64_t {
+    return stats.getValue(Attribute::PRAG);
+  });
+  run("BattleStats copy", [&]() -> uint64_t {
+    BattleStats copy(stats);
+    return copy.getBaseValue(Attribute::VITA);
+  });
+
+  /* Battle set-up: two persons and a single damage skill */
+  Category battle_class(1, "Bench Class", "Bench", AttributeSet(5),
+                        AttributeSet(50));
+  Category race_class(2, "Bench Race", "Bench", AttributeSet(5),
+                      AttributeSet(50));
+  Person base_user(1, "Bench User", &battle_class, &race_class);
+  Person base_target(2, "Bench Target", &battle_class, &race_class);
+  Person user(&base_user);
+  Person target(&base_target);
+  BattleActor actor_user(&user, 0, 0, true, false);
+  BattleActor actor_target(&target, 1, 0, false, false);
+
+  Action action("100,DAMAGE,,,,,AMOUNT.20,AMOUNT.5,,95");
+  Skill skill(1, "Bench Strike", ActionScope::ONE_ENEMY, &action, 100.0);
+  BattleSkill battle_skill;
+  battle_skill.skill = &skill;
+
+  /* The event caches the target stats per call, so it is rebuilt each op */
+  run("BattleEvent::calcDamage", [&]() -> uint64_t {
+    BattleEvent event(ActionType::SKILL, &actor_user, {&actor_target});
+    event.event_skill = &battle_skill;
+    return event.calcDamage(&actor_target, 1.0);
+  });
+}
+
+/*
+ * Description: FileHandler line encryption, Xxtea and checksum benchmarks.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MicroBench::runFileHandler()
+{
+  std::string line = "<game><map id=\"1\"><main><base index=\"0\">"
+                     "12-14,10,6-2</base></main></map></game>";
+  FileHandler fh;
+
+  /* Line encryption, on in-memory lines without any file I/O */
+  std::string encrypted = fh.encryptLine(line);
+  run("FileHandler::encryptLine", [&]() -> uint64_t {
+    return fh.encryptLine(line).size();
+  });
+  run("FileHandler::decryptLine", [&]() -> uint64_t {
+    return fh.decryptLine(encrypted).size();
+  });
+
+  run("MD5::compute", [&]() -> uint64_t {
+    return MD5::compute(line).size();
+  });
+  run("Checksum::update (MD5)", [&]() -> uint64_t {
+    Checksum check(ChecksumType::MD5);
+    check.update(line);
+    return check.digest().size();
+  });
+  run("Checksum::update (64 bit hash)", [&]() -> uint64_t {
+    Checksum check(ChecksumType::HASH64);
+    check.update(line);
+    return check.hash();
+  });
+
+  /* Block engine - one line of 16 words, and kLANES lines together */
+  std::vector<uint32_t> words(16 * Xxtea::kLANES, 0x5A5A5A5A);
+  std::vector<uint32_t*> lanes;
+  for(uint32_t i = 0; i < Xxtea::kLANES; i++)
+    lanes.push_back(&words[i * 16]);
+  run("Xxtea::decrypt (16 words)", [&]() -> uint64_t {
+    Xxtea::decrypt(words.data(), 16);
+    return words[0];
+  });
+  run("Xxtea::decryptLanes (16 words/lane)", [&]() -> uint64_t {
+    Xxtea::decryptLanes(lanes.data(), Xxtea::kLANES, 16);
+    return words[0];
+  });
+}
+
+/*
+ * Description: Helpers string parsing benchmarks.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MicroBench::runHelpers()
+{
+  std::string csv = "100,DAMAGE,,,,,AMOUNT.20,AMOUNT.5,,95";
+  std::string range = "12-14,10-16";
+  std::string range_set = "12-14,10,6-2,1-31";
+
+  run("Helpers::split", [&]() -> uint64_t {
+    return Helpers::split(csv, ',').size();
+  });
+  run("Helpers::parseRange", [&]() -> uint64_t {
+    uint32_t x_min, x_max, y_min, y_max;
+    Helpers::parseRange(range, x_min, x_max, y_min, y_max);
+    return x_min + x_max + y_min + y_max;
+  });
+  run("Helpers::parseRangeSet", [&]() -> uint64_t {
+    return Helpers::parseRangeSet(range_set).size();
+  });
+  run("Helpers::splitView", [&]() -> uint64_t {
+    std::string_view tokens[16];
+    return Helpers::splitView(csv, ',', tokens, 16);
+  });
+  run("Helpers::parseRangeSet (buffer)", [&]() -> uint64_t {
+    ValueRange ranges[8];
+    return Helpers::parseRangeSet(range_set, ranges, 8);
+  });
+}
+
+/*
+ * Description: XmlData construction and accessor benchmarks.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MicroBench::runXmlData()
+{
+  XmlData data(std::string("12-14,10,6-2"));
+  data.addElement("game");
+  data.addElement("map", "id", "1");
+  data.addElement("main");
+  data.addElement("base", "index", "0");
+
+  run("XmlData construct (4 elements)", [&]() -> uint64_t {
+    XmlData build(std::string("12-14,10,6-2"));
+    build.addElement("game");
+    build.addElement("map", "id", "1");
+    build.addElement("main");
+    build.addElement("base", "index", "0");
+    return build.getNumElements();
+  });
+  run("XmlData copy", [&]() -> uint64_t {
+    XmlData copy(data);
+    return copy.getNumElements();
+  });
+  run("XmlData::getElement/getKeyValue", [&]() -> uint64_t {
+    return data.getElement(1).size() + data.getKeyValue(3).size();
+  });
+  run("XmlData::getDataString", [&]() -> uint64_t {
+    return data.getDataString().size();
+  });
+}
+
+/*
+ * Description: Runs all benchmarks matching the filter, printing a line per
+ *              benchmark as it completes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MicroBench::runAll()
+{
+  std::cout << std::left << std::setw(40) << "benchmark" << std::right
+            << std::setw(12) << "iterations" << std::setw(14) << "ns/op"
+            << std::setw(12) << "allocs/op" << std::endl;
+
+  runFileHandler();
+  runHelpers();
+  runXmlData();
+  runBattle();
+}
+
+/*
+ * Description: Writes the results as CSV.
+ *
+ * Inputs: std::string path - the CSV path
+ * Output: bool - true if written
+ */
+bool MicroBench::write(std::string path)
+{
+  std::ofstream out(path.c_str(), std::ios::out | std::ios::trunc);
+  if(!out.good())
+  {
+    std::cerr << "[ERROR] Microbenchmark output \"" << path
+              << "\" could not be opened" << std::endl;
+    return false;
+  }
+
+  out << "benchmark,iterations,ns_op,allocs_op" << std::endl;
+  for(auto& result : results)
+    out << result.name << "," << result.iterations << "," << result.ns_op
+        << "," << result.allocs_op << std::endl;
+  out.close();
+
+  return true;
+}
+
+/*=============================================================================
+ * MAIN
+ *============================================================================*/
+
+int main(int argc, char** argv)
+{
+  std::string filter = "";
+  if(argc > 1)
+    filter = argv[1];
+
+  MicroBench bench(filter);
+  bench.runAll();
+
+  if(argc > 2 && !bench.write(argv[2]))
+    return 1;
+
+  return 0;
+}
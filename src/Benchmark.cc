@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * Class Name: Benchmark
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Headless frame time benchmark. Collects the update and render
+ *              times of a fixed number of frames driven through the
+ *              Application run loop and dumps the per frame timings plus the
+ *              min/median/p99 summary as CSV. Also holds the scripted input
+ *              that is fed into the key handler while the frames run.
+ ******************************************************************************/
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <iostream>
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t Benchmark::kSCRIPT_ACTION = 150;
+const uint32_t Benchmark::kSCRIPT_HOLD = 45;
+
+const uint32_t Benchmark::kDEFAULT_FRAMES = 2000;
+const std::string Benchmark::kDEFAULT_OUTPUT = "bench.csv";
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Sets up the benchmark with the number of frames to record and
+ *              where to write the results.
+ *
+ * Inputs: uint32_t frame_count - number of frames to record
+ *         std::string output_path - path of the per frame CSV
+ */
+Benchmark::Benchmark(uint32_t frame_count, std::string output_path)
+{
+  this->frame_count = frame_count;
+  this->output_path = output_path;
+  script_index = 0;
+
+  frames.reserve(frame_count);
+  buildScript();
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Builds the default input script. The player walks a square
+ *              (right, down, left, up) and strikes the action key on a fixed
+ *              interval, which also advances conversations and battle menus.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Benchmark::buildScript()
+{
+  const SDL_Keycode walk[] = {SDLK_d, SDLK_s, SDLK_a, SDLK_w};
+  uint32_t walk_index = 0;
+
+  script.clear();
+  for(uint32_t frame = 1; frame < frame_count; frame += kSCRIPT_HOLD)
+  {
+    SDL_Keycode key = walk[walk_index++ % 4];
+    script.push_back({frame, key, true});
+    script.push_back({frame + kSCRIPT_HOLD - 1, key, false});
+  }
+  for(uint32_t frame = kSCRIPT_ACTION; frame < frame_count;
+      frame += kSCRIPT_ACTION)
+  {
+    script.push_back({frame, SDLK_SPACE, true});
+    script.push_back({frame + 1, SDLK_SPACE, false});
+  }
+
+  std::stable_sort(script.begin(), script.end(),
+                   [](const BenchKey& a, const BenchKey& b) {
+                     return a.frame < b.frame;
+                   });
+}
+
+/*
+ * Description: Returns the value at the percentile (0.0 - 1.0) of an already
+ *              sorted set, using the nearest rank.
+ *
+ * Inputs: const std::vector<double>& sorted - ascending set of values
+ *         double pc - the percentile
+ * Output: double - the value at the percentile. 0 if empty
+ */
+double Benchmark::percentile(const std::vector<double>& sorted, double pc)
+{
+  if(sorted.empty())
+    return 0.0;
+
+  uint32_t index = static_cast<uint32_t>(pc * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(index, static_cast<uint32_t>(sorted.size() - 1))];
+}
+
+/*
+ * Description: Writes the min/median/p99 rows for the update, render and total
+ *              frame times of the given scene. An empty scene is all frames.
+ *
+ * Inputs: std::ofstream& out - the summary stream
+ *         std::string scene - the scene to summarize
+ * Output: none
+ */
+void Benchmark::writeSummary(std::ofstream& out, std::string scene)
+{
+  std::vector<double> update_set;
+  std::vector<double> render_set;
+  std::vector<double> total_set;
+
+  for(auto& frame : frames)
+  {
+    if(scene.empty() || frame.scene == scene)
+    {
+      update_set.push_back(frame.update_ms);
+      render_set.push_back(frame.render_ms);
+      total_set.push_back(frame.update_ms + frame.render_ms);
+    }
+  }
+
+  if(total_set.empty())
+    return;
+
+  std::sort(update_set.begin(), update_set.end());
+  std::sort(render_set.begin(), render_set.end());
+  std::sort(total_set.begin(), total_set.end());
+
+  std::string name = scene.empty() ? "all" : scene;
+  std::vector<std::pair<std::string, std::vector<double>*>> sets = {
+      {"update", &update_set}, {"render", &render_set}, {"total", &total_set}};
+  for(auto& set : sets)
+  {
+    out << name << "," << set.first << "," << set.second->size() << ","
+        << set.second->front() << "," << percentile(*set.second, 0.5) << ","
+        << percentile(*set.second, 0.99) << std::endl;
+  }
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Adds a recorded frame to the set, if not already complete.
+ *
+ * Inputs: std::string scene - the scene that was running (map, battle, menu)
+ *         double update_ms - the update time of the frame
+ *         double render_ms - the render time of the frame
+ * Output: none
+ */
+void Benchmark::addFrame(std::string scene, double update_ms, double render_ms)
+{
+  if(!isComplete())
+    frames.push_back({scene, render_ms, update_ms});
+}
+
+/*
+ * Description: Returns the number of frames recorded so far.
+ *
+ * Inputs: none
+ * Output: uint32_t - recorded frame count
+ */
+uint32_t Benchmark::getFrameCount()
+{
+  return frames.size();
+}
+
+/*
+ * Description: Returns the scripted key events that trigger on the next
+ *              recorded frame. Each event is only returned once.
+ *
+ * Inputs: none
+ * Output: std::vector<BenchKey> - the key events to inject
+ */
+std::vector<BenchKey> Benchmark::getScriptKeys()
+{
+  std::vector<BenchKey> keys;
+
+  while(script_index < script.size() &&
+        script[script_index].frame <= frames.size())
+  {
+    keys.push_back(script[script_index]);
+    script_index++;
+  }
+
+  return keys;
+}
+
+/*
+ * Description: Returns if all the requested frames have been recorded.
+ *
+ * Inputs: none
+ * Output: bool - true if complete
+ */
+bool Benchmark::isComplete()
+{
+  return (frames.size() >= frame_count);
+}
+
+/*
+ * Description: Writes the per frame CSV to the output path and the summary
+ *              CSV next to it (with a _summary suffix). The summary is also
+ *              echoed to the console.
+ *
+ * Inputs: none
+ * Output: bool - true if both files were written
+ */
+bool Benchmark::write()
+{
+  std::string summary_path = output_path;
+  std::size_t ext = summary_path.rfind(".csv");
+  if(ext != std::string::npos)
+    summary_path.erase(ext);
+  summary_path += "_summary.csv";
+
+  /* Per frame timings */
+  std::ofstream out(output_path.c_str(), std::ios::out | std::ios::trunc);
+  if(!out.good())
+  {
+    std::cerr << "[ERROR] Benchmark output \"" << output_path
+              << "\" could not be opened" << std::endl;
+    return false;
+  }
+  out << "frame,scene,update_ms,render_ms" << std::endl;
+  for(uint32_t i = 0; i < frames.size(); i++)
+    out << i << "," << frames[i].scene << "," << frames[i].update_ms << ","
+        << frames[i].render_ms << std::endl;
+  out.close();
+
+  /* Summary */
+  std::ofstream summary(summary_path.c_str(), std::ios::out | std::ios::trunc);
+  if(!summary.good())
+  {
+    std::cerr << "[ERROR] Benchmark summary \"" << summary_path
+              << "\" could not be opened" << std::endl;
+    return false;
+  }
+  summary << "scene,metric,frames,min_ms,median_ms,p99_ms" << std::endl;
+  writeSummary(summary, "");
+  writeSummary(summary, "map");
+  writeSummary(summary, "battle");
+  writeSummary(summary, "menu");
+  summary.close();
+
+  std::cout << "Benchmark: " << frames.size() << " frames written to "
+            << output_path << " (summary: " << summary_path << ")"
+            << std::endl;
+
+  return true;
+}
@@ -0,0 +1,272 @@
+/*******************************************************************************
+ * Class Name: Checksum
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Incremental integrity checksum of the encrypted files. The
+ *              data is fed line by line as it is written or decrypted, so the
+ *              check needs no second copy or pass over the file. Two kinds
+ *              are supported: MD5 (the original, for existing files) and a
+ *              fast 64 bit hash (XXH64), which is the default for new files.
+ ******************************************************************************/
+#include "Checksum.h"
+
+#include <algorithm>
+#include <cstring>
+
+/* Constant Implementation - see header file for descriptions */
+const uint64_t Checksum::kPRIME1 = 0x9E3779B185EBCA87ull;
+const uint64_t Checksum::kPRIME2 = 0xC2B2AE3D27D4EB4Full;
+const uint64_t Checksum::kPRIME3 = 0x165667B19E3779F9ull;
+const uint64_t Checksum::kPRIME4 = 0x85EBCA77C2B2AE63ull;
+const uint64_t Checksum::kPRIME5 = 0x27D4EB2F165667C5ull;
+const uint32_t Checksum::kSTRIPE = 32;
+const std::string Checksum::kTAG = "XH64:";
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructs a checksum of the given kind, with no data.
+ *
+ * Inputs: ChecksumType type - the kind of checksum
+ */
+Checksum::Checksum(ChecksumType type)
+{
+  reset(type);
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: One XXH64 accumulator round over an 8 byte input.
+ *
+ * Inputs: uint64_t accumulator - the accumulator
+ *         uint64_t input - the input word
+ * Output: uint64_t - the new accumulator
+ */
+uint64_t Checksum::mixRound(uint64_t accumulator, uint64_t input)
+{
+  accumulator += input * kPRIME2;
+  return rotate(accumulator, 31) * kPRIME1;
+}
+
+/*
+ * Description: Reads a little endian 64 bit word.
+ *
+ * Inputs: const unsigned char* data - the 8 bytes to read
+ * Output: uint64_t - the word
+ */
+uint64_t Checksum::read64(const unsigned char* data)
+{
+  uint64_t value = 0;
+  for(int i = 7; i >= 0; i--)
+    value = (value << 8) | data[i];
+  return value;
+}
+
+/*
+ * Description: Rotates the value left.
+ *
+ * Inputs: uint64_t value - the value to rotate
+ *         int bits - the bits to rotate by, 1 to 63
+ * Output: uint64_t - the rotated value
+ */
+uint64_t Checksum::rotate(uint64_t value, int bits)
+{
+  return (value << bits) | (value >> (64 - bits));
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the digest line of the data added so far. The
+ *              checksum is not finalized, so more data may be added after.
+ *
+ * Inputs: none
+ * Output: std::string - the digest line
+ */
+std::string Checksum::digest() const
+{
+  if(type == ChecksumType::MD5)
+  {
+    MD5 final_md5 = md5;
+    return final_md5.finalize().hexdigest();
+  }
+
+  const char* hex = "0123456789abcdef";
+  uint64_t value = hash();
+  std::string digest = kTAG + std::string(16, '0');
+  for(uint32_t i = 0; i < 16; i++)
+    digest[kTAG.size() + i] = hex[(value >> (60 - 4 * i)) & 0xF];
+  return digest;
+}
+
+/*
+ * Description: Returns the kind of checksum.
+ *
+ * Inputs: none
+ * Output: ChecksumType - the kind of checksum
+ */
+ChecksumType Checksum::getType() const
+{
+  return type;
+}
+
+/*
+ * Description: Returns the XXH64 hash (seed 0) of the data added so far.
+ *
+ * Inputs: none
+ * Output: uint64_t - the hash value
+ */
+uint64_t Checksum::hash() const
+{
+  uint64_t value = 0;
+
+  if(total_size >= kSTRIPE)
+  {
+    value = rotate(accumulators[0], 1) + rotate(accumulators[1], 7) +
+            rotate(accumulators[2], 12) + rotate(accumulators[3], 18);
+    for(uint32_t i = 0; i < 4; i++)
+    {
+      value ^= mixRound(0, accumulators[i]);
+      value = value * kPRIME1 + kPRIME4;
+    }
+  }
+  else
+  {
+    value = kPRIME5;
+  }
+  value += total_size;
+
+  /* The partial stripe */
+  uint32_t pos = 0;
+  for(; pos + 8 <= stripe_size; pos += 8)
+  {
+    value ^= mixRound(0, read64(&stripe[pos]));
+    value = rotate(value, 27) * kPRIME1 + kPRIME4;
+  }
+  if(pos + 4 <= stripe_size)
+  {
+    uint64_t word = static_cast<uint64_t>(stripe[pos]) |
+                    static_cast<uint64_t>(stripe[pos + 1]) << 8 |
+                    static_cast<uint64_t>(stripe[pos + 2]) << 16 |
+                    static_cast<uint64_t>(stripe[pos + 3]) << 24;
+    value ^= word * kPRIME1;
+    value = rotate(value, 23) * kPRIME2 + kPRIME3;
+    pos += 4;
+  }
+  for(; pos < stripe_size; pos++)
+  {
+    value ^= stripe[pos] * kPRIME5;
+    value = rotate(value, 11) * kPRIME1;
+  }
+
+  /* Avalanche */
+  value ^= value >> 33;
+  value *= kPRIME2;
+  value ^= value >> 29;
+  value *= kPRIME3;
+  value ^= value >> 32;
+
+  return value;
+}
+
+/*
+ * Description: Restarts the checksum with no data added.
+ *
+ * Inputs: ChecksumType type - the kind of checksum
+ * Output: none
+ */
+void Checksum::reset(ChecksumType type)
+{
+  this->type = type;
+
+  md5 = MD5();
+  accumulators[0] = kPRIME1 + kPRIME2;
+  accumulators[1] = kPRIME2;
+  accumulators[2] = 0;
+  accumulators[3] = 0 - kPRIME1;
+  stripe_size = 0;
+  total_size = 0;
+}
+
+/*
+ * Description: Adds data to the checksum. Full stripes of the 64 bit hash
+ *              are mixed straight from the data, without a copy.
+ *
+ * Inputs: const char* data - the data to add
+ *         size_t length - the number of bytes
+ * Output: none
+ */
+void Checksum::update(const char* data, size_t length)
+{
+  if(type == ChecksumType::MD5)
+  {
+    md5.update(data, length);
+    return;
+  }
+
+  const unsigned char* input = reinterpret_cast<const unsigned char*>(data);
+  total_size += length;
+
+  /* Complete the partial stripe first */
+  if(stripe_size > 0)
+  {
+    size_t fill = std::min<size_t>(kSTRIPE - stripe_size, length);
+    memcpy(&stripe[stripe_size], input, fill);
+    stripe_size += fill;
+    input += fill;
+    length -= fill;
+    if(stripe_size < kSTRIPE)
+      return;
+
+    for(uint32_t i = 0; i < 4; i++)
+      accumulators[i] = mixRound(accumulators[i], read64(&stripe[i * 8]));
+    stripe_size = 0;
+  }
+
+  /* Full stripes */
+  for(; length >= kSTRIPE; input += kSTRIPE, length -= kSTRIPE)
+    for(uint32_t i = 0; i < 4; i++)
+      accumulators[i] = mixRound(accumulators[i], read64(&input[i * 8]));
+
+  /* Keep the rest for the next update */
+  memcpy(stripe, input, length);
+  stripe_size = length;
+}
+
+/*
+ * Description: Adds the string data to the checksum.
+ *
+ * Inputs: const std::string& data - the data to add
+ * Output: none
+ */
+void Checksum::update(const std::string& data)
+{
+  update(data.data(), data.size());
+}
+
+/*=============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the kind of checksum that produced the digest line.
+ *              Untagged digests are from files written before the 64 bit
+ *              hash, which are MD5.
+ *
+ * Inputs: const std::string& digest - the digest line
+ * Output: ChecksumType - the kind of checksum
+ */
+ChecksumType Checksum::detect(const std::string& digest)
+{
+  if(digest.size() == kTAG.size() + 16 &&
+     digest.compare(0, kTAG.size(), kTAG) == 0)
+    return ChecksumType::HASH64;
+  return ChecksumType::MD5;
+}
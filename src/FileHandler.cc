@@ -41,23 +41,28 @@
  *****************************************************************************/
 #include "FileHandler.h"
 
+#include <atomic>
+#include <filesystem>
+
+#include "LoadReport.h"
+#include "ThreadPool.h"
+#include "Xxtea.h"
+
 /* Constant Implementation - see header file for descriptions */
-const int      FileHandler::kASCII_IN_LONG   = 4;
-const uint32_t FileHandler::kDELTA           = 2654435769u;
-const int      FileHandler::kENCRYPTION_MIN  = 4;
-const int      FileHandler::kENCRYPTION_PAD  = 150;
-const int      FileHandler::kFILE_NAME_LIMIT = 1000000;
-const int      FileHandler::kFILE_START      = 5728;
-const int      FileHandler::kINT_BIT_SHIFT   = 4;
-const int      FileHandler::kINT_BUFFER      = 0xF;
-const uint32_t FileHandler::kKEY[]           = {1073676287u,27644437u,
-                                                2971215073u,94418953u};
-const int      FileHandler::kLONG_BIT_SHIFT  = 8;
-const int      FileHandler::kLONG_BUFFER     = 0xFF;
-const int      FileHandler::kMAX_ASCII       = 255;
-const int      FileHandler::kMIN_LINE        = 16;
-const int      FileHandler::kPADDING_ASCII   = 200;
-const int      FileHandler::kXXTEA_ROUNDS    = 19;
+const int      FileHandler::kASCII_IN_LONG      = 4;
+const int      FileHandler::kENCRYPTION_MIN     = 4;
+const int      FileHandler::kENCRYPTION_PAD     = 150;
+const int      FileHandler::kFILE_NAME_LIMIT    = 1000000;
+const int      FileHandler::kFILE_START         = 5728;
+const int      FileHandler::kHASH_BLOCK         = 65536;
+const int      FileHandler::kINT_BIT_SHIFT      = 4;
+const int      FileHandler::kINT_BUFFER         = 0xF;
+const int      FileHandler::kLONG_BIT_SHIFT     = 8;
+const int      FileHandler::kLONG_BUFFER        = 0xFF;
+const int      FileHandler::kMIN_LINE           = 16;
+const int      FileHandler::kPADDING_ASCII      = 200;
+const uint32_t FileHandler::kPARALLEL_BATCHES   = 64;
+const uint32_t FileHandler::kPARALLEL_MIN_BYTES = 65536;
 
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
@@ -80,6 +85,7 @@ FileHandler::FileHandler()
   file_name_temp = "";
   file_type = REGULAR;
   file_write = false;
+  stream_enabled = false;
   //xml_data = "";
   //xml_depth = 0;
   xml_document = NULL;
@@ -135,47 +141,38 @@ void FileHandler::cleanUp()
 
   xml_node = NULL;
   element_count = 0;
+
+  /* Release the streamed source */
+  stream_data.clear();
+  stream_data.shrink_to_fit();
 }
 
 /*
- * Description: Takes a sequence of 32 bit data (4 in the array) and decrypts
- *              the data, as per XXTEA algorithm. The data is returned on the
- *              same path and returns a status.
- *
- * Inputs: uint32_t* data - an array of 4 32 bit values to decrypt
- * Output: bool - the returned success status
+ * Description: Decrypts one encrypted line in place. The character pairs are
+ *              converted into the reused word array, decrypted and written
+ *              back as bytes with the padding removed. The decrypted line is
+ *              at most half the encrypted length, so it can be written at or
+ *              before the start of the line.
+ *
+ * Inputs: char* line - the start of the encrypted line
+ *         int length - the number of encrypted characters
+ *         char* output - where to write the decrypted line (<= line)
+ * Output: int - the decrypted length. -1 if the line is invalid
  */
-bool FileHandler::decryptData(uint32_t* data)
+int FileHandler::decryptBlock(char* line, int length, char* output)
 {
-  uint32_t y, z, sum;
-  unsigned p, rounds, e;
-
-  if(data != 0)
-  {
-    rounds = kXXTEA_ROUNDS;
-    sum = rounds * kDELTA;
-    y = data[0];
-
-    do
-    {
-      e = (sum >> 2) & 3;
-
-      for (p=3; p>0; p--)
-      {
-        z = data[p-1];
-        y = data[p] -= MX;
-      }
-
-      z = data[3];
-      y = data[0] -= MX;
+  int word_length = lineToWords(line, length, nullptr);
+  if(word_length < 0)
+    return -1;
 
-    } while((sum -= kDELTA) != 0);
+  if(crypt_words.size() < static_cast<uint32_t>(word_length))
+    crypt_words.resize(word_length);
+  lineToWords(line, length, crypt_words.data());
 
-    return true;
-  }
+  if(!Xxtea::decrypt(crypt_words.data(), word_length))
+    return -1;
 
-  std::cerr << "[ERROR] File block decryption failed on null data" << std::endl;
-  return false;
+  return wordsToLine(crypt_words.data(), word_length, output);
 }
 
 /*
@@ -205,222 +202,68 @@ void FileHandler::determineCount()
 }
 
 /*
- * Description: Decrypts a line of data. This line must conform to the length
- *              requirements and must be greater than the minimum line length.
- *              The line needs to be a divisor of 4 in terms of the number
- *              of characters in order to ensure that the line can be
- *              converted to a 32bit number for use with the XXTEA algorithm.
- *              It also must have at least 16 characters (4 32-bit numbers)
- *              which is the minimum for the XXTEA algorithm.
- *
- * Inputs: std::string line - the line to be decrypted, from the file
- *         bool* success - a bool pointer that can be set to return the
- *                         success status.
- * Output: std::string - the decrypted version of the input line.
+ * Description: Converts an encrypted line into its 32 bit words. Each pair of
+ *              characters holds one byte and four bytes make one word, most
+ *              significant first. With no word array, only the length is
+ *              validated and returned.
+ *
+ * Inputs: const char* line - the encrypted characters
+ *         int length - the number of characters
+ *         uint32_t* words - the words to fill (may be null)
+ * Output: int - the number of words. -1 if the line is not valid
  */
-std::string FileHandler::decryptLine(std::string line, bool* success)
+int FileHandler::lineToWords(const char* line, int length, uint32_t* words)
 {
-  uint32_t* compressed_data;
-  int compressed_length;
-  uint32_t decrypt_data [kENCRYPTION_MIN];
-  std::string decrypted_line;
-  int* line_data;
-  int line_length;
-  bool status = true;
-
-  /* Convert line data into long to be decrypted */
-  line_length = stringToInt(line, &line_data);
-  compressed_data = intToLong(line_data, line_length);
-  compressed_length = line_length / kASCII_IN_LONG;
+  int byte_length = length / 2;
+  int word_length = byte_length / kASCII_IN_LONG;
 
-  if(compressed_data != 0 && compressed_length >= kENCRYPTION_MIN)
+  if(byte_length % kASCII_IN_LONG != 0 || word_length < kENCRYPTION_MIN)
   {
-    /* Begin to decrypt the data, reverse access (opposite of encrypt) */
-    for(int i = compressed_length - 1; i >= 0; i--)
-    {
-      /* Assemble array to decrypt */
-      for(int j = 0; j < kENCRYPTION_MIN; j++)
-        decrypt_data[j] = compressed_data[wrapNumber(i+j, compressed_length)];
-
-      /* Decrypt snapshot of data */
-      status &= decryptData(decrypt_data);
-
-      /* Dump the decrypted data back into the array */
-      for(int j = 0; j < kENCRYPTION_MIN; j++)
-        compressed_data[wrapNumber(i+j, compressed_length)] = decrypt_data[j];
-    }
-
-    /* Convert the line back to a string, as long as status was succesful */
-    if(status)
-    {
-      delete[] line_data;
-      line_data = longToInt(compressed_data, compressed_length);
-      decrypted_line = intToString(line_data, line_length, true);
-    }
-    else
-    {
-      decrypted_line = "";
-    }
-  }
-  else
-  {
-    status = false;
-    decrypted_line = "";
     std::cerr << "[ERROR] Invalid data from file for line decrypt."
               << std::endl;
+    return -1;
   }
 
-  /* Clean up compressed pointer, if set */
-  if(compressed_data != 0 || compressed_length > 0)
-  {
-    delete[] compressed_data;
-    compressed_data = NULL;
-  }
-
-  /* Delete final pointer only if line length was set */
-  if(line_data != 0 || line_length > 0)
+  for(int i = 0; words != nullptr && i < word_length; i++)
   {
-    delete[] line_data;
-    line_data = NULL;
-  }
-
-  /* Set the success status determined above */
-  if(success != 0)
-    *success = status;
-
-  return decrypted_line;
-}
-
-/*
- * Description: Takes a sequence of 32 bit data (4 in the array) and encrypts
- *              the data, as per XXTEA algorithm. The data is returned on the
- *              same path and returns a status.
- *
- * Inputs: uint32_t* data - an array of 4 32 bit values to encrypt
- * Output: bool - the returned success status
- */
-bool FileHandler::encryptData(uint32_t* data)
-{
-  uint32_t y, z, sum;
-  unsigned p, rounds, e;
-
-  if(data != 0)
-  {
-    rounds = kXXTEA_ROUNDS;
-    sum = 0;
-    z = data[3];
-
-    do
+    uint32_t word = 0;
+    for(int j = 0; j < kASCII_IN_LONG; j++)
     {
-      sum += kDELTA;
-      e = (sum >> 2) & 3;
-
-      for(p=0; p < 3; p++)
-      {
-        y = data[p+1];
-        z = data[p] += MX;
-      }
-
-      y = data[0];
-      z = data[3] += MX;
-
-    } while(--rounds);
-
-    return true;
+      int k = (i * kASCII_IN_LONG + j) * 2;
+      int value = ((line[k] - kENCRYPTION_PAD) & kINT_BUFFER) << kINT_BIT_SHIFT;
+      value |= (line[k + 1] - kENCRYPTION_PAD) & kINT_BUFFER;
+      word = (word << kLONG_BIT_SHIFT) | (value & kLONG_BUFFER);
+    }
+    words[i] = word;
   }
 
-  std::cerr << "[ERROR] File block encryption failed on null data" << std::endl;
-  return false;
+  return word_length;
 }
 
 /*
- * Description: Encrypts a line of data. This line must conform to the length
- *              requirements and must be greater than the minimum line length.
- *              The line needs to be a divisor of 4 in terms of the number
- *              of characters in order to ensure that the line can be
- *              converted to a 32bit number for use with the XXTEA algorithm.
- *              It also must have at least 16 characters (4 32-bit numbers)
- *              which is the minimum for the XXTEA algorithm.
+ * Description: Converts decrypted 32 bit words back into the line bytes and
+ *              removes the trailing padding characters.
  *
- * Inputs: std::string line - the line to be encrypted, from the file
- *         bool* success - a bool pointer that can be set to return the
- *                         success status.
- * Output: std::string - the encrypted version of the input line.
+ * Inputs: const uint32_t* words - the decrypted words
+ *         int length - the number of words
+ *         char* output - where to write the line bytes
+ * Output: int - the line length, without the padding
  */
-std::string FileHandler::encryptLine(std::string line, bool* success)
+int FileHandler::wordsToLine(const uint32_t* words, int length, char* output)
 {
-  uint32_t* compressed_data;
-  int compressed_length;
-  uint32_t encrypt_data [kENCRYPTION_MIN];
-  std::string encrypted_line;
-  int* line_data;
-  int line_length;
-  bool status = true;
-
-  /* Convert line data into long to be encrypted */
-  line_length = stringToInt(line, &line_data, true);
-  compressed_data = intToLong(line_data, line_length);
-  compressed_length = line_length / kASCII_IN_LONG;
-
-  if(compressed_data != 0 && compressed_length >= kENCRYPTION_MIN)
-  {
-    /* Begin to encrypt the data, reverse access (opposite of encrypt) */
-    for(int i = 0; i < compressed_length; i++)
-    {
-      /* Assemble array to encrypt */
-      for(int j = 0; j < kENCRYPTION_MIN; j++)
-        encrypt_data[j] = compressed_data[wrapNumber(i+j, compressed_length)];
-
-      /* Encrypt snapshot of data */
-      status &= encryptData(encrypt_data);
-
-      /* Dump the encrypted data back into the array */
-      for(int j = 0; j < kENCRYPTION_MIN; j++)
-        compressed_data[wrapNumber(i+j, compressed_length)] = encrypt_data[j];
-    }
-
-    /* Convert the line back to a string, as long as status was succesful */
-    if(status)
-    {
-      delete[] line_data;
-      line_data = NULL;
-      line_data = longToInt(compressed_data, compressed_length);
-      encrypted_line = intToString(line_data, line_length);
-    }
-    else
-    {
-      encrypted_line = "";
-      std::cerr << "[ERROR] Invalid data from file for line encrypt."
-                << std::endl;
-    }
-  }
-  else
-  {
-    status = false;
-    encrypted_line = "";
-    std::cerr << "[ERROR] Data compression size encrypt computation failed."
-              << std::endl;
-  }
+  int byte_length = length * kASCII_IN_LONG;
 
-  /* Clean up compressed data */
-  if(compressed_data != 0 || compressed_length > 0)
-  {
-   delete[] compressed_data;
-   compressed_data = NULL;
-  }
+  for(int i = 0; i < length; i++)
+    for(int j = 0; j < kASCII_IN_LONG; j++)
+      output[i * kASCII_IN_LONG + j] =
+          (words[i] >> ((kASCII_IN_LONG - 1 - j) * kLONG_BIT_SHIFT)) &
+          kLONG_BUFFER;
 
-  /* Clean up line pointer only if line length was set */
-  if(line_data != 0 || line_length > 0)
-  {
-   delete[] line_data;
-   line_data = NULL;
-  }
-
-  /* Set the success status determined above */
-  if(success != 0)
-   *success = status;
+  while(byte_length > 0 &&
+        static_cast<uint8_t>(output[byte_length - 1]) >= kPADDING_ASCII)
+    byte_length--;
 
-  return encrypted_line;
+  return byte_length;
 }
 
 /*
@@ -473,141 +316,158 @@ bool FileHandler::fileOpen()
 }
 
 /*
- * Description: Converts an array of integers to an array of longs. This
- *              combines 4 ints into one 32 bit long. They're restricted to
- *              ASCII character integers which are 8 bits long. This class
- *              will fail if the length of the integer array is not a divisor
- *              of 4.
- *
- * Inputs: int* line_data - the individual characters in the line split up.
- *         int length - the number of integers in the array
- * Output: uint32_t* - the converted array of longs. Length is length % 4
+ * Description: Reads the full file with one read into a pre-sized buffer. If
+ *              encrypted, all lines are converted into one word array, then
+ *              lines of the same length are decrypted together in the vector
+ *              lanes of Xxtea, and written back in place behind the read
+ *              position. The leading checksum line is checked against the
+ *              rest as each line is written back, as readChecksum() would.
+ *              The result matches the lines of readLine() appended together.
+ *
+ * Inputs: std::string& data - the read data
+ * Output: bool - true if the read (and checksum) was successful
  */
-uint32_t* FileHandler::intToLong(int* line_data, int length)
+bool FileHandler::readBulk(std::string& data)
 {
-  /* Only move forward if the data is legitimate */
-  if(line_data != 0 && length > 0 && length % 4 == 0)
-  {
-    uint32_t* long_data = new uint32_t[length / kASCII_IN_LONG];
+  bool success = true;
 
-    /* Convert all ints into length / 4 longs */
-    for(int i = 0; i < length / kASCII_IN_LONG; i++)
-    {
-      long_data[i] = 0;
+  if(!available || file_write)
+    return false;
 
-      /* Run through the sets of 4 ASCII in the int array */
-      for(int j = 0; j < kASCII_IN_LONG; j++)
-      {
-        long_data[i] = long_data[i] << 8;
-        long_data[i] |= line_data[i*kASCII_IN_LONG + j] & kMAX_ASCII;
-      }
-    }
+  /* One read of the full file */
+  file_stream.seekg(0, std::ios::end);
+  std::streamoff size = file_stream.tellg();
+  file_stream.seekg(0, std::ios::beg);
+  if(size < 0)
+    return false;
 
-    return long_data;
+  data.resize(size);
+  if(size > 0 && !file_stream.read(&data[0], size))
+  {
+    std::cerr << "[ERROR] File read of \"" << file_name << "\" failed."
+              << std::endl;
+    return false;
   }
 
-  std::cerr << "[ERROR] IntToLong conversion of file data line failed."
-            << std::endl;
-  return 0;
-}
-
-/*
- * Description: Converts an array of integers into a string. The integers
- *              represent ASCII codes and are converted into the appropriate
- *              character and appended to the return result.
- *
- * Inputs: int* line_data - the array of integers that defines the ASCII line
- *         int length - the length of the integer array / future string line
- *         bool decrypting - Is this call decrypting the data
- * Output: std::string - the converted line of data
- */
-std::string FileHandler::intToString(int* line_data, int length,
-                                                     bool decrypting)
-{
-  bool end_reached = false;
-  std::string line = "";
-  int line_count = length - 1;
-
-  /* Check for padding at the end, only if the data was encrypted */
-  if(encryption_enabled && decrypting && length > 0)
+  if(encryption_enabled)
   {
-    do
+    /* Character start, word offset and word length of each line */
+    struct CryptLine
+    {
+      size_t start;
+      uint32_t offset;
+      uint32_t length;
+    };
+    std::vector<CryptLine> lines;
+    uint32_t offset = 0;
+    size_t start = 0;
+
+    /* Split the lines and validate their lengths */
+    while(success && start < data.size())
     {
-      if(line_data[line_count] >= kPADDING_ASCII)
-        line_data[line_count] = kMAX_ASCII+1;
+      size_t end = data.find('\n', start);
+      if(end == std::string::npos)
+        end = data.size();
+
+      int length = lineToWords(&data[start], end - start, nullptr);
+      if(length < 0)
+      {
+        success = false;
+      }
       else
-        end_reached = true;
-    } while(!end_reached && --line_count >= 0);
-  }
+      {
+        lines.push_back({start, offset, static_cast<uint32_t>(length)});
+        offset += length;
+      }
 
-  /* Get the string from the integer data, remove padding if needed */
-  if(line_data != 0)
-  {
-    if(encryption_enabled && decrypting)
-    {
-      for(int i = 0; i < length; i++)
+      start = end + 1;
+    }
+
+    /* Group the lines of each length into batches of up to kLANES */
+    std::vector<uint32_t> order(lines.size());
+    for(uint32_t i = 0; i < order.size(); i++)
+      order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](uint32_t a, uint32_t b) {
+                       return lines[a].length < lines[b].length;
+                     });
+    std::vector<uint32_t> batches;
+    for(uint32_t i = 0; i < order.size(); i++)
+      if(i == 0 || lines[order[i]].length != lines[order[i - 1]].length ||
+         i - batches.back() == Xxtea::kLANES)
+        batches.push_back(i);
+    batches.push_back(order.size());
+
+    /* Convert and decrypt each batch. Large files spread the batches over the
+     * worker pool - every line is independent, with its own words */
+    std::vector<uint32_t> words(offset);
+    std::vector<uint32_t*> lanes(order.size());
+    std::atomic<bool> decrypted{success};
+    auto decryptBatches = [&](uint32_t index) {
+      uint32_t last = std::min<uint32_t>((index + 1) * kPARALLEL_BATCHES,
+                                         batches.size() - 1);
+      for(uint32_t b = index * kPARALLEL_BATCHES; b < last; b++)
       {
-        if(line_data[i] <= kMAX_ASCII)
+        for(uint32_t i = batches[b]; i < batches[b + 1]; i++)
         {
-          char c = line_data[i];
-          line.push_back(c);
+          CryptLine& line = lines[order[i]];
+          lanes[i] = &words[line.offset];
+          lineToWords(&data[line.start], line.length * kASCII_IN_LONG * 2,
+                      lanes[i]);
         }
+
+        if(!Xxtea::decryptLanes(&lanes[batches[b]], batches[b + 1] - batches[b],
+                                lines[order[batches[b]]].length))
+          decrypted = false;
       }
-    }
+    };
+    uint32_t chunks = (batches.size() - 1 + kPARALLEL_BATCHES - 1) /
+                      kPARALLEL_BATCHES;
+    if(!success)
+      chunks = 0;
+    if(data.size() >= kPARALLEL_MIN_BYTES)
+      ThreadPool::getShared().parallelFor(chunks, decryptBatches);
     else
+      for(uint32_t i = 0; i < chunks; i++)
+        decryptBatches(i);
+    success &= decrypted.load();
+
+    /* Write the lines back in order, adding each to the checksum. The
+     * first is the checksum digest, which also gives its kind */
+    std::string digest = "";
+    Checksum check;
+    size_t write = 0;
+    for(uint32_t i = 0; success && i < lines.size(); i++)
     {
-      for(int i = 0; i < length; i++)
+      int length = wordsToLine(&words[lines[i].offset], lines[i].length,
+                               &data[write]);
+      if(i == 0)
       {
-        int val = ((line_data[i] >> kINT_BIT_SHIFT) & kINT_BUFFER)
-                                                    + kENCRYPTION_PAD;
-        line.push_back(val);
-
-        val = (line_data[i] & kINT_BUFFER) + kENCRYPTION_PAD;
-        line.push_back(val);
+        digest.assign(data, 0, length);
+        check.reset(Checksum::detect(digest));
       }
-    }
-  }
-
-
-  return line;
-}
-
-/*
- * Description: Converts an array of longs into an array of integers where
- *              it splits one long into 4 integers. The long will be
- *              converted as follows: [int0][int1][int2][int3] = [long].
- *              The length corresponds to the long array.
- *
- * Inputs: uint32_t* line_data - the long data, stored in an array
- *         int length - the length of the line_data array
- * Output: int* - the array of the split longs. Length is length*4
- */
-int* FileHandler::longToInt(uint32_t* line_data, int length)
-{
-  /* Only move forward if the data is legitimate */
-  if(line_data != 0 && length > 0)
-  {
-    int* int_data = new int[length * kASCII_IN_LONG];
-
-    /* Convert all longs into an array of ints */
-    for(int i = 0; i < length; i++)
-    {
-      uint32_t temp_long = line_data[i];
-
-      /* Run through the one long and convert to 4 ints */
-      for(int j = kASCII_IN_LONG - 1; j >= 0; j--)
+      else
       {
-        int_data[i*kASCII_IN_LONG + j] = temp_long & kLONG_BUFFER;
-        temp_long = temp_long >> kLONG_BIT_SHIFT;
+        check.update(&data[write], length);
+        write += length;
       }
     }
+    data.resize(write);
 
-    return int_data;
+    if(success && check.digest() != digest)
+    {
+      std::cerr << "[ERROR] File \"" << file_name
+                << "\" failed the checksum check." << std::endl;
+      success = false;
+    }
+  }
+  /* Plain files - lines are joined without the line breaks */
+  else
+  {
+    data.erase(std::remove(data.begin(), data.end(), '\n'), data.end());
   }
 
-  std::cerr << "[ERROR] LongToInt conversion of file data line failed."
-            << std::endl;
-  return 0;
+  return success;
 }
 
 /*
@@ -667,24 +527,24 @@ std::string FileHandler::readLine(bool* done, bool* success,
 
 /*
  * Description: This call determines if the file that is being read conforms
- *              to the MD5 value and if the file has been unchanged. Will be
- *              called before a read is allowed to check if the file is valid.
- *              Only used when the file is encrypted.
+ *              to the checksum value and if the file has been unchanged. Will
+ *              be called before a read is allowed to check if the file is
+ *              valid. The digest line picks the kind of checksum (MD5 for
+ *              older files). Only used when the file is encrypted.
  *
  * Inputs: none
  * Output: bool - returns if the file is valid, and unchanged
  */
-bool FileHandler::readMd5()
+bool FileHandler::readChecksum()
 {
   bool complete = false;
-  std::string md5_value = "";
+  std::string digest = "";
   bool success = true;
 
   /* Only proceed if file is in read mode and encryption is enabled */
   if(!file_write && encryption_enabled)
   {
-    /* Clear pertinent data storage */
-    file_data.clear();
+    Checksum check;
 
     /* If the file was open, close it */
     if(available)
@@ -701,14 +561,15 @@ bool FileHandler::readMd5()
     if(success)
     {
       available = true;
-      md5_value = readLine(&complete, &success);
+      digest = readLine(&complete, &success);
+      check.reset(Checksum::detect(digest));
 
       while(!complete && success)
-        file_data.append(readLine(&complete, &success));
+        check.update(readLine(&complete, &success));
     }
 
-    /* Check the MD5 */
-    if(success && (MD5::compute(file_data) == md5_value))
+    /* Check the checksum */
+    if(success && (check.digest() == digest))
       success = true;
     else
       success = false;
@@ -719,7 +580,7 @@ bool FileHandler::readMd5()
   }
   else
   {
-    std::cerr << "[ERROR] Md5 read failed due to system not in read mode."
+    std::cerr << "[ERROR] Checksum read failed due to system not in read mode."
               << std::endl;
     return false;
   }
@@ -738,7 +599,7 @@ bool FileHandler::readMd5()
  */
 bool FileHandler::setTempFileName()
 {
-  if(!available)
+  if(!file_stream.is_open())
   {
     bool complete = false;
     int i = 0;
@@ -764,69 +625,6 @@ bool FileHandler::setTempFileName()
   return false;
 }
 
-/*
- * Description: Converts a string line to an array of integers where each
- *              integer represents one character in the string line (via
- *              ASCII conversion). It returns the length of the array.
- *
- * Inputs: std::string line - the line to convert to an array of ints
- *         int** line_data - the returned data of the converted string line
- *         bool encrypting - Set to true if this call is called during the
- *                           encrypting procedure.
- * Output: int - Returns the length of the line_data array
- */
-int FileHandler::stringToInt(std::string line, int** line_data, bool encrypting)
-{
-  int padding_length = 0;
-  int final_length = line.length();
-
-  /* Check if additional padding is needed, only if data will be encrypted */
-  if(encryption_enabled && encrypting)
-  {
-    if(final_length < kMIN_LINE)
-      padding_length = kMIN_LINE - final_length;
-    else if(final_length % kASCII_IN_LONG != 0)
-      padding_length = kASCII_IN_LONG - final_length % kASCII_IN_LONG;
-  }
-
-  /* Add the additional padding */
-  for(int i = 0; i < padding_length; i++)
-    line.push_back(kPADDING_ASCII + i);
-  final_length += padding_length;
-
-  /* Allocate appropriate space, if size is greater than 0 */
-  if(final_length > 0)
-  {
-    /* Convert the line */
-    if(encryption_enabled && !encrypting)
-    {
-      final_length /= 2; /* Half length since combining two ints to one */
-
-      *line_data = new int[final_length];
-
-      for(int i = 0; i < final_length; i++)
-      {
-        (*line_data)[i] = ((line.at(i*2) - kENCRYPTION_PAD)
-                                               & kINT_BUFFER) << kINT_BIT_SHIFT;
-        (*line_data)[i] |= (line.at(i*2+1) - kENCRYPTION_PAD) & kINT_BUFFER;
-      }
-    }
-    else
-    {
-      *line_data = new int[final_length];
-
-      for(int i = 0; i < final_length; i++)
-        (*line_data)[i] = line.at(i);
-    }
-
-    return final_length;
-  }
-
-  std::cerr << "[ERROR] StringToInt conversion of file data line failed."
-            << std::endl;
-  return 0;
-}
-
 /*
  * Description: Returns the index in the file stream to the top of the file,
  *              for re-reading or writing the data.
@@ -849,19 +647,19 @@ bool FileHandler::topOfFile()
  *              decrypted, that procedure is done first.
  *
  * Inputs: std::string line - the line to write to the file, if it exists
- *         bool md5_line - write indicates md5, which won't be saved
+ *         bool checksum_line - the line is the checksum, which is not added
  * Output: bool - returns if the write sequence was successful
  */
-bool FileHandler::writeLine(std::string line, bool md5_line)
+bool FileHandler::writeLine(std::string line, bool checksum_line)
 {
   bool success = true;
   std::string new_line;
 
   if(available && file_write)
   {
-    /* Add to the QByteArray of currently written data */
-    if(!md5_line)
-      file_data.append(line);
+    /* Add to the checksum of currently written data */
+    if(!checksum_line)
+      checksum.update(line);
 
     /* Determine if the line should be encrypted or not */
     if(encryption_enabled)
@@ -877,38 +675,6 @@ bool FileHandler::writeLine(std::string line, bool md5_line)
   return false;
 }
 
-/*
- * Description: A wrap number call. This takes a value and a limit and wraps
- *              it around to determine what the value should be. For example:
- *                value=15,limit=10 -> 5
- *                value=27,limit=10 -> 7
- *                value=27,limit=5 -> 2
- *
- * Inputs: int value - the value to be wrapped
- *         int limit - the maximum value that the value can be
- * Output: int - the value, after the limit was applied.
- */
-int FileHandler::wrapNumber(int value, int limit)
-{
-  if(limit <= 0)
-  {
-    std::cerr << "[ERROR] Invalid limit (" << limit << ") in wrapping call."
-                                                    << std::endl;
-    return -1;
-  }
-  else if(value < 0)
-  {
-    std::cerr << "[ERROR] Invalid value (" << value << ") in wrapping call."
-                                                    << std::endl;
-    return -1;
-  }
-  else if(value >= limit)
-  {
-    return value - (value / limit) * limit;
-  }
-  return value;
-}
-
 /*
  * Description: Returns a node that contains a XMLText* node that is downstream
  *              of the current given node. This returns NULL if one cannot be
@@ -1035,17 +801,40 @@ bool FileHandler::xmlReadStart(bool read_before_write)
         }
       }
     }
-    /* File read - just parse the main file */
+    /* File read, streamed - keep the source for readXmlStream() and take
+     * the date from the first leaf. No document is built */
+    else if(stream_enabled)
+    {
+      {
+        LoadScope load_scope(LoadPhase::FILE_READ);
+        success &= readBulk(stream_data);
+      }
+
+      file_date = "";
+      element_count = 0;
+      if(success)
+      {
+        success &= XmlStream::parse(stream_data, [&](const XmlLeaf& leaf) {
+          if(leaf.getNumElements() == 1 && leaf.getElement(0) == "date")
+            file_date = leaf.getText();
+          return false;
+        });
+      }
+
+      return success;
+    }
+    /* File read - just parse the main file, read in one pass */
     else
     {
-      while(!done && success)
-        data.append(readLine(&done, &success));
+      LoadScope load_scope(LoadPhase::FILE_READ);
+      success &= readBulk(data);
     }
 
     /* Attempt to parse the document and then set the pointer to the head */
-    if(!data.empty())
+    if(success && !data.empty())
     {
-      success &= !xml_document->Parse(data.c_str());
+      LoadScope load_scope(LoadPhase::XML_PARSE);
+      success &= !xml_document->Parse(data.data(), data.size());
       if(success)
       {
         file_date = xmlToHead();
@@ -1099,6 +888,109 @@ bool FileHandler::xmlWriteEnd()
  * PUBLIC FUNCTIONS
  *===========================================================================*/
   
+/*
+ * Description: Decrypts a line of data. This line must conform to the length
+ *              requirements and must be greater than the minimum line length.
+ *              The line needs to be a divisor of 4 in terms of the number
+ *              of characters in order to ensure that the line can be
+ *              converted to a 32bit number for use with the XXTEA algorithm.
+ *              It also must have at least 16 characters (4 32-bit numbers)
+ *              which is the minimum for the XXTEA algorithm.
+ *
+ * Inputs: std::string line - the line to be decrypted, from the file
+ *         bool* success - a bool pointer that can be set to return the
+ *                         success status.
+ * Output: std::string - the decrypted version of the input line.
+ */
+std::string FileHandler::decryptLine(std::string line, bool* success)
+{
+  /* Decrypt in the passed copy of the line, then trim it */
+  int length = -1;
+  if(!line.empty())
+    length = decryptBlock(&line[0], line.size(), &line[0]);
+
+  if(length >= 0)
+    line.resize(length);
+  else
+    line = "";
+
+  /* Set the success status determined above */
+  if(success != 0)
+    *success = (length >= 0);
+
+  return line;
+}
+
+/*
+ * Description: Encrypts a line of data. The line is padded to at least 16
+ *              characters (4 32-bit numbers), which is the minimum for the
+ *              XXTEA algorithm, and to a multiple of 4 characters so it can be
+ *              packed into 32-bit numbers. The words are encrypted in place
+ *              and each byte is written as two characters.
+ *
+ * Inputs: std::string line - the line to be encrypted, from the file
+ *         bool* success - a bool pointer that can be set to return the
+ *                         success status.
+ * Output: std::string - the encrypted version of the input line.
+ */
+std::string FileHandler::encryptLine(std::string line, bool* success)
+{
+  int length = line.size();
+  int padding_length = 0;
+
+  /* Padding to the minimum length and to whole words */
+  if(length < kMIN_LINE)
+    padding_length = kMIN_LINE - length;
+  else if(length % kASCII_IN_LONG != 0)
+    padding_length = kASCII_IN_LONG - length % kASCII_IN_LONG;
+
+  /* Pack the characters and padding into the reused word array */
+  int word_length = (length + padding_length) / kASCII_IN_LONG;
+  if(crypt_words.size() < static_cast<uint32_t>(word_length))
+    crypt_words.resize(word_length);
+  for(int i = 0; i < word_length; i++)
+  {
+    uint32_t word = 0;
+    for(int j = 0; j < kASCII_IN_LONG; j++)
+    {
+      int index = i * kASCII_IN_LONG + j;
+      int value = kPADDING_ASCII + index - length;
+      if(index < length)
+        value = line[index];
+      word = (word << kLONG_BIT_SHIFT) | (value & kLONG_BUFFER);
+    }
+    crypt_words[i] = word;
+  }
+
+  /* Encrypt and write each byte as two characters */
+  std::string encrypted_line = "";
+  bool status = Xxtea::encrypt(crypt_words.data(), word_length);
+  if(status)
+  {
+    encrypted_line.resize(word_length * kASCII_IN_LONG * 2);
+    for(int i = 0; i < word_length * kASCII_IN_LONG; i++)
+    {
+      int value = (crypt_words[i / kASCII_IN_LONG] >>
+                   ((kASCII_IN_LONG - 1 - i % kASCII_IN_LONG) *
+                    kLONG_BIT_SHIFT)) & kLONG_BUFFER;
+      encrypted_line[i * 2] =
+          ((value >> kINT_BIT_SHIFT) & kINT_BUFFER) + kENCRYPTION_PAD;
+      encrypted_line[i * 2 + 1] = (value & kINT_BUFFER) + kENCRYPTION_PAD;
+    }
+  }
+  else
+  {
+    std::cerr << "[ERROR] Invalid data from file for line encrypt."
+              << std::endl;
+  }
+
+  /* Set the success status determined above */
+  if(success != 0)
+   *success = status;
+
+  return encrypted_line;
+}
+
 /*
  * Description: Finds the element sequence defined in the XmlData set (not
  *              including the data entry). If the element does not exist, it
@@ -1109,7 +1001,8 @@ bool FileHandler::xmlWriteEnd()
  *         bool save_location - save found element location to active
  * Output: tinyxml2::XMLNode* - the found node location. NULL if failed
  */
-tinyxml2::XMLNode* FileHandler::findElement(XmlData data, bool save_location)
+tinyxml2::XMLNode* FileHandler::findElement(const XmlData& data,
+                                            bool save_location)
 {
   tinyxml2::XMLNode* node = nullptr;
 
@@ -1269,7 +1162,8 @@ bool FileHandler::isWriteEnabled()
  *         bool save_location - save found element location to active
  * Output: tinyxml2::XMLNode* - the found node location. NULL if failed
  */
-tinyxml2::XMLNode* FileHandler::purgeElement(XmlData data, bool save_location)
+tinyxml2::XMLNode* FileHandler::purgeElement(const XmlData& data,
+                                             bool save_location)
 {
   /* Find the node to purge */
   tinyxml2::XMLNode* node = findElement(data, save_location);
@@ -1392,6 +1286,51 @@ XmlData FileHandler::readXmlData(bool* done, bool* success)
   return data;
 }
 
+/*
+ * Description: Splits the children of the root element of the file into
+ *              sections of raw text, in document order, without parsing their
+ *              leaves. See XmlStream::sections(). The text views are into the
+ *              streamed source and are only valid until stop().
+ *
+ * Inputs: std::string root - the name of the top level root element
+ *         std::vector<XmlSectionView>& sections - the found sections
+ * Output: bool - true if the file split without error
+ */
+bool FileHandler::readXmlSections(std::string root,
+                                  std::vector<XmlSectionView>& sections)
+{
+  if(!available || file_type != XML || file_write || !stream_enabled)
+    return false;
+
+  return XmlStream::sections(stream_data, root, sections);
+}
+
+/*
+ * Description: Streams every XML data leaf of the file to the visitor, in
+ *              document order, without the DOM walk of readXmlData(). The
+ *              date at the top of the file is skipped, as per xmlToHead().
+ *              The source is read again from the start on each call.
+ *
+ * Inputs: const std::function<bool(const XmlLeaf&)>& visitor - called per
+ *             leaf. Returns false to stop the read early
+ * Output: bool - true if the file streamed without error
+ */
+bool FileHandler::readXmlStream(
+    const std::function<bool(const XmlLeaf&)>& visitor)
+{
+  bool first = true;
+
+  if(!available || file_type != XML || file_write || !stream_enabled)
+    return false;
+
+  return XmlStream::parse(stream_data, [&](const XmlLeaf& leaf) {
+    bool is_date = first && leaf.getNumElements() == 1 &&
+                   leaf.getElement(0) == "date";
+    first = false;
+    return is_date || visitor(leaf);
+  });
+}
+
 /*
  * Description: Saves the current write set to the file. This will not close
  *              the document and just returns if the save was successful.
@@ -1412,15 +1351,26 @@ bool FileHandler::save()
     date_data.addElement("date");
     writeXmlDataSet(date_data);
 
-    /* Handle ending of XML file type is XML */
+    /* Handle ending of XML file type is XML. The file is only opened now,
+     * so building the document did not touch the disk */
     if(file_type == XML)
-      success &= xmlWriteEnd();
+    {
+      if(!file_stream.is_open())
+      {
+        success &= setTempFileName() && fileOpen();
+        if(success && encryption_enabled)
+          success &= writeLine(checksum.digest(), true);
+      }
 
-    /* MD5 write - if encryption is enabled */
+      if(success)
+        success &= xmlWriteEnd();
+    }
+
+    /* Checksum write - if encryption is enabled */
     if(encryption_enabled)
     {
       topOfFile();
-      success &= writeLine(MD5::compute(file_data), true);
+      success &= writeLine(checksum.digest(), true);
     }
 
     /* If successful, process temporary file */
@@ -1495,6 +1445,25 @@ bool FileHandler::setFileType(FileType type)
   return false;
 }
 
+/*
+ * Description: Sets if XML reads are streamed. A streamed read keeps the
+ *              decrypted source and hands its leaves to readXmlStream()
+ *              instead of parsing it into a document, so readXmlData() and
+ *              getCount() have nothing to return. Only read mode streams.
+ *
+ * Inputs: bool enable - true to stream the XML reads
+ * Output: bool - if the set was successful. Fails if the class is running
+ */
+bool FileHandler::setStreamEnabled(bool enable)
+{
+  if(!available)
+  {
+    stream_enabled = enable;
+    return true;
+  }
+  return false;
+}
+
 /*
  * Description: Sets if the class is being used for reading or writing.
  *
@@ -1535,19 +1504,22 @@ bool FileHandler::start(bool read_before_write)
     if(available)
       success &= stop(true);
 
-    /* Clear the file data array */
-    file_data.clear();
+    /* Restart the checksum - new files use the 64 bit hash */
+    checksum.reset(ChecksumType::HASH64);
 
-    /* If file_write, determine temporary file name */
-    if(file_write)
+    /* If file_write, determine temporary file name. An XML write only
+     * builds its document until save(), which opens the file */
+    bool file_open = !(file_write && file_type == XML);
+    if(file_write && file_open)
       success &= setTempFileName();
 
-    /* If the system is in read and encryption, check validity of file */
-    if(!file_write && encryption_enabled)
-      success &= readMd5();
+    /* If the system is in read and encryption, check validity of file. The
+     * XML bulk read checks it in the same pass as the read */
+    if(!file_write && encryption_enabled && file_type == REGULAR)
+      success &= readChecksum();
 
     /* Open the file stream */
-    if(success)
+    if(success && file_open)
       success &= fileOpen();
 
     /* Write the success status, if available */
@@ -1555,8 +1527,8 @@ bool FileHandler::start(bool read_before_write)
     {
       available = true;
 
-      /* For a readable file with encryption, first line is Md5 -> throw away */
-      if(!file_write && encryption_enabled)
+      /* For a readable file with encryption, first line is the checksum */
+      if(!file_write && encryption_enabled && file_type == REGULAR)
         readLine();
     }
 
@@ -1572,9 +1544,9 @@ bool FileHandler::start(bool read_before_write)
         xmlToTail();
     }
 
-    /* Write a blank MD5 sequence, if applicable */
-    if(success && file_write && encryption_enabled)
-      success &= writeLine(MD5::compute(file_data), true);
+    /* Write a placeholder checksum of the same length, if applicable */
+    if(success && file_write && encryption_enabled && file_open)
+      success &= writeLine(checksum.digest(), true);
 
     /* Write starting date, if applicable */
     if(success && file_write)
@@ -1646,6 +1618,7 @@ bool FileHandler::stop(bool failed)
   /* If file write, delete temporary */
   if(file_write)
     fileDelete(file_name_temp);
+  file_name_temp = "";
 
   /* Do the final clean up once everything is stopped */
   cleanUp();
@@ -1787,7 +1760,7 @@ bool FileHandler::writeXmlData(std::string element, uint32_t data)
  *         bool save_location - save found element location to active
  * Output: bool - true if successful
  */
-bool FileHandler::writeXmlDataSet(XmlData data, bool save_location)
+bool FileHandler::writeXmlDataSet(const XmlData& data, bool save_location)
 {
   if(data.getNumElements() > 0 && !data.isDataUnset())
   {
@@ -1963,6 +1936,75 @@ bool FileHandler::xmlToTail()
  * PUBLIC STATIC FUNCTIONS
  *===========================================================================*/
 
+/*
+ * Description: Copies the directory and everything within it to the new
+ *              directory, which is created if needed. Files that already
+ *              exist in the new directory are overwritten.
+ *
+ * Inputs: std::string old_dirname - the old directory to copy
+ *         std::string new_dirname - the new directory to copy to
+ * Output: bool - true if the copy occurred
+ */
+bool FileHandler::dirCopy(std::string old_dirname, std::string new_dirname)
+{
+  std::error_code error;
+
+  if(!dirExists(old_dirname))
+    return false;
+
+  std::filesystem::copy(old_dirname, new_dirname,
+                        std::filesystem::copy_options::recursive |
+                            std::filesystem::copy_options::overwrite_existing,
+                        error);
+  return !error;
+}
+
+/*
+ * Description: Creates the directory, along with any of its parents that do
+ *              not exist yet. An existing directory is a success.
+ *
+ * Inputs: std::string dirname - the directory to create
+ * Output: bool - true if the directory exists after the call
+ */
+bool FileHandler::dirCreate(std::string dirname)
+{
+  std::error_code error;
+
+  std::filesystem::create_directories(dirname, error);
+  return !error && dirExists(dirname);
+}
+
+/*
+ * Description: Deletes the directory and everything within it. Only works if
+ *              the directory already exists.
+ *
+ * Inputs: std::string dirname - the directory to delete
+ * Output: bool - status if deletion was successful
+ */
+bool FileHandler::dirDelete(std::string dirname)
+{
+  std::error_code error;
+
+  if(dirExists(dirname))
+  {
+    std::filesystem::remove_all(dirname, error);
+    return !error;
+  }
+  return false;
+}
+
+/*
+ * Description: Checks if the directory exists.
+ *
+ * Inputs: std::string dirname - the directory to check
+ * Output: bool - true if it exists and is a directory
+ */
+bool FileHandler::dirExists(std::string dirname)
+{
+  std::error_code error;
+  return std::filesystem::is_directory(dirname, error);
+}
+
 /*
  * Description: A function to copy a given file name to a new file name.
  *              The success depends on the overwrite flag and if the old file
@@ -2018,6 +2060,57 @@ bool FileHandler::fileExists(std::string filename)
   return (bool)test_file;
 }
 
+/*
+ * Description: Returns the 64 bit hash (see Checksum) of the file contents,
+ *              read in blocks. Identifies the contents of a file regardless
+ *              of when it was written.
+ *
+ * Inputs: std::string filename - the file to hash
+ *         uint64_t& hash - the content hash
+ * Output: bool - true if the file was read
+ */
+bool FileHandler::fileHash(std::string filename, uint64_t& hash)
+{
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!file.good())
+    return false;
+
+  Checksum check;
+  std::vector<char> block(kHASH_BLOCK);
+  while(file.read(block.data(), block.size()) || file.gcount() > 0)
+    check.update(block.data(), file.gcount());
+
+  hash = check.hash();
+  return !file.bad();
+}
+
+/*
+ * Description: Returns the size and modified time of the file, which together
+ *              identify the written version of the file for derived files
+ *              (packs) kept next to it. The time is in ticks of the file
+ *              clock, so it keeps the full resolution of the filesystem.
+ *
+ * Inputs: std::string filename - the file to check
+ *         uint64_t& size - the file size in bytes
+ *         int64_t& time - the modified time, in file clock ticks
+ * Output: bool - true if the file exists
+ */
+bool FileHandler::fileInfo(std::string filename, uint64_t& size, int64_t& time)
+{
+  std::error_code error;
+
+  uint64_t file_size = std::filesystem::file_size(filename, error);
+  if(error)
+    return false;
+  auto file_time = std::filesystem::last_write_time(filename, error);
+  if(error)
+    return false;
+
+  size = file_size;
+  time = file_time.time_since_epoch().count();
+  return true;
+}
+
 /*
  * Description: A file rename call to take an old filename and change it to a
  *              new filename. If the new filename already exists, the
@@ -8,6 +8,10 @@
  *              stored as a SDL_Texture which is used for rendering.
  ******************************************************************************/
 #include "Frame.h"
+#include "AssetPack.h"
+#include "TextureAtlas.h"
+#include "TextureRegistry.h"
+#include "ThreadPool.h"
 
 /* Private Constant Implementation - see header file for descriptions */
 const uint8_t Frame::kDEFAULT_ALPHA = 255;
@@ -15,6 +19,12 @@ const float Frame::kGREY_FOR_BLUE = 0.07;
 const float Frame::kGREY_FOR_GREEN = 0.71;
 const float Frame::kGREY_FOR_RED = 0.21;
 
+/* Static Implementation - see header file for descriptions */
+bool Frame::decode_atlas = true;
+bool Frame::decode_deferred = false;
+std::unordered_set<std::string> Frame::decode_keys;
+std::vector<FrameDecode*> Frame::decode_queue;
+
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -31,13 +41,17 @@ Frame::Frame()
   alpha = kDEFAULT_ALPHA;
   color_alpha = 0;
   color_mode = ColorMode::COLOR;
+  decode = nullptr;
   flip = SDL_FLIP_NONE;
   height = 0;
   next = nullptr;
   path = "";
   previous = nullptr;
+  rect_src = {0, 0, 0, 0};
+  rect_src_valid = false;
   texture = nullptr;
   texture_grey = nullptr;
+  texture_key = "";
   width = 0;
 }
 
@@ -92,6 +106,110 @@ Frame::~Frame()
   unsetTexture();
 }
 
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Sets the textures of an image that is already loaded, shared
+ *              with the other frames of the same image. The previous texture
+ *              must be unset.
+ *
+ * Inputs: const std::string& key - the image key of the cache
+ *         const TextureCacheEntry& shared - the shared textures
+ * Output: none
+ */
+void Frame::setShared(const std::string& key, const TextureCacheEntry& shared)
+{
+  texture = shared.texture;
+  texture_grey = shared.texture_grey;
+  texture_key = key;
+  height = shared.height;
+  rect_src = shared.rect;
+  rect_src_valid = shared.rect_valid;
+  width = shared.width;
+
+  setAlpha(alpha);
+}
+
+/*
+ * Description: Creates the texture, and the greyscale texture if decoded,
+ *              from the decoded image surfaces and frees the surfaces. Images
+ *              loaded with the map are packed into the texture atlas, if they
+ *              are small enough. The textures are added to the cache, for the
+ *              other frames of the same image. Main thread only, since it
+ *              creates textures with the renderer.
+ *
+ * Inputs: FrameDecode& image - the decoded image
+ * Output: bool - the success of creating the texture
+ */
+bool Frame::uploadImage(FrameDecode& image)
+{
+  bool success = true;
+
+  /* If successful, set the new texture */
+  if(image.surface != nullptr && image.renderer != nullptr)
+  {
+    TextureCacheEntry shared = {nullptr, nullptr, image.surface->w,
+                                image.surface->h, {0, 0, 0, 0}, false, 1};
+
+    /* Pack into the atlas or create the textures from the surfaces */
+    if(image.atlas)
+      shared.rect_valid =
+          TextureAtlas::add(image.renderer, image.surface, image.surface_grey,
+                            shared.rect, shared.texture, shared.texture_grey);
+    if(!shared.rect_valid)
+    {
+      shared.texture = TextureRegistry::createFromSurface(
+          image.renderer, image.surface, TextureSource::FRAME);
+      if(image.surface_grey != nullptr)
+        shared.texture_grey = TextureRegistry::createFromSurface(
+            image.renderer, image.surface_grey, TextureSource::FRAME_GREY);
+    }
+
+    /* The cache owns the textures */
+    if(shared.texture != nullptr)
+    {
+      TextureCache::add(image.key, shared);
+      setShared(image.key, shared);
+    }
+    else
+    {
+      texture_grey = shared.texture_grey;
+      height = shared.height;
+      width = shared.width;
+      setAlpha(alpha);
+    }
+  }
+  /* If the renderer is NULL, unload the surface */
+  else if(image.surface != nullptr)
+  {
+    if(!image.no_warnings)
+      std::cerr << "[WARNING] Renderer required to set texture in frame for \""
+                << image.path.c_str() << "\"" << std::endl;
+    success = false;
+  }
+  /* If the surface is unset, notify the terminal with the failed surface */
+  else
+  {
+    /* Otherwise, return failed success */
+    if(!image.no_warnings)
+      std::cerr << "[WARNING] Unable to load image \"" << image.path
+                << "\". SDL_image error: " << image.error << std::endl;
+    success = false;
+  }
+
+  /* Clean Up */
+  if(image.surface != nullptr)
+    SDL_FreeSurface(image.surface);
+  if(image.surface_grey != nullptr)
+    SDL_FreeSurface(image.surface_grey);
+  image.surface = nullptr;
+  image.surface_grey = nullptr;
+
+  return success;
+}
+
 /*=============================================================================
  * PUBLIC FUNCTIONS
  *============================================================================*/
@@ -317,11 +435,26 @@ int Frame::getWidth()
  */
 bool Frame::isTextureSet(bool grey_scale)
 {
+  if(decode != nullptr)
+    return (!grey_scale || decode->enable_greyscale);
   if(grey_scale)
     return (texture_grey != nullptr);
   return (texture != nullptr);
 }
 
+/*
+ * Description: Returns if the image of this frame is still being decoded,
+ *              under deferred loading. The texture and its size are set once
+ *              endDeferredLoad() is called.
+ *
+ * Inputs: none
+ * Output: bool - status if the image is pending upload
+ */
+bool Frame::isTexturePending()
+{
+  return (decode != nullptr);
+}
+
 /*
  * Description: Renders the stored image if it is set and with a viable renderer
  *              using the coordinates for location.
@@ -353,7 +486,24 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
     if(w > 0)
       rect.w = w;
 
-    /* Render and return status - based on status */
+    /* Packed frames render their rect of the atlas page. The given source
+     * rect is relative to the frame */
+    SDL_Rect atlas_rect;
+    if(rect_src_valid)
+    {
+      atlas_rect = rect_src;
+      if(src_rect != nullptr)
+      {
+        atlas_rect.x += src_rect->x;
+        atlas_rect.y += src_rect->y;
+        atlas_rect.w = src_rect->w;
+        atlas_rect.h = src_rect->h;
+      }
+      src_rect = &atlas_rect;
+    }
+
+    /* Render and return status - based on status. The textures may be
+     * shared with other frames, so the alpha is set on each render */
     /* -- GREYING : color bottom, grey top -- */
     if(color_mode == ColorMode::GREYING && color_alpha < alpha)
     {
@@ -415,6 +565,7 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
           SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_NONE);
         else
           SDL_SetTextureBlendMode(texture_grey, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(texture_grey, alpha);
         return (SDL_RenderCopyEx(renderer, texture_grey, src_rect, &rect, 0,
                                  nullptr, flip) == 0);
       }
@@ -428,6 +579,7 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
           SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
         else
           SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(texture, alpha);
         return (SDL_RenderCopyEx(renderer, texture, src_rect, &rect, 0, nullptr,
                                  flip) == 0);
       }
@@ -437,6 +589,33 @@ bool Frame::render(SDL_Renderer* renderer, int x, int y, int w, int h,
   return false;
 }
 
+/*
+ * Description: Adds the frame, as a quad of its atlas page, to the batch in
+ *              place of rendering it. Only color frames packed in the atlas
+ *              can be batched; render() is needed for the rest.
+ *
+ * Inputs: RenderBatch& batch - the batch to add to
+ *         int x - the x pixel location of the top left
+ *         int y - the y pixel location of the top left
+ *         int w - the width to render (in pixels). 0 for the frame width
+ *         int h - the height to render (in pixels). 0 for the frame height
+ *         SDL_Color color - the color modulation. The alpha is combined with
+ *                           the frame alpha
+ * Output: bool - true if added. False if the frame can not be batched
+ */
+bool Frame::renderBatch(RenderBatch& batch, int x, int y, int w, int h,
+                        SDL_Color color)
+{
+  if(!rect_src_valid || texture == nullptr || color_mode != ColorMode::COLOR)
+    return false;
+
+  SDL_Rect rect = {x, y, (w > 0) ? w : width, (h > 0) ? h : height};
+  color.a = color.a * alpha / 255;
+  batch.addQuad(texture, rect_src, rect, color, flip);
+
+  return true;
+}
+
 /*
  * Description: Sets the rendering alpha modification. Needs to be set for each
  *              texture as this just emulates the call to SDL.
@@ -583,127 +762,73 @@ bool Frame::setPrevious(Frame* previous)
 bool Frame::setTexture(std::string path, SDL_Renderer* renderer, uint16_t angle,
                        bool no_warnings, bool enable_greyscale)
 {
-  bool success = true;
-
-  /* Attempt to load the image */
-  SDL_Surface* loaded_surface = IMG_Load(path.c_str());
-
-  /* If successful, unset previous and set the new texture */
-  if(loaded_surface != nullptr && renderer != nullptr)
+  FrameDecode image;
+  image.angle = angle;
+  image.atlas = false;
+  image.enable_greyscale = enable_greyscale;
+  image.frame = this;
+  image.no_warnings = no_warnings;
+  image.path = path;
+  image.renderer = renderer;
+  image.surface = nullptr;
+  image.surface_grey = nullptr;
+  image.key = TextureCache::getKey(renderer, path, angle, enable_greyscale);
+
+  /* An image loaded by another frame shares its textures */
+  TextureCacheEntry shared;
+  if(renderer != nullptr && TextureCache::acquire(image.key, shared))
   {
-    /* Unset the previous texture */
     unsetTexture();
-
-    /* Set the path */
     this->path = path;
+    setShared(image.key, shared);
+    return true;
+  }
 
-    /* Angle surface modification - only works for %90 angles */
-    if(angle > 0 && loaded_surface->h == loaded_surface->w &&
-       loaded_surface->format->BytesPerPixel == 4)
+  /* Under deferred loading, a worker decodes the image and the textures are
+   * created in endDeferredLoad(). Only the file is checked for now */
+  if(decode_deferred && renderer != nullptr)
+  {
+    if(!AssetPack::exists(path))
     {
-      uint32_t* pixels = static_cast<uint32_t*>(loaded_surface->pixels);
-      std::vector<std::vector<uint32_t>> pixels_original;
-
-      /* Make a copy of the original pixels */
-      for(int i = 0; i < loaded_surface->h; i++)
-      {
-        std::vector<uint32_t> pixels_row;
-
-        for(int j = 0; j < loaded_surface->w; j++)
-          pixels_row.push_back(pixels[i * loaded_surface->w + j]);
-        pixels_original.push_back(pixels_row);
-      }
-
-      /* Shift the pixels */
-      for(uint32_t i = 0; i < pixels_original.size(); i++)
-      {
-        for(uint32_t j = 0; j < pixels_original[i].size(); j++)
-        {
-          int index = 0;
-
-          /* Do the shift, based on which angle to use */
-          if(angle == 90)
-            index = j * loaded_surface->w + (loaded_surface->h - i - 1);
-          else if(angle == 180)
-            index = (loaded_surface->w - i - 1) * loaded_surface->w +
-                    (loaded_surface->h - j - 1);
-          else if(angle == 270)
-            index = (loaded_surface->w - j - 1) * loaded_surface->w + i;
-
-          pixels[index] = pixels_original[i][j];
-        }
-      }
+      if(!no_warnings)
+        std::cerr << "[WARNING] Unable to load image \"" << path
+                  << "\". File not found" << std::endl;
+      return false;
     }
 
-    /* Create the texture from the surface */
-    texture = SDL_CreateTextureFromSurface(renderer, loaded_surface);
-    height = loaded_surface->h;
-    width = loaded_surface->w;
+    unsetTexture();
+    this->path = path;
 
-    /* Create the greyscale texture, if applicable */
-    if(enable_greyscale && loaded_surface->format->BytesPerPixel == 4)
+    /* An image pending for another frame is only decoded once. Map images
+     * are packed into the atlas when small enough, the core thumbnails are
+     * not. The decode is claimed by the worker or by endDeferredLoad(),
+     * whichever comes first */
+    image.atlas = decode_atlas;
+    decode = new FrameDecode(std::move(image));
+    FrameDecode* pending = decode;
+    if(decode_keys.insert(decode->key).second)
     {
-      SDL_Surface* grey_surface =
-          SDL_ConvertSurface(loaded_surface, loaded_surface->format, 0);
-
-      /* Change all the pixels to greyscale */
-      uint32_t* grey_pixels = static_cast<uint32_t*>(grey_surface->pixels);
-
-      /* Parse each pixel and modify it's value */
-      for(int i = 0; i < grey_surface->h; i++)
-      {
-        for(int j = 0; j < grey_surface->w; j++)
-        {
-          uint32_t* pixel = &grey_pixels[i * loaded_surface->w + j];
-
-          /* Get the color data */
-          SDL_Color color;
-          SDL_GetRGBA(*pixel, grey_surface->format, &color.r, &color.g,
-                      &color.b, &color.a);
-
-          /* Modify the color data -> to greyscale */
-          color.r = getGreyValue(color.r, color.g, color.b);
-          color.g = color.r;
-          color.b = color.r;
-
-          /* Insert the new color data */
-          *pixel = SDL_MapRGBA(grey_surface->format, color.r, color.g, color.b,
-                               color.a);
-        }
-      }
-
-      /* Create greyscale texture and then clean up */
-      texture_grey = SDL_CreateTextureFromSurface(renderer, grey_surface);
-      SDL_FreeSurface(grey_surface);
+      auto claimed = std::make_shared<std::atomic<bool>>(false);
+      decode->claimed = claimed;
+      decode->task = ThreadPool::getShared().submit([pending, claimed]() {
+        if(!claimed->exchange(true))
+          decodeImage(*pending);
+      });
     }
+    decode_queue.push_back(decode);
 
-    /* Finally, set the alpha rating */
-    setAlpha(alpha);
-
-    /* Clean Up */
-    SDL_FreeSurface(loaded_surface);
-  }
-  /* If the renderer is NULL, unload the surface */
-  else if(loaded_surface != nullptr)
-  {
-    SDL_FreeSurface(loaded_surface);
-    if(!no_warnings)
-      std::cerr << "[WARNING] Renderer required to set texture in frame for \""
-                << path.c_str() << "\"" << std::endl;
-    ;
-    success = false;
+    return true;
   }
-  /* If the surface is unset, notify the terminal with the failed surface */
-  else
+
+  /* Attempt to load the image, then unset previous and set the new texture */
+  decodeImage(image);
+  if(image.surface != nullptr && renderer != nullptr)
   {
-    /* Otherwise, return failed success */
-    if(!no_warnings)
-      std::cerr << "[WARNING] Unable to load image \"" << path
-                << "\". SDL_image error: " << IMG_GetError() << std::endl;
-    success = false;
+    unsetTexture();
+    this->path = path;
   }
 
-  return success;
+  return uploadImage(image);
 }
 
 /*
@@ -773,14 +898,28 @@ bool Frame::setTexture(SDL_Texture* texture)
  */
 void Frame::unsetTexture()
 {
+  /* Drop a pending image decode. It is freed in endDeferredLoad() */
+  if(decode != nullptr)
+    decode->frame = nullptr;
+  decode = nullptr;
+
+  /* Release shared textures, destroyed by the cache once unused */
+  if(texture_key != "" && TextureCache::release(texture_key))
+  {
+    texture = nullptr;
+    texture_grey = nullptr;
+  }
+  rect_src_valid = false;
+  texture_key = "";
+
   /* Delete main texture */
   if(texture != nullptr)
-    SDL_DestroyTexture(texture);
+    TextureRegistry::destroy(texture);
   texture = nullptr;
 
   /* Delete greyscale texture */
   if(texture_grey != nullptr)
-    SDL_DestroyTexture(texture_grey);
+    TextureRegistry::destroy(texture_grey);
   texture_grey = nullptr;
 
   /* Clear class parameters */
@@ -1028,10 +1167,177 @@ void Frame::renderTopFlatTriangle(uint16_t x1, uint16_t x2, uint16_t x3,
   }
 }
 
+/*
+ * Description: Decodes the image of the path to a surface, with the angle
+ *              rotation and the greyscale copy if enabled. Touches no
+ *              renderer state, so it is safe to call off the main thread.
+ *
+ * Inputs: FrameDecode& image - the image to decode. The surfaces are set
+ * Output: none
+ */
+void Frame::decodeImage(FrameDecode& image)
+{
+  /* Attempt to load the image */
+  SDL_Surface* loaded_surface = AssetPack::loadImage(image.path);
+  image.surface = loaded_surface;
+  image.surface_grey = nullptr;
+  if(loaded_surface == nullptr)
+  {
+    image.error = IMG_GetError();
+    return;
+  }
+
+  /* Angle surface modification - only works for %90 angles */
+  uint16_t angle = image.angle;
+  if(angle > 0 && loaded_surface->h == loaded_surface->w &&
+     loaded_surface->format->BytesPerPixel == 4)
+  {
+    uint32_t* pixels = static_cast<uint32_t*>(loaded_surface->pixels);
+    std::vector<std::vector<uint32_t>> pixels_original;
+
+    /* Make a copy of the original pixels */
+    for(int i = 0; i < loaded_surface->h; i++)
+    {
+      std::vector<uint32_t> pixels_row;
+
+      for(int j = 0; j < loaded_surface->w; j++)
+        pixels_row.push_back(pixels[i * loaded_surface->w + j]);
+      pixels_original.push_back(pixels_row);
+    }
+
+    /* Shift the pixels */
+    for(uint32_t i = 0; i < pixels_original.size(); i++)
+    {
+      for(uint32_t j = 0; j < pixels_original[i].size(); j++)
+      {
+        int index = 0;
+
+        /* Do the shift, based on which angle to use */
+        if(angle == 90)
+          index = j * loaded_surface->w + (loaded_surface->h - i - 1);
+        else if(angle == 180)
+          index = (loaded_surface->w - i - 1) * loaded_surface->w +
+                  (loaded_surface->h - j - 1);
+        else if(angle == 270)
+          index = (loaded_surface->w - j - 1) * loaded_surface->w + i;
+
+        pixels[index] = pixels_original[i][j];
+      }
+    }
+  }
+
+  /* Create the greyscale surface, if applicable */
+  if(image.enable_greyscale && loaded_surface->format->BytesPerPixel == 4)
+  {
+    SDL_Surface* grey_surface =
+        SDL_ConvertSurface(loaded_surface, loaded_surface->format, 0);
+    if(grey_surface == nullptr)
+      return;
+
+    /* Change all the pixels to greyscale */
+    uint32_t* grey_pixels = static_cast<uint32_t*>(grey_surface->pixels);
+
+    /* Parse each pixel and modify it's value */
+    for(int i = 0; i < grey_surface->h; i++)
+    {
+      for(int j = 0; j < grey_surface->w; j++)
+      {
+        uint32_t* pixel = &grey_pixels[i * loaded_surface->w + j];
+
+        /* Get the color data */
+        SDL_Color color;
+        SDL_GetRGBA(*pixel, grey_surface->format, &color.r, &color.g,
+                    &color.b, &color.a);
+
+        /* Modify the color data -> to greyscale */
+        color.r = getGreyValue(color.r, color.g, color.b);
+        color.g = color.r;
+        color.b = color.r;
+
+        /* Insert the new color data */
+        *pixel = SDL_MapRGBA(grey_surface->format, color.r, color.g, color.b,
+                             color.a);
+      }
+    }
+
+    image.surface_grey = grey_surface;
+  }
+}
+
 /*=============================================================================
  * PUBLIC STATIC FUNCTIONS
  *============================================================================*/
 
+/*
+ * Description: Starts deferred loading. Until endDeferredLoad(), each image
+ *              set with a renderer is only checked to exist and is then
+ *              decoded by the shared thread pool, while the caller carries
+ *              on parsing. The frame counts as set in the meantime.
+ *
+ * Inputs: bool atlas - should the small images be packed into the atlas
+ * Output: none
+ */
+void Frame::beginDeferredLoad(bool atlas)
+{
+  decode_atlas = atlas;
+  decode_deferred = true;
+}
+
+/*
+ * Description: Ends deferred loading. Each pending image is taken in the
+ *              order it was set and its textures are created on the calling
+ *              (main) thread, while the later images finish decoding. An
+ *              image no worker has started yet is decoded here rather than
+ *              waited on, so long tasks ahead of it in the pool do not hold
+ *              up the load. Images of frames deleted or reset in the
+ *              meantime are dropped.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Frame::endDeferredLoad()
+{
+  decode_deferred = false;
+
+  for(auto& image : decode_queue)
+  {
+    if(image->task.valid())
+    {
+      if(!image->claimed->exchange(true))
+        decodeImage(*image);
+      else
+        image->task.wait();
+    }
+
+    /* Images decoded for an earlier frame are shared from it. If it failed
+     * or the frame was dropped, the image is decoded here */
+    Frame* frame = image->frame;
+    if(frame != nullptr)
+    {
+      TextureCacheEntry shared;
+      frame->decode = nullptr;
+      if(TextureCache::acquire(image->key, shared))
+      {
+        frame->setShared(image->key, shared);
+      }
+      else
+      {
+        if(!image->task.valid())
+          decodeImage(*image);
+        frame->uploadImage(*image);
+      }
+    }
+
+    if(image->surface != nullptr)
+      SDL_FreeSurface(image->surface);
+    if(image->surface_grey != nullptr)
+      SDL_FreeSurface(image->surface_grey);
+    delete image;
+  }
+  decode_keys.clear();
+  decode_queue.clear();
+}
+
 /*
  * Description: Takes a series of coordinates and draws the line between all.
  *
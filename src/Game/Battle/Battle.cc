@@ -14,6 +14,8 @@
 ******************************************************************************/
 #include "Game/Battle/Battle.h"
 #include "Game/Battle/RenderElement.h"
+#include "Profiler.h"
+#include "TextureRegistry.h"
 
 /*=============================================================================
  * CONSTANTS - Battle Operations
@@ -1631,14 +1633,14 @@ void Battle::buildActionFrame(BattleActor* actor)
   /* Create main rendering texture */
   Frame* rendered_frame = new Frame();
   SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, width, height);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
 
   /* Create underlay rendering texture */
   SDL_Texture* texture2 =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, width, height);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
   SDL_SetTextureBlendMode(texture2, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture2);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -1662,7 +1664,7 @@ void Battle::buildActionFrame(BattleActor* actor)
   SDL_SetTextureAlphaMod(texture2, kACTION_COLOR_A);
   SDL_RenderCopyEx(renderer, texture2, nullptr, nullptr, 0.0, nullptr,
                    SDL_FLIP_NONE);
-  SDL_DestroyTexture(texture2);
+  TextureRegistry::destroy(texture2);
   texture2 = nullptr;
 
   /* Render top black border */
@@ -1721,8 +1723,8 @@ void Battle::buildEnemyBackdrop()
   /* Create rendering texture */
   Frame* rendered_frame = new Frame();
   SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, width, height);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -1833,8 +1835,8 @@ void Battle::buildInfoAlly(BattleActor* ally)
 
   /* Create rendering texture */
   SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, width, height);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -1908,8 +1910,8 @@ void Battle::buildInfoEnemy(BattleActor* enemy)
 
   /* Create rendering texture */
   SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, kINFO_W, kINFO_H);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, kINFO_W, kINFO_H);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -2048,6 +2050,7 @@ void Battle::createLay(std::string path, int32_t anim_time, Floatinate velocity,
 
 bool Battle::render()
 {
+  ProfileScope zone_scope(ProfileZone::BATTLE_RENDER);
   auto success = false;
 
   if(config && turn_state != TurnState::FINISHED)
@@ -3083,6 +3086,7 @@ void Battle::setNextTurnState()
 
 bool Battle::update(int32_t cycle_time)
 {
+  ProfileScope zone_scope(ProfileZone::BATTLE_UPDATE);
   // TODO: Cycle hack?
   if(cycle_time > 33)
     cycle_time = 16;
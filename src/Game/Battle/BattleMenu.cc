@@ -13,6 +13,7 @@
 * See .h file for TODOs
 *******************************************************************************/
 #include "Game/Battle/BattleMenu.h"
+#include "TextureRegistry.h"
 
 /*=============================================================================
  * CONSTANTS - Public (for use in Battle)
@@ -570,8 +571,8 @@ SDL_Texture* BattleMenu::createItemFrame(BattleItem* battle_item,
 
   /* Create rendering texture */
   SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, width, height);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -674,8 +675,8 @@ SDL_Texture* BattleMenu::createSkillFrame(BattleSkill* battle_skill,
 
   /* Create rendering texture */
   SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, width, height);
+      TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                              SDL_TEXTUREACCESS_TARGET, width, height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -1368,9 +1369,9 @@ bool BattleMenu::createItemFrames(uint32_t width_left, uint32_t width_right)
       text_height = t.getHeight() + kTYPE_MARGIN * 2;
 
     /* Create rendering texture */
-    SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, text_width, text_height);
+    SDL_Texture* texture = TextureRegistry::create(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        text_width, text_height);
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -1449,9 +1450,9 @@ bool BattleMenu::createSkillFrames(uint32_t width_left, uint32_t width_right)
       text_height = t.getHeight() + kTYPE_MARGIN * 2;
 
     /* Create rendering texture */
-    SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, text_width, text_height);
+    SDL_Texture* texture = TextureRegistry::create(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        text_width, text_height);
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
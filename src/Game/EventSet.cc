@@ -664,7 +664,7 @@ bool EventSet::isNoInteraction()
  *         int section_index - the map section where the event is defined
  * Output: bool - true if load was successful
  */
-bool EventSet::loadData(XmlData data, int file_index, int section_index)
+bool EventSet::loadData(const XmlData& data, int file_index, int section_index)
 {
   std::string category = data.getElement(file_index);
   std::string back_element = data.getAllElements().back();
@@ -2837,7 +2837,7 @@ void EventSet::unlockUsed(Locked& locked_state)
  *         int section_index - the map section where the event is defined
  * Output: none
  */
-void EventSet::updateConversation(Conversation* reference, XmlData data,
+void EventSet::updateConversation(Conversation* reference, const XmlData& data,
                                   int index, int section_index)
 {
   /* Only proceed if the reference convo is not NULL */
@@ -2875,7 +2875,7 @@ void EventSet::updateConversation(Conversation* reference, XmlData data,
  *         int section_index - the map section where the event is defined
  * Output: Event - the returned event after the load
  */
-Event EventSet::updateEvent(Event event, XmlData data, int file_index,
+Event EventSet::updateEvent(Event event, const XmlData& data, int file_index,
                             int section_index)
 {
   EventClassifier category = EventClassifier::NOEVENT;
@@ -3425,7 +3425,8 @@ Event EventSet::updateEventOneShot(Event event, bool one_shot)
  *         int file_index - the element reference index
  * Output: Locked - the updated locked struct
  */
-Locked EventSet::updateLocked(Locked locked_curr, XmlData data, int file_index)
+Locked EventSet::updateLocked(Locked locked_curr, const XmlData& data,
+                              int file_index)
 {
   LockedState state = LockedState::NONE;
   std::string state_str = data.getElement(file_index);
@@ -18,12 +18,17 @@
  *     everything else. Do it by multiplying the time elapsed.
  ******************************************************************************/
 #include "Game/Game.h"
+#include "Game/GameTables.h"
+#include "LoadReport.h"
+#include "TextureRegistry.h"
+#include "ThreadPool.h"
 
 /*=============================================================================
  * CONSTANTS
  *============================================================================*/
 
 const std::string Game::kSAVE_IMG_BACK = ".bmp";
+const std::string Game::kSAVE_MAPS_BACK = ".maps";
 const std::string Game::kSAVE_PATH_AUTO = "_auto";
 const std::string Game::kSAVE_PATH_BACK = ".save";
 const std::string Game::kSAVE_PATH_FRONT = "saves/slot";
@@ -58,6 +63,8 @@ Game::Game(Options* running_config)
   player_name = "Player";
   player_sex = Sex::FEMALE;
   save_slot = 0;
+  save_task_menu = false;
+  save_task_success = true;
 
   /* Set up map class */
   map_ctrl.setConfiguration(config);
@@ -78,6 +85,10 @@ Game::~Game()
   /* First, unload the game */
   unload();
 
+  /* Finish the base file pack, if it is being compiled */
+  if(pack_task.valid())
+    pack_task.wait();
+
   /* Clean config */
   config = nullptr;
 
@@ -730,6 +741,33 @@ std::vector<ItemData> Game::getItemData()
   return data_set;
 }
 
+/* Returns the load screen summary of the running game, as saved to the slot */
+Save Game::getSaveSummary(uint8_t slot)
+{
+  Save summary(slot, config);
+  summary.setDate(FileHandler::getCurrentDate());
+
+  /* Player data - as written to the core player data */
+  if(player_main != nullptr)
+  {
+    TimeStore play_time = player_main->getPlayTime();
+    summary.setCountCredits(player_main->getCredits());
+    summary.setCountSteps(player_main->getSteps());
+    summary.setTime(play_time.hours, play_time.minutes,
+                    play_time.milliseconds / 1000);
+
+    /* The level of the first sleuth member */
+    Party* sleuth = player_main->getSleuth();
+    if(sleuth != nullptr && sleuth->getMember(0) != nullptr)
+      summary.setCountLevel(sleuth->getMember(0)->getLevel());
+  }
+
+  if(map_ctrl.isLoaded())
+    summary.setMapName(map_ctrl.getName());
+
+  return summary;
+}
+
 /* Load game - main function call */
 bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
                 bool encryption, bool full_load)
@@ -739,6 +777,9 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
   /* Update the player step count */
   updatePlayerSteps();
 
+  /* The slot must be fully written before it is read */
+  saveWait();
+
   /* Ensure nothing is loaded - if full load is false, just unloads map */
   unload(full_load);
 
@@ -749,14 +790,25 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
   if(full_load)
     player_main = new Player();
 
-  /* Create the base file handler */
+  /* Start the per phase load report, if enabled */
+  LoadReport::start(base_file, map_lvl);
+
+  /* Create the base file handler. A current compiled pack is used instead */
+  GamePack pack_base;
   FileHandler fh_base(base_file, false, true, encryption);
-  success &= fh_base.start();
+  bool packed_base = pack_base.open(base_file);
+  fh_base.setStreamEnabled(true);
+  if(!packed_base)
+    success &= fh_base.start();
 
   /* Create the save slot file handler, if applicable */
-  FileHandler fh_slot(getSlotPath(slot, config->getBasePath()), false, true, encryption);
+  std::string slot_file = getSlotPath(slot, config->getBasePath());
+  GamePack pack_slot;
+  FileHandler fh_slot(slot_file, false, true, encryption);
   bool slot_valid = (slot > 0);
-  if(slot_valid)
+  bool packed_slot = slot_valid && pack_slot.open(slot_file);
+  fh_slot.setStreamEnabled(true);
+  if(slot_valid && !packed_slot)
     slot_valid &= fh_slot.start();
 
   /* Timer to calculate the game load time */
@@ -765,10 +817,52 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
   // std::cout << "1: " << success << std::endl;
 
   /* Core data first, if applicable */
+  bool packed_tables = false;
+  std::string tables_snapshot;
   if(success && full_load)
   {
+    LoadScope load_scope(LoadPhase::CORE_DATA);
+    CoreTables core_tables = {list_action, list_skill, list_set, list_class,
+                              list_race,   list_item,  list_person_base};
+
+    /* Core tables packed with the base file are restored as constructed and
+     * only the other core records are read. If they cannot be, the base file
+     * is read from the XML instead */
+    if(packed_base)
+    {
+      bool tables_read = pack_base.readTables(tables_snapshot);
+      packed_tables = tables_read && !tables_snapshot.empty();
+      if(!tables_read ||
+         (packed_tables &&
+          !GameTables(core_tables).restore(tables_snapshot, renderer)))
+      {
+        std::cerr << "[WARNING] Game pack core tables of \"" << base_file
+                  << "\" could not be restored" << std::endl;
+        removePersonBases();
+        removeItems();
+        removeClasses();
+        removeRaces();
+        removeSkillSets();
+        removeSkills();
+        removeActions();
+
+        pack_base.close();
+        packed_base = false;
+        packed_tables = false;
+        success &= fh_base.start();
+      }
+      tables_snapshot.clear();
+    }
+
     /* Base file */
-    success &= loadData(&fh_base, renderer, true, false);
+    if(packed_base)
+      success &= loadData(&pack_base, renderer, true, false);
+    else
+      success &= loadData(&fh_base, renderer, true, false);
+
+    /* Tables constructed from the records, for the pack compiled below */
+    if(success && !packed_tables)
+      GameTables(core_tables).snapshot(tables_snapshot);
 
     // std::cout << "2: " << success << std::endl;
 
@@ -779,7 +873,9 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
     // std::cout << "3: " << success << std::endl;
 
     /* Slot file */
-    if(slot_valid)
+    if(packed_slot)
+      success &= loadData(&pack_slot, renderer, true, true);
+    else if(slot_valid)
       success &= loadData(&fh_slot, renderer, true, true);
   }
 
@@ -793,18 +889,41 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
     /* Core item to map correlation */
     map_ctrl.setBaseItems(getItemData(), renderer);
 
+    /* The map images decode on the workers while the records are parsed and
+     * are uploaded as textures here, on the main thread, once all are read */
+    Sprite::beginDeferredLoad();
+
     /* Base file */
-    fh_base.xmlToHead();
-    success &= loadData(&fh_base, renderer, false, false, level);
+    if(packed_base)
+      success &= loadData(&pack_base, renderer, false, false, level);
+    else
+      success &= loadData(&fh_base, renderer, false, false, level);
 
     // std::cout << "5: " << success << std::endl;
 
-    /* Slot file */
-    if(slot_valid)
+    /* Slot file. A split save holds each visited map in its own file, so
+     * only the file of this map is read. Older saves hold all in one file */
+    if(slot_valid && FileHandler::dirExists(getSlotMapPath(slot_file)))
     {
-      fh_slot.xmlToHead();
-      success &= loadData(&fh_slot, renderer, false, true, level);
+      std::string slot_map_file = getSlotMapPath(slot_file, level);
+      FileHandler fh_slot_map(slot_map_file, false, true, encryption);
+      fh_slot_map.setStreamEnabled(true);
+      if(FileHandler::fileExists(slot_map_file))
+      {
+        success &= fh_slot_map.start();
+        if(success)
+        {
+          success &= loadData(&fh_slot_map, renderer, false, true, level);
+          success &= fh_slot_map.stop();
+        }
+      }
     }
+    else if(packed_slot)
+      success &= loadData(&pack_slot, renderer, false, true, level);
+    else if(slot_valid)
+      success &= loadData(&fh_slot, renderer, false, true, level);
+
+    Sprite::endDeferredLoad();
   }
 
   // std::cout << "6: " << success << std::endl;
@@ -813,15 +932,19 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
   event_handler.log("Game load time: " + std::to_string(t.elapsed()) + " s");
 
   /* Stop the handler */
-  success &= fh_base.stop();
-  if(slot_valid)
+  if(!packed_base)
+    success &= fh_base.stop();
+  if(slot_valid && !packed_slot)
     success &= fh_slot.stop();
 
   /* If the load was successful, proceed to clean-up */
   if(success)
   {
     /* Clean up map */
-    map_ctrl.loadDataFinish(renderer);
+    {
+      LoadScope load_scope(LoadPhase::MAP_FINISH);
+      map_ctrl.loadDataFinish(renderer);
+    }
     map_ctrl.disableInteraction(event_disable);
 
     if(player_main)
@@ -842,71 +965,112 @@ bool Game::load(std::string base_file, SDL_Renderer* renderer, uint8_t slot,
   if(full_load)
     loaded_core = success;
   loaded_sub = success;
+  LoadReport::loadEnd();
+
+  /* The base file had no current pack, or one without the core tables:
+   * compile it off the main thread with the tables constructed above, so the
+   * next start restores them from the pack */
+  bool pack_busy = pack_task.valid() &&
+                   pack_task.wait_for(std::chrono::seconds(0)) !=
+                       std::future_status::ready;
+  if(success && full_load && !pack_busy &&
+     (!packed_base || (!packed_tables && !tables_snapshot.empty())))
+  {
+    pack_task = ThreadPool::getShared().submit(
+        [base_file, encryption, tables = std::move(tables_snapshot)]() {
+          GamePack::compile(base_file, encryption, tables);
+        });
+  }
 
   return success;
 }
 
-/* Load game data */
+/* Load game data - streamed, one XmlData is refilled for every leaf */
 bool Game::loadData(FileHandler* fh, SDL_Renderer* renderer, bool core_data,
                     bool save_data, std::string level)
 {
   XmlData data;
-  bool done = false;
   int index = 0;
-  bool read_success = true;
   bool success = true;
 
-  do
-  {
-    /* Read set of XML data */
-    data = fh->readXmlData(&done, &read_success);
-    success &= read_success;
-
+  success &= fh->readXmlStream([&](const XmlLeaf& leaf) {
     /* Only proceed if inside game */
-    if(data.getElement(index) == "game")
+    if(leaf.getElementToken(index) == XmlToken::GAME)
     {
-      /* If core data load */
-      if(core_data)
-      {
-        /* General game data */
-        if(data.getElement(index + 1) == "core")
-        {
-          success &= loadData(data, index + 2, renderer, save_data);
-        }
-        /* Current Map Index */
-        else if(data.getElement(index + 1) == "currentmap" && save_data)
-        {
-          int new_level = data.getDataInteger(&success);
-          if(success && new_level >= 0)
-            map_lvl = new_level;
-        }
-      }
-      /* If map data load */
-      else
-      {
-        /* Map data */
-        if(data.getElement(index + 1) == "map" &&
-           data.getKeyValue(index + 1) == level)
-        {
-          success &= map_ctrl.loadData(data, index + 2, renderer, game_directory,
-                                       save_data);
-        }
-      }
+      leaf.toXmlData(data);
+      success &= loadDataRecord(data, renderer, core_data, save_data, level);
+    }
+    return true;
+  });
+
+  return success;
+}
+
+/* Load game data from a compiled pack - only the requested section is read */
+bool Game::loadData(GamePack* pack, SDL_Renderer* renderer, bool core_data,
+                    bool save_data, std::string level)
+{
+  std::vector<XmlData> records;
+  bool success = true;
+
+  if(core_data)
+    success &= pack->readCore(records);
+  else
+    success &= pack->readMap(level, records);
+
+  for(auto& data : records)
+    success &= loadDataRecord(data, renderer, core_data, save_data, level);
+
+  return success;
+}
+
+/* Load a single game data record, within the game element */
+bool Game::loadDataRecord(XmlData& data, SDL_Renderer* renderer,
+                          bool core_data, bool save_data, std::string level)
+{
+  int index = 0;
+  bool success = true;
+
+  /* If core data load */
+  if(core_data)
+  {
+    /* General game data */
+    if(data.getElementToken(index + 1) == XmlToken::CORE)
+    {
+      success &= loadData(data, index + 2, renderer, save_data);
+    }
+    /* Current Map Index */
+    else if(data.getElementToken(index + 1) == XmlToken::CURRENTMAP &&
+            save_data)
+    {
+      int new_level = data.getDataInteger(&success);
+      if(success && new_level >= 0)
+        map_lvl = new_level;
+    }
+  }
+  /* If map data load */
+  else
+  {
+    /* Map data */
+    if(data.getElementToken(index + 1) == XmlToken::MAP &&
+       data.getKeyValue(index + 1) == level)
+    {
+      success &= map_ctrl.loadData(data, index + 2, renderer, game_directory,
+                                   save_data);
     }
-  } while(!done); // && success); /* Success in loop?? */
+  }
 
   return success;
 }
 
 /* Load game specific data */
 // TODO: Comment
-bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Game::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                     bool from_save)
 {
   (void)from_save;//TODO
 
   bool success = true;
-  std::string element = data.getElement(index);
 
   /* ID index */
   int id = -1;
@@ -914,13 +1078,16 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
   if(!id_str.empty())
     id = std::stoi(id_str);
 
+  switch(data.getElementToken(index))
+  {
   /* ---- ACTIONS ---- */
-  if(element == "action")
+  case(XmlToken::ACTION):
   {
     addAction(data.getDataString());
+    break;
   }
   /* ---- BATTLE SCENES ---- */
-  else if(element == "battlescene")
+  case(XmlToken::BATTLESCENE):
   {
     /* Get edit scene */
     BattleScene* edit_scene = getBattleScene(id);
@@ -929,42 +1096,45 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
 
     /* Modify */
     *edit_scene = Helpers::updateScene(*edit_scene, data, index + 1, game_directory);
+    break;
   }
   /* ---- CLASSES ---- */
-  else if(element == "class")
+  case(XmlToken::CLASS):
   {
     Category* edit_class = getClass(id);
     if(edit_class == nullptr)
       edit_class = addClass(id);
 
     /* Data for class */
-    if(data.getElement(index + 1) == "skillset")
+    if(data.getElementToken(index + 1) == XmlToken::SKILLSET)
       edit_class->setSkills(getSkillSet(data.getDataInteger(&success)));
     else
       success &= edit_class->loadData(data, index + 1, renderer);
+    break;
   }
   /* ---- ITEMS ---- */
-  else if(element == "item")
+  case(XmlToken::ITEM):
   {
     Item* edit_item = getItem(id);
     if(edit_item == nullptr)
       edit_item = addItem(id);
 
     /* Data for skill */
-    if(data.getElement(index + 1) == "skill")
+    if(data.getElementToken(index + 1) == XmlToken::SKILL)
       edit_item->setUseSkill(getSkill(data.getDataInteger(&success)));
     else
       success &= edit_item->loadData(data, index + 1, renderer, game_directory);
+    break;
   }
   /* ---- PARTIES ---- */
-  else if(element == "party")
+  case(XmlToken::PARTY):
   {
     Party* edit_party = getParty(id);
     if(edit_party == nullptr)
       edit_party = addParty(id);
 
     /* Data for party */
-    if(data.getElement(index + 1) == "person")
+    if(data.getElementToken(index + 1) == XmlToken::PERSON)
     {
       std::string person_str = data.getDataString(&success);
       if(success)
@@ -981,11 +1151,11 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
         }
       }
     }
-    else if(data.getElement(index + 1) == "inventory" &&
+    else if(data.getElementToken(index + 1) == XmlToken::INVENTORY &&
             edit_party->getInventory() != nullptr)
     {
       /* Items */
-      if(data.getElement(index + 2) == "item")
+      if(data.getElementToken(index + 2) == XmlToken::ITEM)
       {
         std::string item_str = data.getDataString(&success);
         if(success)
@@ -1012,31 +1182,33 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
     {
       success &= edit_party->loadData(data, index + 1, renderer, game_directory);
     }
+    break;
   }
   /* ---- PERSONS ---- */
-  else if(element == "person")
+  case(XmlToken::PERSON):
   {
     Person* edit_person = getPersonBase(id);
     if(edit_person == nullptr)
       edit_person = addPersonBase(id);
 
     /* Data for person */
-    if(data.getElement(index + 1) == "class")
+    if(data.getElementToken(index + 1) == XmlToken::CLASS)
       edit_person->setClass(getClass(data.getDataInteger(&success)));
-    else if(data.getElement(index + 1) == "race")
+    else if(data.getElementToken(index + 1) == XmlToken::RACE)
       edit_person->setRace(getRace(data.getDataInteger(&success)));
     else
       success &= edit_person->loadData(data, index + 1, renderer, game_directory);
+    break;
   }
   /* ---- PLAYER ---- */
-  else if(element == "player")
+  case(XmlToken::PLAYER):
   {
     // TODO: Bubbies - FUTURE
     /* The base indicator for the person */
-    if(data.getElement(index + 3) == "base" &&
-       data.getElement(index + 2) == "person" &&
-       (data.getElement(index + 1) == "sleuth" ||
-        data.getElement(index + 1) == "bearacks"))
+    if(data.getElementToken(index + 3) == XmlToken::BASE &&
+       data.getElementToken(index + 2) == XmlToken::PERSON &&
+       (data.getElementToken(index + 1) == XmlToken::SLEUTH ||
+        data.getElementToken(index + 1) == XmlToken::BEARACKS))
     {
       int base_id = data.getDataInteger();
       std::string index_str = data.getKeyValue(index + 2);
@@ -1045,7 +1217,7 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
         int party_index = std::stoi(index_str);
         if(index >= 0)
         {
-          if(data.getElement(index + 1) == "sleuth")
+          if(data.getElementToken(index + 1) == XmlToken::SLEUTH)
             success &= addPersonToParty(player_main->getSleuth(), base_id,
                                         static_cast<uint32_t>(party_index));
           else
@@ -1055,10 +1227,10 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
       }
     }
     /* Inventory: Items */
-    else if(data.getElement(index + 3) == "item" &&
-            data.getElement(index + 2) == "inventory" &&
-            (data.getElement(index + 1) == "sleuth" ||
-             data.getElement(index + 1) == "bearacks"))
+    else if(data.getElementToken(index + 3) == XmlToken::ITEM &&
+            data.getElementToken(index + 2) == XmlToken::INVENTORY &&
+            (data.getElementToken(index + 1) == XmlToken::SLEUTH ||
+             data.getElementToken(index + 1) == XmlToken::BEARACKS))
     {
       std::string item_str = data.getDataString(&success);
       if(success)
@@ -1070,7 +1242,7 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
           int item_id = std::stoi(item_set.front());
           int item_count = std::stoi(item_set.back());
 
-          if(data.getElement(index + 1) == "sleuth")
+          if(data.getElementToken(index + 1) == XmlToken::SLEUTH)
             success &= addItemToInv(player_main->getSleuth()->getInventory(),
                                     item_id, item_count, true);
           else
@@ -1080,10 +1252,10 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
       }
     }
     /* The learned skills */
-    else if(data.getElement(index + 3) == "learned" &&
-            data.getElement(index + 2) == "person" &&
-            (data.getElement(index + 1) == "sleuth" ||
-             data.getElement(index + 1) == "bearacks"))
+    else if(data.getElementToken(index + 3) == XmlToken::LEARNED &&
+            data.getElementToken(index + 2) == XmlToken::PERSON &&
+            (data.getElementToken(index + 1) == XmlToken::SLEUTH ||
+             data.getElementToken(index + 1) == XmlToken::BEARACKS))
     {
       std::string index_str = data.getKeyValue(index + 2);
       std::string learn_str = data.getDataString();
@@ -1106,8 +1278,9 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
     {
       player_main->loadData(data, index + 1, renderer, game_directory);
     }
+    break;
   }
-  else if(element == "options")
+  case(XmlToken::OPTIONS):
   {
     std::cout << "Trying to load options data" << std::endl;
     if(config)
@@ -1115,45 +1288,48 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
       std::cout << "Loading options data" << std::endl;
       success &= config->loadData(data, index + 1);
     }
+    break;
   }
   /* ---- RACES ---- */
-  else if(element == "race")
+  case(XmlToken::RACE):
   {
     Category* edit_race = getRace(id);
     if(edit_race == nullptr)
       edit_race = addRace(id);
 
     /* Data for race */
-    if(data.getElement(index + 1) == "skillset")
+    if(data.getElementToken(index + 1) == XmlToken::SKILLSET)
       edit_race->setSkills(getSkillSet(data.getDataInteger(&success)));
     else
       success &= edit_race->loadData(data, index + 1, renderer);
+    break;
   }
   /* ---- SKILLS ---- */
-  else if(element == "skill")
+  case(XmlToken::SKILL):
   {
     Skill* edit_skill = getSkill(id);
     if(edit_skill == nullptr)
       edit_skill = addSkill(id);
 
     /* Data for skill */
-    if(data.getElement(index + 1) == "action")
+    if(data.getElementToken(index + 1) == XmlToken::ACTION)
       edit_skill->addAction(getAction(data.getDataInteger(&success)), false);
     else
       success &= edit_skill->loadData(data, index + 1, renderer, game_directory);
 
     /* Flag setup after changes */
     edit_skill->flagSetup();
+    break;
   }
   /* ---- SKILLSETS ---- */
-  else if(element == "skillset")
+  case(XmlToken::SKILLSET):
   {
     SkillSet* edit_set = getSkillSet(id);
     if(edit_set == nullptr)
       edit_set = addSkillSet(id);
 
     /* Data for skill set */
-    if(data.getElement(index + 1) == "skill")
+    if(data.getElementToken(index + 1) == XmlToken::SKILL)
     {
       std::string str_pair = data.getDataString(&success);
       if(success)
@@ -1169,9 +1345,13 @@ bool Game::loadData(XmlData data, int index, SDL_Renderer* renderer,
         }
       }
     }
+    break;
+  }
+  default:
+    break;
   }
 
-  // std::cout << "Core loadData: " << element << ","
+  // std::cout << "Core loadData: " << data.getElement(index) << ","
   //          << data.getElement(index + 1) << "." << success << std::endl;
   return success;
 }
@@ -1420,6 +1600,227 @@ void Game::pollEvents()
   event_handler.pollClear();
 }
 
+/* Reads the load screen information of a save slot by parsing the full save
+ * file. Returns false if the save does not exist or could not be opened */
+bool Game::readSaveSlot(Save& slot, std::string path, std::string path_img,
+                        bool encryption)
+{
+  /* Attempt to open the path with the file handling system */
+  FileHandler fh_slot(path, false, true, encryption);
+  if(!FileHandler::fileExists(path) || !fh_slot.start())
+    return false;
+
+  /* The snapshot path */
+  slot.setSnapshotPath(path_img);
+
+  /* The save date and time */
+  slot.setDate(fh_slot.getDate());
+
+  /* Parse the file for remaining information */
+  XmlData data;
+  bool done = false;
+  int index = 0;
+  bool read_success = true;
+  do
+  {
+    /* Read set of XML data */
+    data = fh_slot.readXmlData(&done, &read_success);
+    if(read_success)
+    {
+      /* Only proceed if inside game */
+      if(data.getElementToken(index) == XmlToken::GAME)
+      {
+        /* Core data */
+        if(data.getElementToken(index + 1) == XmlToken::CORE &&
+           data.getElementToken(index + 2) == XmlToken::PLAYER)
+        {
+          /* Credits */
+          if(data.getElement(index + 3) == "credits")
+          {
+            int credits = data.getDataInteger(&read_success);
+            if(read_success)
+              slot.setCountCredits(credits);
+          }
+          else if(data.getElementToken(index + 3) == XmlToken::NAME)
+          {
+            std::string name = data.getDataString(&read_success);
+
+            if(read_success)
+              slot.setCustomPlayerName(name);
+          }
+          /* Play time hours, minutes, seconds */
+          else if(data.getElement(index + 3) == "playtime")
+          {
+            int hours = slot.getTimeHours();
+            int minutes = slot.getTimeMinutes();
+            int seconds = slot.getTimeSeconds();
+
+            /* Read the time */
+            int new_time = data.getDataInteger(&read_success);
+
+            if(read_success)
+            {
+              /* Determine the time allocation */
+              if(data.getElement(index + 4) == "hours")
+                hours = new_time;
+              else if(data.getElement(index + 4) == "minutes")
+                minutes = new_time;
+              else if(data.getElement(index + 4) == "milliseconds")
+                seconds = (new_time / 1000);
+
+              /* Set to slot */
+              slot.setTime(hours, minutes, seconds);
+            }
+          }
+          else if(data.getElement(index + 3) == "sex")
+          {
+            std::string sex = data.getDataString(&read_success);
+
+            if(read_success)
+              slot.setCustomPlayerSex(Helpers::sexFromStr(sex));
+          }
+          /* Sleuth information */
+          else if(data.getElementToken(index + 3) == XmlToken::SLEUTH)
+          {
+            if(data.getElementToken(index + 4) == XmlToken::PERSON &&
+               data.getKeyValue(index + 4) == "0")
+            {
+              if(data.getElement(index + 5) == "level")
+              {
+                int level = data.getDataInteger(&read_success);
+                if(read_success && level >= 0)
+                  slot.setCountLevel(level);
+              }
+            }
+          }
+          /* Steps */
+          else if(data.getElement(index + 3) == "steps")
+          {
+            int steps = data.getDataInteger(&read_success);
+            if(read_success)
+              slot.setCountSteps(steps);
+          }
+        }
+        /* Current map name */
+        else if(data.getElement(index + 1) == "currentmapname")
+        {
+          std::string map_name = data.getDataString(&read_success);
+          if(read_success)
+            slot.setMapName(map_name);
+        }
+      }
+      /* The write token, for the summary */
+      else if(data.getElement(index) == "stamp")
+      {
+        std::string stamp = data.getDataString(&read_success);
+        if(read_success)
+          slot.setStamp(stamp);
+      }
+    }
+  } while(!done);
+
+  return true;
+}
+
+/* Splits a save of one file, which holds every visited map, into the slot file
+ * and a file per map. The map sections are moved as written, and the slot file
+ * keeps them until it is next written. Split saves are left as they are */
+bool Game::saveSplit(std::string save_path)
+{
+  std::string map_path = getSlotMapPath(save_path);
+  if(FileHandler::dirExists(map_path))
+    return true;
+  if(!FileHandler::dirCreate(map_path))
+    return false;
+  if(!FileHandler::fileExists(save_path))
+    return true;
+
+  /* Each game/map child goes to the file of its id */
+  FileHandler fh_slot(save_path, false, true, false);
+  std::vector<XmlSectionView> sections;
+  fh_slot.setStreamEnabled(true);
+  bool success = fh_slot.start() && fh_slot.readXmlSections("game", sections);
+  for(uint32_t i = 0; success && i < sections.size(); i++)
+  {
+    const std::string& id = sections[i].value;
+    if(sections[i].element == "map" && !id.empty() &&
+       id.find_first_not_of("0123456789") == std::string::npos)
+    {
+      std::ofstream file(getSlotMapPath(save_path, id).c_str(),
+                         std::ios::out | std::ios::binary | std::ios::trunc);
+      file << "<game>\n" << sections[i].text << "</game>\n";
+      file.close();
+      success &= !file.fail();
+    }
+  }
+  fh_slot.stop();
+
+  /* Left unsplit on failure, to try again on the next save */
+  if(!success)
+  {
+    std::cerr << "[ERROR] Unable to split the maps of save \"" << save_path
+              << "\"" << std::endl;
+    FileHandler::dirDelete(map_path);
+  }
+
+  return success;
+}
+
+/* Writes the files of a save from the documents built in the save handles.
+ * The slot is first copied from the old slot, if any, and split, and the
+ * snapshot image is copied in, if any. Runs on a worker for background saves,
+ * so it only touches the save handles and the passed in state */
+bool Game::saveWrite(std::string save_path, std::string old_path,
+                     std::string img_path, std::string img_copy_path,
+                     Save summary, bool failed)
+{
+  bool success = !failed;
+
+  /* The old slot is copied, along with its map files */
+  if(!old_path.empty() && FileHandler::fileExists(old_path))
+  {
+    success &= FileHandler::fileCopy(old_path, save_path, true);
+    FileHandler::dirDelete(getSlotMapPath(save_path));
+    if(FileHandler::dirExists(getSlotMapPath(old_path)))
+      success &= FileHandler::dirCopy(getSlotMapPath(old_path),
+                                      getSlotMapPath(save_path));
+  }
+
+  /* The save is split: the slot file holds the core data and each visited
+   * map has its own file. Only the slot file and the file of the running
+   * map are written. The other maps are unchanged since they were last
+   * saved (they are only changed while running) and are not touched */
+  if(success)
+    success &= saveSplit(save_path);
+
+  if(!img_copy_path.empty() && FileHandler::fileExists(img_copy_path))
+    FileHandler::fileCopy(img_copy_path, img_path, true);
+
+  /* The map file first, then the slot file that points to it */
+  if(save_map_handle.isAvailable())
+    success &= save_map_handle.stop(!success);
+  success &= save_handle.stop(!success);
+
+  /* The summary read by the load screen in place of the save */
+  if(success)
+    summary.saveSummary(save_path);
+
+  return success;
+}
+
+/* Waits for the background save write, if any. Returns its success */
+bool Game::saveWait()
+{
+  if(save_task.valid())
+  {
+    save_task.get();
+    if(!save_task_success)
+      std::cerr << "[ERROR] Background save write failed" << std::endl;
+  }
+
+  return save_task_success;
+}
+
 /* Remove functions for game objects */
 void Game::removeActions()
 {
@@ -1621,12 +2022,23 @@ void Game::updateMenuSaving()
   auto save_index = map_menu.getSaveIndex();
   auto save_state = map_menu.getMenuSaveState();
 
-  if(save_state == MenuSaveState::WRITE)
+  /* The titles are refreshed once the background write is done */
+  if(save_task_menu && !isSaving())
   {
-    save(save_index + 1, true);
+    save_task_menu = false;
     map_menu.setSaveData(getSaveData());
     map_menu.updateSaveTitles();
   }
+
+  if(save_state == MenuSaveState::WRITE)
+  {
+    save_task_menu = save(save_index + 1, true, true);
+    if(!save_task_menu)
+    {
+      map_menu.setSaveData(getSaveData());
+      map_menu.updateSaveTitles();
+    }
+  }
   else if(save_state == MenuSaveState::CLEAR)
   {
     saveClear(save_index + 1);
@@ -1907,11 +2319,16 @@ Game::GameMode Game::getMode()
   return mode;
 }
 
-/* Gets save data - used for rendering and information */
+/* Gets save data - used for rendering and information. The summary written
+ * with each save is read where current, otherwise the save is parsed and the
+ * summary rebuilt for the next time */
 std::vector<Save> Game::getSaveData(bool encryption)
 {
   std::vector<Save> save_set;
 
+  /* The slots are read as written */
+  saveWait();
+
   /* Go through all slots up to range and find data */
   for(uint8_t i = 1; i <= kSAVE_SLOT_MAX; i++)
   {
@@ -1919,139 +2336,10 @@ std::vector<Save> Game::getSaveData(bool encryption)
     std::string path_img = getSlotPath(i, config->getBasePath(), true);
     Save slot(i, config);
 
-    /* Attempt to open the path with the file handling system */
-    FileHandler fh_slot(path, false, true, encryption);
-    if(FileHandler::fileExists(path) && fh_slot.start())
-    {
-      /* The snapshot path */
+    if(slot.loadSummary(path))
       slot.setSnapshotPath(path_img);
-
-      /* The save date and time */
-      std::string save_date = fh_slot.getDate();
-      std::vector<std::string> split_date_time = Helpers::split(save_date, ' ');
-      if(split_date_time.size() == 2)
-      {
-        /* Year, Month, Day */
-        std::vector<std::string> split_date =
-            Helpers::split(split_date_time.front(), '/');
-        /* Hour, Minute, Second */
-        std::vector<std::string> split_time =
-            Helpers::split(split_date_time.back(), ':');
-        if(split_date.size() == 3 && split_time.size() == 3)
-        {
-          /* Try and complete the conversion to int and set in the slot */
-          try
-          {
-            int year = std::stoi(split_date[0]);
-            int month = std::stoi(split_date[1]);
-            int day = std::stoi(split_date[2]);
-            int hour = std::stoi(split_time[0]);
-            int minute = std::stoi(split_time[1]);
-            // int second = std::stoi(split_time[2]);
-            slot.setDate(year, month, day, hour, minute);
-          }
-          catch(std::exception& e)
-          {
-          }
-        }
-      }
-
-      /* Parse the file for remaining information */
-      XmlData data;
-      bool done = false;
-      int index = 0;
-      bool read_success = true;
-      do
-      {
-        /* Read set of XML data */
-        data = fh_slot.readXmlData(&done, &read_success);
-        if(read_success)
-        {
-          /* Only proceed if inside game */
-          if(data.getElement(index) == "game")
-          {
-            /* Core data */
-            if(data.getElement(index + 1) == "core" &&
-               data.getElement(index + 2) == "player")
-            {
-              /* Credits */
-              if(data.getElement(index + 3) == "credits")
-              {
-                int credits = data.getDataInteger(&read_success);
-                if(read_success)
-                  slot.setCountCredits(credits);
-              }
-              else if(data.getElement(index + 3) == "name")
-              {
-                std::string name = data.getDataString(&read_success);
-
-                if(read_success)
-                  slot.setCustomPlayerName(name);
-              }
-              /* Play time hours, minutes, seconds */
-              else if(data.getElement(index + 3) == "playtime")
-              {
-                int hours = slot.getTimeHours();
-                int minutes = slot.getTimeMinutes();
-                int seconds = slot.getTimeSeconds();
-
-                /* Read the time */
-                int new_time = data.getDataInteger(&read_success);
-
-                if(read_success)
-                {
-                  /* Determine the time allocation */
-                  if(data.getElement(index + 4) == "hours")
-                    hours = new_time;
-                  else if(data.getElement(index + 4) == "minutes")
-                    minutes = new_time;
-                  else if(data.getElement(index + 4) == "milliseconds")
-                    seconds = (new_time / 1000);
-
-                  /* Set to slot */
-                  slot.setTime(hours, minutes, seconds);
-                }
-              }
-              else if(data.getElement(index + 3) == "sex")
-              {
-                std::string sex = data.getDataString(&read_success);
-
-                if(read_success)
-                  slot.setCustomPlayerSex(Helpers::sexFromStr(sex));
-              }
-              /* Sleuth information */
-              else if(data.getElement(index + 3) == "sleuth")
-              {
-                if(data.getElement(index + 4) == "person" &&
-                   data.getKeyValue(index + 4) == "0")
-                {
-                  if(data.getElement(index + 5) == "level")
-                  {
-                    int level = data.getDataInteger(&read_success);
-                    if(read_success && level >= 0)
-                      slot.setCountLevel(level);
-                  }
-                }
-              }
-              /* Steps */
-              else if(data.getElement(index + 3) == "steps")
-              {
-                int steps = data.getDataInteger(&read_success);
-                if(read_success)
-                  slot.setCountSteps(steps);
-              }
-            }
-            /* Current map name */
-            else if(data.getElement(index + 1) == "currentmapname")
-            {
-              std::string map_name = data.getDataString(&read_success);
-              if(read_success)
-                slot.setMapName(map_name);
-            }
-          }
-        }
-      } while(!done);
-    }
+    else if(readSaveSlot(slot, path, path_img, encryption))
+      slot.saveSummary(path);
 
     save_set.push_back(slot);
   }
@@ -2059,6 +2347,13 @@ std::vector<Save> Game::getSaveData(bool encryption)
   return save_set;
 }
 
+/* Returns if a background save write is still running */
+bool Game::isSaving()
+{
+  return save_task.valid() && save_task.wait_for(std::chrono::seconds(0)) !=
+                                  std::future_status::ready;
+}
+
 /* Is the game core data loaded */
 bool Game::isLoadedCore()
 {
@@ -2296,6 +2591,7 @@ bool Game::render(SDL_Renderer* renderer)
   /* -- LOADING MODE -- */
   if(mode == LOADING)
   {
+    TextureRegistry::setOwner(TextureOwner::MAP);
     if(!isLoadedCore() || mode_load == FULLLOAD)
       load(renderer, true, save_slot);
     else
@@ -2306,11 +2602,14 @@ bool Game::render(SDL_Renderer* renderer)
   /* -- MAP MODE -- */
   if(mode == MAP)
   {
+    TextureRegistry::setOwner(TextureOwner::MAP);
     success = map_ctrl.render(renderer);
   }
   /* -- BATTLE MODE -- */
   else if(mode == BATTLE)
   {
+    TextureRegistry::setOwner(TextureOwner::BATTLE);
+
     /* Assign the rendererer to Battle and data container class */
     battle_display_data->setRenderer(renderer);
 
@@ -2327,19 +2626,26 @@ bool Game::render(SDL_Renderer* renderer)
   }
   else if(mode == MENU)
   {
+    TextureRegistry::setOwner(TextureOwner::MENU);
     map_ctrl.render(renderer);
     map_menu.setRenderer(renderer);
     map_menu.render();
   }
 
+  /* The first frame after a load completes the load report */
+  if(mode != LOADING && LoadReport::isActive())
+    LoadReport::finish();
+
   return success;
 }
 
 /* Save game based on the current slot number */
-bool Game::save(uint8_t slot, bool from_menu)
+bool Game::save(uint8_t slot, bool from_menu, bool background)
 {
   if(slot <= kSAVE_SLOT_MAX)
   {
+    /* The handle is free once the last background write is done */
+    saveWait();
     bool success = true;
 
     /* Get the proper save slot number and file name */
@@ -2355,15 +2661,14 @@ bool Game::save(uint8_t slot, bool from_menu)
     std::string save_path = getSlotPath(slot, config->getBasePath());
     std::string save_path_img = getSlotPath(slot, config->getBasePath(), true);
 
-    /* If the slot is different, the old data needs to be copied */
+    /* If the slot is different, the old data needs to be copied. It is
+     * copied along with the write, below */
+    std::string old_path = "";
     if(slot != save_slot && save_slot > 0)
-    {
-      std::string old_path = getSlotPath(save_slot, config->getBasePath());
-      if(FileHandler::fileExists(old_path))
-        success &= FileHandler::fileCopy(old_path, save_path, true);
-    }
+      old_path = getSlotPath(save_slot, config->getBasePath());
 
-    /* Start file write */
+    /* Start file write. Only the document is built until the write, so the
+     * files are not touched here */
     if(save_handle.isAvailable() && save_handle.getFilename() != save_path)
       save_handle.stop(true);
     if(!save_handle.isAvailable())
@@ -2372,18 +2677,18 @@ bool Game::save(uint8_t slot, bool from_menu)
       save_handle.setFilename(save_path);
       save_handle.setWriteEnabled(true);
       save_handle.setFileType(FileHandler::XML);
-      success &= save_handle.start(true);
+      success &= save_handle.start();
     }
 
     /* If handle is ready to go, proceed */
     if(save_handle.isAvailable() && success)
     {
-      /* If from menu, use auto save image */
+      /* If from menu, use auto save image. It is copied along with the
+       * write, below */
+      std::string save_auto_img = "";
       if(from_menu)
       {
-        std::string save_auto_img = getSlotPath(0, config->getBasePath(), true, true);
-        if(FileHandler::fileExists(save_auto_img))
-          FileHandler::fileCopy(save_auto_img, save_path_img, true);
+        save_auto_img = getSlotPath(0, config->getBasePath(), true, true);
       }
       /* Otherwise, generate it on the fly */
       else
@@ -2392,6 +2697,12 @@ bool Game::save(uint8_t slot, bool from_menu)
                        active_renderer);
       }
 
+      /* The write token, right after the date, shared with the summary */
+      std::string stamp = Save::createStamp();
+      XmlData data_stamp(stamp);
+      data_stamp.addElement("stamp");
+      save_handle.writeXmlDataSet(data_stamp);
+
       /* Setup the core data */
       XmlData data_core;
       data_core.addElement("game");
@@ -2425,18 +2736,43 @@ bool Game::save(uint8_t slot, bool from_menu)
         data_map_curr.addDataOfType(map_ctrl.getName());
         save_handle.writeXmlDataSet(data_map_curr);
 
-        /* Setup the map data */
+        /* Setup the map data, in the file of the map */
+        save_map_handle.setEncryptionEnabled(false);
+        save_map_handle.setFilename(
+            getSlotMapPath(save_path, std::to_string(map_lvl)));
+        save_map_handle.setWriteEnabled(true);
+        save_map_handle.setFileType(FileHandler::XML);
+        success &= save_map_handle.start();
+
         XmlData data_map;
         data_map.addElement("game");
         data_map.addElement("map", "id", std::to_string(map_lvl));
-        save_handle.purgeElement(data_map, true);
+        save_map_handle.purgeElement(data_map, true);
 
         /* Write the map data */
-        success &= map_ctrl.saveData(&save_handle);
+        success &= map_ctrl.saveData(&save_map_handle);
       }
 
-      /* Finish the file write */
-      save_handle.stop(!success);
+      /* Finish the file write. The documents written above are the snapshot
+       * of the state. In background, a worker does all the file work from
+       * them while the game keeps running */
+      Save summary = getSaveSummary(slot);
+      summary.setStamp(stamp);
+      bool failed = !success;
+      if(background)
+      {
+        save_task = ThreadPool::getShared().submit(
+            [this, save_path, old_path, save_path_img, save_auto_img, summary,
+             failed]() {
+              save_task_success = saveWrite(save_path, old_path, save_path_img,
+                                            save_auto_img, summary, failed);
+            });
+      }
+      else
+      {
+        success &= saveWrite(save_path, old_path, save_path_img,
+                             save_auto_img, summary, failed);
+      }
     }
 
     /* If success, save slot */
@@ -2451,6 +2787,8 @@ bool Game::save(uint8_t slot, bool from_menu)
 /* Clears the passed in save slot number */
 bool Game::saveClear(uint8_t slot)
 {
+  saveWait();
+
   /* Ensure the slot is in range */
   if(slot <= kSAVE_SLOT_MAX)
   {
@@ -2466,6 +2804,16 @@ bool Game::saveClear(uint8_t slot)
       if(FileHandler::fileExists(save_path))
         success &= FileHandler::fileDelete(save_path);
 
+      /* Delete the summary, if it exists */
+      std::string summary_path = Save::getSummaryPath(delete_path);
+      if(FileHandler::fileExists(summary_path))
+        success &= FileHandler::fileDelete(summary_path);
+
+      /* Delete the map files, if they exist */
+      std::string map_path = getSlotMapPath(delete_path);
+      if(FileHandler::dirExists(map_path))
+        success &= FileHandler::dirDelete(map_path);
+
       return success;
     }
   }
@@ -2550,6 +2898,12 @@ void Game::setPlayerSex(Sex player_sex)
 }
 
 
+/* Sets the render interpolation progress (0.0 - 1.0) between update ticks */
+void Game::setRenderAlpha(float alpha)
+{
+  map_ctrl.setRenderAlpha(alpha);
+}
+
 /* Sets the active renderer to be used */
 void Game::setRenderer(SDL_Renderer* renderer)
 {
@@ -2591,8 +2945,11 @@ void Game::unloadCore()
   removeAll();
   loaded_core = false;
 
+  saveWait();
   if(save_handle.isAvailable())
     save_handle.stop(true);
+  if(save_map_handle.isAvailable())
+    save_map_handle.stop(true);
 }
 
 /* Unloads the sub map data of the game */
@@ -2622,6 +2979,8 @@ bool Game::update(int32_t cycle_time)
   /* MAP MODE */
   if(mode == MAP)
   {
+    TextureRegistry::setOwner(TextureOwner::MAP);
+
     /* Add play time */
     if(player_main != nullptr)
       player_main->addPlayTime(cycle_time);
@@ -2639,6 +2998,8 @@ bool Game::update(int32_t cycle_time)
   /* BATTLE MODE */
   else if(mode == BATTLE && battle_ctrl)
   {
+    TextureRegistry::setOwner(TextureOwner::BATTLE);
+
     /* Add play time */
     if(player_main != nullptr)
       player_main->addPlayTime(cycle_time);
@@ -2755,6 +3116,17 @@ std::string Game::getSlotPath(uint8_t slot, std::string base_path, bool image,
   return save_path;
 }
 
+/* Static: Returns the path of the map file of the save for the level. With no
+ * level, the directory of the map files is returned */
+std::string Game::getSlotMapPath(std::string save_path, std::string level)
+{
+  std::string map_path = save_path + kSAVE_MAPS_BACK;
+
+  if(!level.empty())
+    map_path += "/map" + level + kSAVE_PATH_BACK;
+  return map_path;
+}
+
 /* Saves screenshot of the current game as it stands - as a BMP */
 bool Game::saveScreenshot(std::string path, SDL_Rect rect,
                           SDL_Renderer* renderer, uint8_t factor)
@@ -0,0 +1,913 @@
+/*******************************************************************************
+ * Class Name: GameTables
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Binary snapshot of the core tables of a game, as constructed
+ *              from the base file: the actions, skills, skill sets, classes,
+ *              races, items and base persons. The snapshot is stored in the
+ *              pack of the base file (see GamePack), so the next start
+ *              restores the objects directly instead of building them again
+ *              from the records.
+ ******************************************************************************/
+#include "Game/GameTables.h"
+
+#include <cstring>
+#include <type_traits>
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t GameTables::kVERSION = 1;
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructor function - binds the tables to write or read.
+ *
+ * Inputs: CoreTables tables - the core tables of the game
+ */
+GameTables::GameTables(CoreTables tables)
+    : pos{0}, renderer{nullptr}, tables(tables), valid{true}
+{
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Appends an integer, bool or enum value in little endian order,
+ *              at its own size.
+ *
+ * Inputs: T value - the value
+ * Output: none
+ */
+template <typename T> void GameTables::put(T value)
+{
+  uint64_t raw = static_cast<uint64_t>(value);
+  for(uint8_t i = 0; i < sizeof(T); i++)
+    buffer.push_back(static_cast<char>((raw >> (i * 8)) & 0xFF));
+}
+
+/*
+ * Description: Appends a float value, by its bits.
+ *
+ * Inputs: float value - the value
+ * Output: none
+ */
+void GameTables::put(float value)
+{
+  uint32_t raw = 0;
+  std::memcpy(&raw, &value, sizeof(raw));
+  put(raw);
+}
+
+/*
+ * Description: Appends a double value, by its bits.
+ *
+ * Inputs: double value - the value
+ * Output: none
+ */
+void GameTables::put(double value)
+{
+  uint64_t raw = 0;
+  std::memcpy(&raw, &value, sizeof(raw));
+  put(raw);
+}
+
+/*
+ * Description: Appends a string, prefixed with its 32 bit length.
+ *
+ * Inputs: const std::string& value - the string
+ * Output: none
+ */
+void GameTables::put(const std::string& value)
+{
+  put(static_cast<uint32_t>(value.size()));
+  buffer.append(value);
+}
+
+/*
+ * Description: Reads an integer, bool or enum value, as written by put(). A
+ *              value past the end of the snapshot reads as zero and leaves
+ *              the snapshot invalid.
+ *
+ * Inputs: T& value - the read value
+ * Output: none
+ */
+template <typename T> void GameTables::take(T& value)
+{
+  /* Enums are converted through their underlying type, to keep the sign */
+  using Raw = typename std::conditional<std::is_enum<T>::value,
+                                        std::underlying_type<T>,
+                                        std::common_type<T>>::type::type;
+  uint64_t raw = 0;
+
+  if(!valid || pos + sizeof(T) > buffer.size())
+  {
+    valid = false;
+    value = static_cast<T>(0);
+    return;
+  }
+
+  for(uint8_t i = 0; i < sizeof(T); i++)
+    raw |= static_cast<uint64_t>(static_cast<uint8_t>(buffer[pos + i]))
+           << (i * 8);
+  pos += sizeof(T);
+  value = static_cast<T>(static_cast<Raw>(raw));
+}
+
+/*
+ * Description: Reads a float value, as written by put().
+ *
+ * Inputs: float& value - the read value
+ * Output: none
+ */
+void GameTables::take(float& value)
+{
+  uint32_t raw = 0;
+  take(raw);
+  std::memcpy(&value, &raw, sizeof(value));
+}
+
+/*
+ * Description: Reads a double value, as written by put().
+ *
+ * Inputs: double& value - the read value
+ * Output: none
+ */
+void GameTables::take(double& value)
+{
+  uint64_t raw = 0;
+  take(raw);
+  std::memcpy(&value, &raw, sizeof(value));
+}
+
+/*
+ * Description: Reads a length prefixed string, as written by put().
+ *
+ * Inputs: std::string& value - the read string
+ * Output: none
+ */
+void GameTables::take(std::string& value)
+{
+  uint32_t length = takeCount(1);
+  if(valid)
+  {
+    value.assign(buffer, pos, length);
+    pos += length;
+  }
+}
+
+/*
+ * Description: Reads an element count. A count of more elements than the
+ *              rest of the snapshot can hold reads as zero and leaves the
+ *              snapshot invalid, so a corrupt count allocates nothing.
+ *
+ * Inputs: uint32_t bytes - the least bytes each element takes
+ * Output: uint32_t - the element count
+ */
+uint32_t GameTables::takeCount(uint32_t bytes)
+{
+  uint32_t count = 0;
+  take(count);
+  if(valid && static_cast<uint64_t>(count) * bytes > buffer.size() - pos)
+    valid = false;
+
+  return valid ? count : 0;
+}
+
+/*
+ * Description: Appends a reference to an object of the table, as its index
+ *              + 1. An object outside the table leaves the snapshot invalid.
+ *
+ * Inputs: T* object - the referenced object. Null for none
+ *         const std::vector<T*>& table - the table of the object
+ * Output: none
+ */
+template <typename T>
+void GameTables::putRef(T* object, const std::vector<T*>& table)
+{
+  uint32_t index = 0;
+
+  if(object != nullptr)
+  {
+    auto found = refs.find(object);
+    if(found != refs.end() && found->second < table.size() &&
+       table[found->second] == object)
+      index = found->second + 1;
+    else
+      valid = false;
+  }
+
+  put(index);
+}
+
+/*
+ * Description: Reads a reference to an object of the table, as written by
+ *              putRef(). The objects of the table must all exist.
+ *
+ * Inputs: T*& object - the referenced object. Null for none
+ *         const std::vector<T*>& table - the table of the object
+ * Output: none
+ */
+template <typename T>
+void GameTables::takeRef(T*& object, const std::vector<T*>& table)
+{
+  uint32_t index = 0;
+  take(index);
+
+  object = nullptr;
+  if(index > table.size())
+    valid = false;
+  else if(index > 0)
+    object = table[index - 1];
+}
+
+/*
+ * Description: Appends an attribute set.
+ *
+ * Inputs: const AttributeSet& set - the attribute set
+ * Output: none
+ */
+void GameTables::putAttributes(const AttributeSet& set)
+{
+  put(set.flags);
+  put(static_cast<uint32_t>(set.values.size()));
+  for(auto& value : set.values)
+    put(value);
+}
+
+/*
+ * Description: Appends a frame, by the path of its image.
+ *
+ * Inputs: Frame* frame - the frame. Null for none
+ * Output: none
+ */
+void GameTables::putFrame(Frame* frame)
+{
+  put(frame != nullptr);
+  if(frame != nullptr)
+    put(frame->getPath());
+}
+
+/*
+ * Description: Appends a skill set owned by its object, with its elements.
+ *
+ * Inputs: SkillSet* set - the skill set. Null for none
+ * Output: none
+ */
+void GameTables::putSet(SkillSet* set)
+{
+  put(set != nullptr);
+  if(set != nullptr)
+    putSetElements(*set);
+}
+
+/*
+ * Description: Appends the id and the elements of a skill set. The skills are
+ *              references into the skill table.
+ *
+ * Inputs: const SkillSet& set - the skill set
+ * Output: none
+ */
+void GameTables::putSetElements(const SkillSet& set)
+{
+  put(static_cast<int32_t>(set.id));
+  put(static_cast<uint32_t>(set.skill_elements.size()));
+  for(auto& element : set.skill_elements)
+  {
+    putRef(element.skill, tables.skills);
+    put(static_cast<uint32_t>(element.level_available));
+    put(element.enabled);
+    put(element.silenced);
+  }
+}
+
+/*
+ * Description: Appends a sprite, by its render settings and build data. A
+ *              sprite already built has frames in place of the build data,
+ *              and leaves the snapshot invalid.
+ *
+ * Inputs: Sprite* sprite - the sprite. Null for none
+ * Output: none
+ */
+void GameTables::putSprite(Sprite* sprite)
+{
+  put(sprite != nullptr);
+  if(sprite != nullptr)
+  {
+    valid &= !sprite->built_texture;
+
+    put(sprite->animation_time);
+    put(sprite->brightness);
+    put(sprite->color_red);
+    put(sprite->color_green);
+    put(sprite->color_blue);
+    put(sprite->opacity);
+    put(sprite->rotation_angle);
+    put(sprite->sequence);
+    put(sprite->sound_id);
+
+    put(static_cast<uint32_t>(sprite->data.size()));
+    for(auto& build : sprite->data)
+    {
+      put(build.build_path_head);
+      put(build.build_frames);
+      put(build.build_path_tail);
+    }
+  }
+}
+
+/*
+ * Description: Reads an attribute set, as written by putAttributes().
+ *
+ * Inputs: AttributeSet& set - the read attribute set
+ * Output: none
+ */
+void GameTables::takeAttributes(AttributeSet& set)
+{
+  take(set.flags);
+  set.values.resize(takeCount(sizeof(int32_t)));
+  for(auto& value : set.values)
+    take(value);
+}
+
+/*
+ * Description: Reads a frame, as written by putFrame(), and sets its image.
+ *              The image is decoded by the workers during the restore.
+ *
+ * Inputs: Frame*& frame - the frame. Created if read and null
+ * Output: none
+ */
+void GameTables::takeFrame(Frame*& frame)
+{
+  bool present = false;
+  take(present);
+  if(present)
+  {
+    std::string path;
+    take(path);
+
+    if(frame == nullptr)
+      frame = new Frame();
+    if(valid && !path.empty())
+      valid &= frame->setTexture(path, renderer);
+  }
+}
+
+/*
+ * Description: Reads a skill set owned by its object, as written by
+ *              putSet(). A set not written is deleted.
+ *
+ * Inputs: SkillSet*& set - the skill set. Created if read and null
+ * Output: none
+ */
+void GameTables::takeSet(SkillSet*& set)
+{
+  bool present = false;
+  take(present);
+  if(present)
+  {
+    if(set == nullptr)
+      set = new SkillSet();
+    takeSetElements(*set);
+  }
+  else if(set != nullptr)
+  {
+    delete set;
+    set = nullptr;
+  }
+}
+
+/*
+ * Description: Reads the id and the elements of a skill set, as written by
+ *              putSetElements().
+ *
+ * Inputs: SkillSet& set - the read skill set
+ * Output: none
+ */
+void GameTables::takeSetElements(SkillSet& set)
+{
+  int32_t id = 0;
+  take(id);
+  set.id = id;
+
+  set.skill_elements.resize(takeCount(10));
+  for(auto& element : set.skill_elements)
+  {
+    uint32_t level_available = 0;
+    takeRef(element.skill, tables.skills);
+    take(level_available);
+    take(element.enabled);
+    take(element.silenced);
+    element.level_available = level_available;
+  }
+}
+
+/*
+ * Description: Reads a sprite, as written by putSprite(). Only the build data
+ *              is set, so the sprite is built on its first render.
+ *
+ * Inputs: Sprite*& sprite - the sprite. Created if read and null
+ * Output: none
+ */
+void GameTables::takeSprite(Sprite*& sprite)
+{
+  bool present = false;
+  take(present);
+  if(present)
+  {
+    uint16_t animation_time = 0;
+    double brightness = 0;
+    uint8_t red = 0, green = 0, blue = 0, opacity = 0;
+    float rotation_angle = 0;
+    Sequencer sequence = FORWARD;
+    int32_t sound_id = 0;
+
+    take(animation_time);
+    take(brightness);
+    take(red);
+    take(green);
+    take(blue);
+    take(opacity);
+    take(rotation_angle);
+    take(sequence);
+    take(sound_id);
+
+    if(sprite == nullptr)
+      sprite = new Sprite();
+    sprite->setAnimationTime(animation_time);
+    sprite->setBrightness(brightness);
+    sprite->setColorBalance(red, green, blue);
+    sprite->setOpacity(opacity);
+    sprite->setRotation(rotation_angle);
+    sprite->sequence = sequence;
+    sprite->setSoundID(sound_id);
+
+    sprite->data.resize(takeCount(12));
+    for(auto& build : sprite->data)
+    {
+      take(build.build_path_head);
+      take(build.build_frames);
+      take(build.build_path_tail);
+    }
+  }
+}
+
+/*
+ * Description: Appends an action.
+ *
+ * Inputs: const Action& action - the action
+ * Output: none
+ */
+void GameTables::putAction(const Action& action)
+{
+  put(action.action_flags);
+  put(action.target_attribute);
+  put(action.user_attribute);
+  put(action.ailment);
+  put(action.base);
+  put(action.chance);
+  put(action.id);
+  put(action.ignore_atk);
+  put(action.ignore_def);
+  put(static_cast<int32_t>(action.min_duration));
+  put(static_cast<int32_t>(action.max_duration));
+  put(action.variance);
+}
+
+/*
+ * Description: Appends a class or race category. The skill set is a reference
+ *              into the skill set table.
+ *
+ * Inputs: const Category& category - the category
+ * Output: none
+ */
+void GameTables::putCategory(const Category& category)
+{
+  putAttributes(category.base_stats);
+  putAttributes(category.top_stats);
+  put(category.cat_flags);
+  put(category.description);
+  put(category.denonym);
+  put(category.name);
+  put(category.qtdr_regen_rate);
+  put(category.vita_regen_rate);
+  putRef(category.skill_set, tables.skill_sets);
+  put(category.id);
+
+  put(static_cast<uint32_t>(category.immunities.size()));
+  for(auto& immunity : category.immunities)
+    put(immunity);
+}
+
+/*
+ * Description: Appends a base item. An item with a base, signature, skill set
+ *              or sound has no place in the snapshot and leaves it invalid.
+ *
+ * Inputs: const Item& item - the item
+ * Output: none
+ */
+void GameTables::putItem(const Item& item)
+{
+  valid &= (item.base_item == nullptr && item.base_skill_set == nullptr &&
+            item.equip_signature == nullptr && item.using_sound == nullptr);
+
+  put(item.game_id);
+  putAttributes(item.buff_set);
+  put(item.brief_description);
+  put(item.description);
+  put(item.composition);
+  put(item.max_durability);
+  put(item.durability);
+  put(item.flags);
+  put(item.item_tier);
+  put(item.mass);
+  put(item.name);
+  put(item.prefix);
+  put(item.occasion);
+  putFrame(item.thumbnail);
+  putRef(item.using_skill, tables.skills);
+  putSprite(item.using_animation);
+  put(item.using_message);
+  put(item.value);
+  put(item.value_modifier);
+}
+
+/*
+ * Description: Appends a base person. The class and race are references into
+ *              their tables. A person with a base or an AI module leaves the
+ *              snapshot invalid.
+ *
+ * Inputs: const Person& person - the person
+ * Output: none
+ */
+void GameTables::putPerson(const Person& person)
+{
+  valid &= (person.base_person == nullptr && person.ai_module == nullptr);
+
+  put(person.action_x);
+  put(person.action_y);
+  put(person.game_id);
+  put(person.person_flags);
+  putRef(person.battle_class, tables.classes);
+  putRef(person.race_class, tables.races);
+  put(person.name);
+  put(person.name_display);
+  put(person.rank);
+  put(person.primary);
+  put(person.secondary);
+  put(person.primary_curve);
+  put(person.secondary_curve);
+
+  putAttributes(person.base_stats);
+  putAttributes(person.base_max_stats);
+  putAttributes(person.curr_stats);
+  putAttributes(person.curr_max_stats);
+  putAttributes(person.temp_max_stats);
+
+  putSet(person.base_skills);
+  putSet(person.curr_skills);
+  putSet(person.learned_skills);
+
+  put(person.dmg_mod);
+  put(person.exp_mod);
+  put(static_cast<uint32_t>(person.item_drops.size()));
+  for(auto& item_drop : person.item_drops)
+    put(item_drop);
+  put(person.credit_drop);
+  put(person.exp_drop);
+  put(person.level);
+  put(person.total_exp);
+
+  putSprite(person.sprite_ally);
+  putSprite(person.sprite_ally_defensive);
+  putSprite(person.sprite_ally_offensive);
+  putSprite(person.sprite_dialog);
+  putSprite(person.sprite_face);
+  putSprite(person.sprite_foe);
+  putSprite(person.sprite_foe_defensive);
+  putSprite(person.sprite_foe_offensive);
+}
+
+/*
+ * Description: Appends a skill. The effects are references into the action
+ *              table.
+ *
+ * Inputs: const Skill& skill - the skill
+ * Output: none
+ */
+void GameTables::putSkill(const Skill& skill)
+{
+  put(skill.id);
+  putSprite(skill.animation);
+  put(skill.chance);
+  put(skill.cooldown);
+  put(skill.cost);
+  put(skill.description);
+
+  put(static_cast<uint32_t>(skill.effects.size()));
+  for(auto& effect : skill.effects)
+    putRef(effect, tables.actions);
+
+  put(skill.flags);
+  put(skill.message);
+  put(skill.name);
+  put(skill.primary);
+  put(skill.scope);
+  put(skill.secondary);
+  put(skill.sound_id);
+  putFrame(skill.thumbnail);
+  put(skill.value);
+}
+
+/*
+ * Description: Reads an action, as written by putAction().
+ *
+ * Inputs: Action& action - the read action
+ * Output: none
+ */
+void GameTables::takeAction(Action& action)
+{
+  int32_t min_duration = 0, max_duration = 0;
+
+  take(action.action_flags);
+  take(action.target_attribute);
+  take(action.user_attribute);
+  take(action.ailment);
+  take(action.base);
+  take(action.chance);
+  take(action.id);
+  take(action.ignore_atk);
+  take(action.ignore_def);
+  take(min_duration);
+  take(max_duration);
+  take(action.variance);
+
+  action.min_duration = min_duration;
+  action.max_duration = max_duration;
+}
+
+/*
+ * Description: Reads a class or race category, as written by putCategory().
+ *
+ * Inputs: Category& category - the read category
+ * Output: none
+ */
+void GameTables::takeCategory(Category& category)
+{
+  takeAttributes(category.base_stats);
+  takeAttributes(category.top_stats);
+  take(category.cat_flags);
+  take(category.description);
+  take(category.denonym);
+  take(category.name);
+  take(category.qtdr_regen_rate);
+  take(category.vita_regen_rate);
+  takeRef(category.skill_set, tables.skill_sets);
+  take(category.id);
+
+  category.immunities.resize(takeCount(sizeof(Infliction)));
+  for(auto& immunity : category.immunities)
+    take(immunity);
+}
+
+/*
+ * Description: Reads a base item, as written by putItem().
+ *
+ * Inputs: Item& item - the read item
+ * Output: none
+ */
+void GameTables::takeItem(Item& item)
+{
+  take(item.game_id);
+  takeAttributes(item.buff_set);
+  take(item.brief_description);
+  take(item.description);
+  take(item.composition);
+  take(item.max_durability);
+  take(item.durability);
+  take(item.flags);
+  take(item.item_tier);
+  take(item.mass);
+  take(item.name);
+  take(item.prefix);
+  take(item.occasion);
+  takeFrame(item.thumbnail);
+  takeRef(item.using_skill, tables.skills);
+  takeSprite(item.using_animation);
+  take(item.using_message);
+  take(item.value);
+  take(item.value_modifier);
+}
+
+/*
+ * Description: Reads a base person, as written by putPerson(). The skill sets
+ *              the constructor created are reused, or deleted if not written.
+ *
+ * Inputs: Person& person - the read person
+ * Output: none
+ */
+void GameTables::takePerson(Person& person)
+{
+  take(person.action_x);
+  take(person.action_y);
+  take(person.game_id);
+  take(person.person_flags);
+  takeRef(person.battle_class, tables.classes);
+  takeRef(person.race_class, tables.races);
+  take(person.name);
+  take(person.name_display);
+  take(person.rank);
+  take(person.primary);
+  take(person.secondary);
+  take(person.primary_curve);
+  take(person.secondary_curve);
+
+  takeAttributes(person.base_stats);
+  takeAttributes(person.base_max_stats);
+  takeAttributes(person.curr_stats);
+  takeAttributes(person.curr_max_stats);
+  takeAttributes(person.temp_max_stats);
+
+  takeSet(person.base_skills);
+  takeSet(person.curr_skills);
+  takeSet(person.learned_skills);
+
+  take(person.dmg_mod);
+  take(person.exp_mod);
+  person.item_drops.resize(takeCount(sizeof(uint32_t)));
+  for(auto& item_drop : person.item_drops)
+    take(item_drop);
+  take(person.credit_drop);
+  take(person.exp_drop);
+  take(person.level);
+  take(person.total_exp);
+
+  takeSprite(person.sprite_ally);
+  takeSprite(person.sprite_ally_defensive);
+  takeSprite(person.sprite_ally_offensive);
+  takeSprite(person.sprite_dialog);
+  takeSprite(person.sprite_face);
+  takeSprite(person.sprite_foe);
+  takeSprite(person.sprite_foe_defensive);
+  takeSprite(person.sprite_foe_offensive);
+}
+
+/*
+ * Description: Reads a skill, as written by putSkill().
+ *
+ * Inputs: Skill& skill - the read skill
+ * Output: none
+ */
+void GameTables::takeSkill(Skill& skill)
+{
+  take(skill.id);
+  takeSprite(skill.animation);
+  take(skill.chance);
+  take(skill.cooldown);
+  take(skill.cost);
+  take(skill.description);
+
+  skill.effects.resize(takeCount(sizeof(uint32_t)));
+  for(auto& effect : skill.effects)
+    takeRef(effect, tables.actions);
+
+  take(skill.flags);
+  take(skill.message);
+  take(skill.name);
+  take(skill.primary);
+  take(skill.scope);
+  take(skill.secondary);
+  take(skill.sound_id);
+  takeFrame(skill.thumbnail);
+  take(skill.value);
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Restores the tables from the snapshot. Every object of every
+ *              table is created first, then their fields are read and the
+ *              references fixed up. The thumbnail images are decoded by the
+ *              workers meanwhile and uploaded at the end. On failure, the
+ *              objects created so far stay in the tables for the caller to
+ *              remove.
+ *
+ * Inputs: const std::string& snapshot - the snapshot, as written by
+ *                                       snapshot(). May be zero padded
+ *         SDL_Renderer* renderer - the renderer of the thumbnails
+ * Output: bool - true if the snapshot was current and complete
+ */
+bool GameTables::restore(const std::string& snapshot, SDL_Renderer* renderer)
+{
+  uint32_t version = 0;
+
+  buffer = snapshot;
+  pos = 0;
+  this->renderer = renderer;
+  valid = true;
+
+  take(version);
+  valid &= (version == kVERSION);
+
+  /* Objects first, so the references resolve while the fields are read */
+  uint32_t count_actions = takeCount(1);
+  uint32_t count_skills = takeCount(1);
+  uint32_t count_sets = takeCount(1);
+  uint32_t count_classes = takeCount(1);
+  uint32_t count_races = takeCount(1);
+  uint32_t count_items = takeCount(1);
+  uint32_t count_persons = takeCount(1);
+  if(valid)
+  {
+    for(uint32_t i = 0; i < count_actions; i++)
+      tables.actions.push_back(new Action());
+    for(uint32_t i = 0; i < count_skills; i++)
+      tables.skills.push_back(new Skill());
+    for(uint32_t i = 0; i < count_sets; i++)
+      tables.skill_sets.push_back(new SkillSet());
+    for(uint32_t i = 0; i < count_classes; i++)
+      tables.classes.push_back(new Category());
+    for(uint32_t i = 0; i < count_races; i++)
+      tables.races.push_back(new Category());
+    for(uint32_t i = 0; i < count_items; i++)
+      tables.items.push_back(new Item());
+    for(uint32_t i = 0; i < count_persons; i++)
+      tables.persons.push_back(new Person());
+  }
+
+  /* Then the fields */
+  Frame::beginDeferredLoad(false);
+  for(uint32_t i = 0; valid && i < count_actions; i++)
+    takeAction(*tables.actions[i]);
+  for(uint32_t i = 0; valid && i < count_skills; i++)
+    takeSkill(*tables.skills[i]);
+  for(uint32_t i = 0; valid && i < count_sets; i++)
+    takeSetElements(*tables.skill_sets[i]);
+  for(uint32_t i = 0; valid && i < count_classes; i++)
+    takeCategory(*tables.classes[i]);
+  for(uint32_t i = 0; valid && i < count_races; i++)
+    takeCategory(*tables.races[i]);
+  for(uint32_t i = 0; valid && i < count_items; i++)
+    takeItem(*tables.items[i]);
+  for(uint32_t i = 0; valid && i < count_persons; i++)
+    takePerson(*tables.persons[i]);
+  Frame::endDeferredLoad();
+
+  buffer.clear();
+  return valid;
+}
+
+/*
+ * Description: Writes the snapshot of the tables. Fails, with no snapshot,
+ *              if any object holds state the snapshot has no place for.
+ *
+ * Inputs: std::string& snapshot - the written snapshot
+ * Output: bool - true if the snapshot was written
+ */
+bool GameTables::snapshot(std::string& snapshot)
+{
+  auto index = [&](const auto& table) {
+    for(uint32_t i = 0; i < table.size(); i++)
+      refs[table[i]] = i;
+    put(static_cast<uint32_t>(table.size()));
+  };
+
+  buffer.clear();
+  refs.clear();
+  valid = true;
+
+  put(kVERSION);
+  index(tables.actions);
+  index(tables.skills);
+  index(tables.skill_sets);
+  index(tables.classes);
+  index(tables.races);
+  index(tables.items);
+  index(tables.persons);
+
+  for(auto& action : tables.actions)
+    putAction(*action);
+  for(auto& skill : tables.skills)
+    putSkill(*skill);
+  for(auto& skill_set : tables.skill_sets)
+    putSetElements(*skill_set);
+  for(auto& battle_class : tables.classes)
+    putCategory(*battle_class);
+  for(auto& race : tables.races)
+    putCategory(*race);
+  for(auto& item : tables.items)
+    putItem(*item);
+  for(auto& person : tables.persons)
+    putPerson(*person);
+
+  if(valid)
+    snapshot.swap(buffer);
+  buffer.clear();
+  refs.clear();
+  return valid;
+}
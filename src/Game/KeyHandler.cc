@@ -77,7 +77,7 @@ const int32_t KeyHandler::kMIN_HELD_TIME = 100;
  *
  * Inputs: none
  */
-KeyHandler::KeyHandler() : mode{KeyMode::INPUT}
+KeyHandler::KeyHandler() : mode{KeyMode::INPUT}, state_injection{false}
 {
   loadDefaults();
 }
@@ -121,7 +121,11 @@ void KeyHandler::updateKey(Key& key, int32_t cycle_time, KeyMode call_mode)
   auto bp_keycode_prim = getKey(GameKey::BACKSPACE).keycode_prim;
   auto bp_keycode_secd = getKey(GameKey::BACKSPACE).keycode_secd;
 
-  auto state = SDL_GetKeyboardState(nullptr);
+  const uint8_t* state = nullptr;
+  if(state_injection)
+    state = state_injected.data();
+  else
+    state = SDL_GetKeyboardState(nullptr);
 
   if(state)
   {
@@ -371,6 +375,53 @@ bool KeyHandler::isKeycodeMappedSecd(SDL_Keycode keycode)
   return false;
 }
 
+/*
+ * Description: Injects a key press or release into the injected keyboard
+ *              state and pushes the matching SDL key event on the queue, so it
+ *              is handled the same as a physical key. Used by the headless
+ *              benchmark to drive scripted input.
+ *
+ * Inputs: SDL_Keycode keycode - the key to press or release
+ *         bool pressed - true if the key is now depressed
+ * Output: none
+ */
+void KeyHandler::injectEvent(SDL_Keycode keycode, bool pressed)
+{
+  SDL_KeyboardEvent event;
+  SDL_zero(event);
+  event.type = pressed ? SDL_KEYDOWN : SDL_KEYUP;
+  event.state = pressed ? SDL_PRESSED : SDL_RELEASED;
+  event.keysym.sym = keycode;
+  event.keysym.scancode = SDL_GetScancodeFromKey(keycode);
+  injectEvent(event);
+}
+
+/*
+ * Description: Injects a full keyboard event (ex. one replayed by the
+ *              KeyRecorder) into the injected keyboard state and pushes it on
+ *              the SDL queue. Injected events have no window ID (0), which
+ *              separates them from physical key events.
+ *
+ * Inputs: SDL_KeyboardEvent key_event - the key event to inject
+ * Output: none
+ */
+void KeyHandler::injectEvent(SDL_KeyboardEvent key_event)
+{
+  SDL_Scancode scan_code = key_event.keysym.scancode;
+
+  if(state_injected.size() < SDL_NUM_SCANCODES)
+    state_injected.resize(SDL_NUM_SCANCODES, 0);
+  if(scan_code > SDL_SCANCODE_UNKNOWN && scan_code < SDL_NUM_SCANCODES)
+    state_injected[scan_code] = (key_event.state == SDL_PRESSED) ? 1 : 0;
+
+  SDL_Event event;
+  SDL_zero(event);
+  event.key = key_event;
+  event.key.windowID = 0;
+  event.type = key_event.type;
+  SDL_PushEvent(&event);
+}
+
 /*
  * Description: Resets the KeyHandler to a default set of key mapping and
  *              depressed states.
@@ -689,6 +740,20 @@ bool KeyHandler::unsetKey(GameKey game_key, bool* found)
   return found;
 }
 
+/*
+ * Description: Sets if the injected key state (see injectEvent) is used in
+ *              place of the physical keyboard state.
+ *
+ * Inputs: bool enabled - true to use the injected state
+ * Output: none
+ */
+void KeyHandler::setInjection(bool enabled)
+{
+  state_injection = enabled;
+  if(state_injected.size() < SDL_NUM_SCANCODES)
+    state_injected.resize(SDL_NUM_SCANCODES, 0);
+}
+
 /*
  * Description:
  *
@@ -0,0 +1,341 @@
+/*******************************************************************************
+ * Class Name: KeyRecorder
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Records and replays the keyboard input of a session, beneath
+ *              the KeyHandler. Every SDL_KeyboardEvent is stored with the
+ *              update tick index it was handled before, along with the RNG
+ *              seed and tick rate of the session. Replaying the recording
+ *              (one tick per frame, seeded the same) reproduces the same map
+ *              walk, NPC behaviour and battles, which makes for repeatable
+ *              end to end performance runs.
+ ******************************************************************************/
+#include "Game/KeyRecorder.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+/* Constant Implementation - see header file for descriptions */
+const std::string KeyRecorder::kKEY_END = "end";
+const std::string KeyRecorder::kKEY_KEY = "key";
+const std::string KeyRecorder::kKEY_SEED = "seed";
+const std::string KeyRecorder::kKEY_TICK_RATE = "tick_rate";
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructs a disabled key recorder.
+ *
+ * Inputs: none
+ */
+KeyRecorder::KeyRecorder()
+    : event_index{0},
+      mode{RecordMode::DISABLED},
+      path{""},
+      seed{0},
+      tick{0},
+      tick_end{0},
+      tick_rate{0}
+{
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Ticks the recorder. Called after each update tick that is run,
+ *              so events are stored against the tick they were handled before.
+ *              On replay, the timing of the run is output once complete.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void KeyRecorder::addTick()
+{
+  if(mode == RecordMode::DISABLED)
+    return;
+
+  tick++;
+  if(mode == RecordMode::REPLAYING && tick == tick_end)
+  {
+    double elapsed = replay_timer.elapsed();
+    std::cout << "[INFO] Replay complete: " << tick << " ticks in "
+              << std::fixed << std::setprecision(3) << elapsed << " s ("
+              << (elapsed * 1000.0 / tick) << " ms per frame)" << std::endl;
+  }
+}
+
+/*
+ * Description: Returns the recorded key events that are handled before the
+ *              current tick and advances past them. Only returns events while
+ *              replaying.
+ *
+ * Inputs: none
+ * Output: std::vector<SDL_KeyboardEvent> - the events to inject
+ */
+std::vector<SDL_KeyboardEvent> KeyRecorder::getEvents()
+{
+  std::vector<SDL_KeyboardEvent> tick_events;
+
+  if(mode == RecordMode::REPLAYING)
+  {
+    while(event_index < events.size() && events[event_index].tick <= tick)
+    {
+      tick_events.push_back(events[event_index].event);
+      event_index++;
+    }
+  }
+
+  return tick_events;
+}
+
+/*
+ * Description: Returns the record mode of the recorder.
+ *
+ * Inputs: none
+ * Output: RecordMode - the record mode
+ */
+RecordMode KeyRecorder::getMode()
+{
+  return mode;
+}
+
+/*
+ * Description: Returns the current update tick, relative to the start.
+ *
+ * Inputs: none
+ * Output: uint32_t - the tick index
+ */
+uint32_t KeyRecorder::getTick()
+{
+  return tick;
+}
+
+/*
+ * Description: Returns the tick rate of the recorded session. Replays must run
+ *              at this rate to reproduce the session.
+ *
+ * Inputs: none
+ * Output: uint32_t - ticks per second
+ */
+uint32_t KeyRecorder::getTickRate()
+{
+  return tick_rate;
+}
+
+/*
+ * Description: Returns true once a replay has run all of the recorded ticks.
+ *
+ * Inputs: none
+ * Output: bool - true if the replay is complete
+ */
+bool KeyRecorder::isComplete()
+{
+  return (mode == RecordMode::REPLAYING && tick >= tick_end);
+}
+
+/*
+ * Description: Records a key event against the current tick. Ignored unless
+ *              recording.
+ *
+ * Inputs: SDL_KeyboardEvent event - the handled key event
+ * Output: none
+ */
+void KeyRecorder::recordEvent(SDL_KeyboardEvent event)
+{
+  if(mode == RecordMode::RECORDING)
+    events.push_back({tick, event});
+}
+
+/*
+ * Description: Sets the tick rate that the recorded session runs at. Only
+ *              applies while recording - a replay uses the recorded rate.
+ *
+ * Inputs: uint32_t tick_rate - ticks per second
+ * Output: none
+ */
+void KeyRecorder::setTickRate(uint32_t tick_rate)
+{
+  if(mode == RecordMode::RECORDING)
+    this->tick_rate = tick_rate;
+}
+
+/*
+ * Description: Starts recording the session into the given file, which is
+ *              written on stop(). The generators are re-seeded with the
+ *              current seed, so the run starts from a known state.
+ *
+ * Inputs: std::string path - the recording file path
+ * Output: bool - true if recording was started
+ */
+bool KeyRecorder::startRecording(std::string path)
+{
+  if(mode != RecordMode::DISABLED || path.empty())
+    return false;
+
+  this->path = path;
+  seed = Helpers::getSeed();
+  Helpers::setSeed(seed);
+
+  events.clear();
+  event_index = 0;
+  tick = 0;
+  tick_end = 0;
+  mode = RecordMode::RECORDING;
+
+  return true;
+}
+
+/*
+ * Description: Loads the recording file and starts replaying it. The
+ *              generators are seeded with the recorded seed.
+ *
+ * Inputs: std::string path - the recording file path
+ * Output: bool - true if the file was loaded and the replay started
+ */
+bool KeyRecorder::startReplay(std::string path)
+{
+  if(mode != RecordMode::DISABLED)
+    return false;
+
+  FileHandler fh;
+  bool done = false;
+  bool success = true;
+
+  fh.setFilename(path);
+  fh.setFileType(FileHandler::REGULAR);
+  fh.setWriteEnabled(false);
+  fh.setEncryptionEnabled(false);
+  success = fh.start();
+
+  events.clear();
+  tick_end = 0;
+  tick_rate = 0;
+  while(success && !done)
+  {
+    std::string line = fh.readRegularLine(&done, &success);
+    std::stringstream ss(line);
+    std::string key;
+
+    if(!(ss >> key))
+      continue;
+
+    if(key == kKEY_SEED)
+    {
+      success &= static_cast<bool>(ss >> seed);
+    }
+    else if(key == kKEY_TICK_RATE)
+    {
+      success &= static_cast<bool>(ss >> tick_rate);
+    }
+    else if(key == kKEY_END)
+    {
+      success &= static_cast<bool>(ss >> tick_end);
+    }
+    else if(key == kKEY_KEY)
+    {
+      RecordKey record;
+      uint32_t state, repeat, mod;
+      int32_t scancode, keycode;
+
+      SDL_zero(record.event);
+      if(ss >> record.tick >> record.event.type >> state >> repeat >>
+         scancode >> keycode >> mod)
+      {
+        record.event.state = state;
+        record.event.repeat = repeat;
+        record.event.keysym.scancode = static_cast<SDL_Scancode>(scancode);
+        record.event.keysym.sym = keycode;
+        record.event.keysym.mod = mod;
+        events.push_back(record);
+      }
+      else
+      {
+        success = false;
+      }
+    }
+  }
+  fh.stop();
+
+  if(!success || tick_rate == 0)
+  {
+    std::cerr << "[ERROR] Failed to load the input recording: " << path
+              << std::endl;
+    events.clear();
+    return false;
+  }
+
+  /* A recording cut short has no end line. End after the last event */
+  if(!events.empty() && tick_end <= events.back().tick)
+    tick_end = events.back().tick + 1;
+
+  this->path = path;
+  Helpers::setSeed(seed);
+  event_index = 0;
+  tick = 0;
+  mode = RecordMode::REPLAYING;
+  replay_timer.reset();
+
+  return true;
+}
+
+/*
+ * Description: Stops the recorder. If recording, the seed, tick rate and all
+ *              key events are written to the recording file.
+ *
+ * Inputs: none
+ * Output: bool - true if stopped (and written, if recording)
+ */
+bool KeyRecorder::stop()
+{
+  bool success = true;
+
+  if(mode == RecordMode::RECORDING)
+  {
+    FileHandler fh;
+    fh.setFilename(path);
+    fh.setFileType(FileHandler::REGULAR);
+    fh.setWriteEnabled(true);
+    fh.setEncryptionEnabled(false);
+    success = fh.start();
+
+    if(success)
+    {
+      std::stringstream ss;
+      success &= fh.writeRegularLine(kKEY_SEED + " " + std::to_string(seed));
+      success &= fh.writeRegularLine(kKEY_TICK_RATE + " " +
+                                     std::to_string(tick_rate));
+
+      for(auto& record : events)
+      {
+        const SDL_KeyboardEvent& event = record.event;
+
+        ss.str("");
+        ss << kKEY_KEY << " " << record.tick << " " << event.type << " "
+           << static_cast<uint32_t>(event.state) << " "
+           << static_cast<uint32_t>(event.repeat) << " "
+           << static_cast<int32_t>(event.keysym.scancode) << " "
+           << static_cast<int32_t>(event.keysym.sym) << " "
+           << static_cast<uint32_t>(event.keysym.mod);
+        success &= fh.writeRegularLine(ss.str());
+      }
+
+      success &= fh.writeRegularLine(kKEY_END + " " + std::to_string(tick));
+      success &= fh.stop(!success);
+    }
+
+    if(!success)
+      std::cerr << "[ERROR] Failed to write the input recording: " << path
+                << std::endl;
+  }
+
+  events.clear();
+  event_index = 0;
+  mode = RecordMode::DISABLED;
+
+  return success;
+}
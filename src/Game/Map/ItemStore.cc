@@ -16,6 +16,7 @@
  * See .h file for TODOs
  ******************************************************************************/
 #include "Game/Map/ItemStore.h"
+#include "TextureRegistry.h"
 
 /* Constant Implementation - see header file for descriptions */
 const uint8_t ItemStore::kALPHA_MAX = 255;
@@ -155,9 +156,9 @@ void ItemStore::setupMainView(SDL_Renderer* renderer, std::string title)
   int render_width = img_backend_left.getWidth();
   
   /* Create rendering texture */
-  SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                                           SDL_TEXTUREACCESS_TARGET, 
-                                           render_width, render_height);
+  SDL_Texture* texture = TextureRegistry::create(
+      renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+      render_width, render_height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
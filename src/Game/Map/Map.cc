@@ -19,8 +19,13 @@
  *     it at a tile and then walking in. More true animation. How to?
  ******************************************************************************/
 #include "Game/Map/Map.h"
+#include "LoadReport.h"
+#include "Profiler.h"
+#include "TextureRegistry.h"
 
 /* Constant Implementation - see header file for descriptions */
+const uint8_t Map::kCHUNK_KEEP = 1;
+const uint16_t Map::kCHUNK_TILES = 16;
 const float Map::kFADE_FACTOR = 4.0;
 const uint8_t Map::kFADE_HOLD = 220;
 const uint16_t Map::kFADE_HOLD_DELAY = 1500;
@@ -79,6 +84,7 @@ Map::Map(Options* running_config, EventHandler* event_handler)
   name = "Map Name";
   name_view = 0;
   player = nullptr;
+  render_alpha = 1.0;
   speed_factor = 1.0;
   system_options = nullptr;
   view_acc = 0;
@@ -112,7 +118,7 @@ Map::~Map()
  *===========================================================================*/
 
 /* Add data based on the XML load information */
-bool Map::addSpriteData(XmlData data, std::string id, int file_index,
+bool Map::addSpriteData(const XmlData& data, std::string id, int file_index,
                         SDL_Renderer* renderer, std::string base_game_path)
 {
   int32_t access_id = -1;
@@ -121,13 +127,14 @@ bool Map::addSpriteData(XmlData data, std::string id, int file_index,
   Sprite* copy_sprite = nullptr;
 
   /* Get the ID information */
-  std::vector<std::string> id_set = Helpers::split(id, '>');
-  if(id_set.size() == 1)
-    access_id = std::stoi(id);
-  else if(id_set.size() == 2)
+  std::string_view id_set[2];
+  uint32_t id_count = Helpers::splitView(id, '>', id_set, 2);
+  if(id_count == 1)
+    access_id = Helpers::viewToInt(id);
+  else if(id_count == 2)
   {
-    access_id = std::stoi(id_set.back());
-    copy_id = std::stoi(id_set.front());
+    access_id = Helpers::viewToInt(id_set[1]);
+    copy_id = Helpers::viewToInt(id_set[0]);
   }
 
   /* Only move forward if the access id is valid */
@@ -162,7 +169,7 @@ bool Map::addSpriteData(XmlData data, std::string id, int file_index,
 }
 
 /* Add tile data based on the XML load information */
-bool Map::addTileData(XmlData data, uint16_t section_index)
+bool Map::addTileData(const XmlData& data, uint16_t section_index)
 {
   std::string classifier = data.getElement(kFILE_CLASSIFIER);
   std::string element = data.getAllElements().back();
@@ -198,21 +205,22 @@ bool Map::addTileData(XmlData data, uint16_t section_index)
         // TODO: Review revising to incorporate new helper function.
         if(found_sprite != nullptr)
         {
-          std::vector<std::string> col_list =
-              Helpers::split(data.getKeyValue(kFILE_TILE_COLUMN), ',');
-          uint16_t index = 0;
-          std::vector<std::string> row_list =
-              Helpers::split(data.getKeyValue(kFILE_TILE_ROW), ',');
+          std::string col_list = data.getKeyValue(kFILE_TILE_COLUMN);
+          size_t col_pos = 0;
+          std::string row_list = data.getKeyValue(kFILE_TILE_ROW);
+          size_t row_pos = 0;
 
           /* Loop through all the column and rows of the indexes */
-          while(index < row_list.size() && index < col_list.size())
+          while(row_pos < row_list.size() && col_pos < col_list.size())
           {
             uint16_t col_end = i;
             uint16_t col_start = i;
             uint16_t row_end = j;
             uint16_t row_start = j;
-            parseCoordinateInfo(row_list[index], col_list[index], section_index,
-                                &row_start, &row_end, &col_start, &col_end);
+            parseCoordinateInfo(Helpers::nextToken(row_list, ',', row_pos),
+                                Helpers::nextToken(col_list, ',', col_pos),
+                                section_index, &row_start, &row_end,
+                                &col_start, &col_end);
 
             /* Add the sprite to all the applicable tiles */
             for(int r = row_start; r < row_end; r++)
@@ -220,32 +228,35 @@ bool Map::addTileData(XmlData data, uint16_t section_index)
                 success &= sub_map[section_index].tiles[r][c]->addSprite(
                     found_sprite, data.getElement(kFILE_CLASSIFIER),
                     data.getKeyValue(kFILE_CLASSIFIER));
-            index++;
           }
         }
       }
     }
 
+    /* The tile sprites changed: pre-render the chunks again */
+    invalidateChunks(section_index);
+
     return success;
   }
   /* Otherwise, access the passability information for the tile */
   else if(element == "passability" || classifier == "tileevent")
   {
-    std::vector<std::string> col_list =
-        Helpers::split(data.getKeyValue(kFILE_TILE_COLUMN), ',');
-    uint16_t index = 0;
-    std::vector<std::string> row_list =
-        Helpers::split(data.getKeyValue(kFILE_TILE_ROW), ',');
+    std::string col_list = data.getKeyValue(kFILE_TILE_COLUMN);
+    size_t col_pos = 0;
+    std::string row_list = data.getKeyValue(kFILE_TILE_ROW);
+    size_t row_pos = 0;
 
     /* Loop through all the column and rows of the indexes */
-    while(index < row_list.size() && index < col_list.size())
+    while(row_pos < row_list.size() && col_pos < col_list.size())
     {
       uint16_t col_end = 0;
       uint16_t col_start = 0;
       uint16_t row_end = 0;
       uint16_t row_start = 0;
-      parseCoordinateInfo(row_list[index], col_list[index], section_index,
-                          &row_start, &row_end, &col_start, &col_end);
+      parseCoordinateInfo(Helpers::nextToken(row_list, ',', row_pos),
+                          Helpers::nextToken(col_list, ',', col_pos),
+                          section_index, &row_start, &row_end, &col_start,
+                          &col_end);
 
       /* Add the sprite to all the applicable tiles */
       for(int r = row_start; r < row_end; r++)
@@ -278,7 +289,6 @@ bool Map::addTileData(XmlData data, uint16_t section_index)
           }
         }
       }
-      index++;
     }
     return success;
   }
@@ -286,16 +296,16 @@ bool Map::addTileData(XmlData data, uint16_t section_index)
 }
 
 // TODO: Comment
-bool Map::addThingBaseData(XmlData data, int file_index, SDL_Renderer* renderer,
-                           std::string base_game_path)
+bool Map::addThingBaseData(const XmlData& data, int file_index,
+                           SDL_Renderer* renderer, std::string base_game_path)
 {
-  std::string identifier = data.getElement(file_index);
+  XmlToken identifier = data.getElementToken(file_index);
   uint32_t id = std::stoul(data.getKeyValue(file_index));
   MapThing* modified_thing = nullptr;
   bool new_thing = false;
 
   /* Identify which thing to be created */
-  if(identifier == "mapthing")
+  if(identifier == XmlToken::MAPTHING)
   {
     /* Create a new thing, if one doesn't exist */
     modified_thing = getThingBase(id);
@@ -306,7 +316,7 @@ bool Map::addThingBaseData(XmlData data, int file_index, SDL_Renderer* renderer,
       base_things.push_back(modified_thing);
     }
   }
-  else if(identifier == "mapio")
+  else if(identifier == XmlToken::MAPIO)
   {
     /* Create a new map interactive object, if one doesn't exist */
     modified_thing = getIOBase(id);
@@ -317,13 +327,14 @@ bool Map::addThingBaseData(XmlData data, int file_index, SDL_Renderer* renderer,
       base_ios.push_back(static_cast<MapInteractiveObject*>(modified_thing));
     }
   }
-  else if(identifier == "mapperson" || identifier == "mapnpc")
+  else if(identifier == XmlToken::MAPPERSON ||
+          identifier == XmlToken::MAPNPC)
   {
     /* Create a new person, if one doesn't exist */
     modified_thing = getPersonBase(id);
     if(modified_thing == nullptr)
     {
-      if(identifier == "mapperson")
+      if(identifier == XmlToken::MAPPERSON)
       {
         modified_thing = new MapPerson();
       }
@@ -337,7 +348,7 @@ bool Map::addThingBaseData(XmlData data, int file_index, SDL_Renderer* renderer,
     }
   }
   // Note: removed for new bases controlled by core group - delete future?
-  // else if(identifier == "mapitem")
+  // else if(identifier == XmlToken::MAPITEM)
   //{
   //  /* Create a new item, if one doesn't exist */
   //  modified_thing = getItemBase(id);
@@ -364,11 +375,11 @@ bool Map::addThingBaseData(XmlData data, int file_index, SDL_Renderer* renderer,
 }
 
 // TODO: Comment
-bool Map::addThingData(XmlData data, uint16_t section_index,
+bool Map::addThingData(const XmlData& data, uint16_t section_index,
                        SDL_Renderer* renderer, bool from_save)
 {
   int32_t base_id = -1;
-  std::string identifier = data.getElement(kFILE_CLASSIFIER);
+  XmlToken identifier = data.getElementToken(kFILE_CLASSIFIER);
   uint32_t id = std::stoul(data.getKeyValue(kFILE_CLASSIFIER));
   MapThing* modified_thing = nullptr;
   bool new_thing = false;
@@ -380,14 +391,14 @@ bool Map::addThingData(XmlData data, uint16_t section_index,
     drop_item = (id >= (EnumDb::kBASE_ID_ITEMS + EnumDb::kMAX_COUNT_ITEMS));
 
   /* Check if it's base */
-  if(data.getElement(kFILE_CLASSIFIER + 1) == "base" &&
+  if(data.getElementToken(kFILE_CLASSIFIER + 1) == XmlToken::BASE &&
      (!from_save || drop_item))
   {
     base_id = data.getDataInteger();
   }
 
   /* Identify which thing to be created */
-  if(identifier == "mapthing")
+  if(identifier == XmlToken::MAPTHING)
   {
     /* Create a new thing, if one doesn't exist */
     modified_thing = getThing(id);
@@ -402,7 +413,7 @@ bool Map::addThingData(XmlData data, uint16_t section_index,
     if(base_id >= 0)
       success &= modified_thing->setBase(getThingBase(base_id));
   }
-  else if(identifier == "mapio")
+  else if(identifier == XmlToken::MAPIO)
   {
     /* Create a new MIO, if one doesn't exist */
     modified_thing = getIO(id);
@@ -419,13 +430,14 @@ bool Map::addThingData(XmlData data, uint16_t section_index,
     if(base_id >= 0)
       success &= modified_thing->setBase(getIOBase(base_id));
   }
-  else if(identifier == "mapperson" || identifier == "mapnpc")
+  else if(identifier == XmlToken::MAPPERSON ||
+          identifier == XmlToken::MAPNPC)
   {
     /* Create a new person, if one doesn't exist */
     modified_thing = getPerson(id);
     if(modified_thing == nullptr && !from_save)
     {
-      if(identifier == "mapperson")
+      if(identifier == XmlToken::MAPPERSON)
       {
         modified_thing = new MapPerson();
       }
@@ -447,7 +459,7 @@ bool Map::addThingData(XmlData data, uint16_t section_index,
     if(base_id >= 0)
       success &= modified_thing->setBase(getPersonBase(base_id));
   }
-  else if(identifier == "mapitem")
+  else if(identifier == XmlToken::MAPITEM)
   {
     /* Create a new item, if one doesn't exist */
     modified_thing = getItem(id);
@@ -609,6 +621,106 @@ void Map::audioUpdate(bool sub_change)
   }
 }
 
+/* Pre-renders the static tile layers of a chunk. Tiles with animated layers
+ * are listed for the live render instead */
+bool Map::buildChunk(SDL_Renderer* renderer, uint16_t section,
+                     uint16_t chunk_x, uint16_t chunk_y)
+{
+  std::vector<std::vector<Tile*>>& tiles = sub_map[section].tiles;
+  TileChunk& chunk = sub_map[section].chunks[chunk_x][chunk_y];
+  bool lower_set = false;
+  bool success = true;
+  bool upper_set = false;
+
+  /* Tile range of the chunk, cut short at the map edges */
+  uint16_t tile_x_start = chunk_x * kCHUNK_TILES;
+  uint16_t tile_x_end = tile_x_start + kCHUNK_TILES;
+  if(tile_x_end > tiles.size())
+    tile_x_end = tiles.size();
+  uint16_t tile_y_start = chunk_y * kCHUNK_TILES;
+  uint16_t tile_y_end = tile_y_start + kCHUNK_TILES;
+  if(tile_y_end > tiles[tile_x_start].size())
+    tile_y_end = tiles[tile_x_start].size();
+
+  /* Split the tiles into pre-rendered and live */
+  chunk.live_lower.clear();
+  chunk.live_upper.clear();
+  for(uint16_t i = tile_x_start; i < tile_x_end; i++)
+  {
+    for(uint16_t j = tile_y_start; j < tile_y_end; j++)
+    {
+      if(tiles[i][j]->isAnimatedLower())
+        chunk.live_lower.push_back(tiles[i][j]);
+      else
+        lower_set = true;
+
+      if(tiles[i][j]->isAnimatedUpper())
+        chunk.live_upper.push_back(tiles[i][j]);
+      else if(tiles[i][j]->isUpperSet())
+        upper_set = true;
+    }
+  }
+
+  /* Create the textures on the first build */
+  int width = (tile_x_end - tile_x_start) * tile_width;
+  int height = (tile_y_end - tile_y_start) * tile_height;
+  for(SDL_Texture** texture : {&chunk.lower, &chunk.upper})
+  {
+    bool set = (texture == &chunk.lower) ? lower_set : upper_set;
+    if(set && *texture == nullptr)
+    {
+      *texture = TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET, width,
+                                         height, TextureSource::CHUNK);
+      if(*texture == nullptr)
+        return false;
+
+      /* Tiles blended onto the cleared chunk leave premultiplied colour, so
+       * the chunk is composited without multiplying by alpha again */
+      SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(
+          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+          SDL_BLENDOPERATION_ADD, SDL_BLENDFACTOR_ONE,
+          SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+      SDL_SetTextureBlendMode(*texture, premultiplied);
+    }
+    else if(!set && *texture != nullptr)
+    {
+      TextureRegistry::destroy(*texture);
+      *texture = nullptr;
+    }
+  }
+
+  /* Render the static layers, offset to the top left of the chunk */
+  SDL_Texture* previous_target = SDL_GetRenderTarget(renderer);
+  int offset_x = tile_x_start * tile_width;
+  int offset_y = tile_y_start * tile_height;
+  if(chunk.lower != nullptr)
+  {
+    SDL_SetRenderTarget(renderer, chunk.lower);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    for(uint16_t i = tile_x_start; i < tile_x_end; i++)
+      for(uint16_t j = tile_y_start; j < tile_y_end; j++)
+        if(!tiles[i][j]->isAnimatedLower())
+          success &= tiles[i][j]->renderLower(renderer, offset_x, offset_y);
+  }
+  if(chunk.upper != nullptr)
+  {
+    SDL_SetRenderTarget(renderer, chunk.upper);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    for(uint16_t i = tile_x_start; i < tile_x_end; i++)
+      for(uint16_t j = tile_y_start; j < tile_y_end; j++)
+        if(!tiles[i][j]->isAnimatedUpper())
+          success &= tiles[i][j]->renderUpper(renderer, offset_x, offset_y);
+  }
+  SDL_SetRenderTarget(renderer, previous_target);
+
+  /* Kept even if a sprite failed, so a bad tile is not rebuilt every frame */
+  chunk.valid = true;
+  return success;
+}
+
 /* Change the mode that the game is running */
 bool Map::changeMode(MapMode mode)
 {
@@ -973,6 +1085,16 @@ bool Map::initiateMapSection(uint16_t section_index, int width, int height)
       }
     }
 
+    /* Chunks covering the tiles, pre-rendered when first in view */
+    TileChunk chunk = {nullptr, nullptr, {}, {}, false};
+    std::vector<std::vector<TileChunk>>& chunks = sub_map[section_index].chunks;
+    chunks.resize((sub_map[section_index].tiles.size() + kCHUNK_TILES - 1) /
+                  kCHUNK_TILES);
+    for(uint32_t i = 0; i < chunks.size(); i++)
+      chunks[i].resize((sub_map[section_index].tiles[i * kCHUNK_TILES].size() +
+                        kCHUNK_TILES - 1) / kCHUNK_TILES, chunk);
+    invalidateChunks(section_index);
+
     return true;
   }
 
@@ -1177,6 +1299,33 @@ void Map::initiateThingInteraction(MapPerson* initiator)
   }
 }
 
+/* Marks the chunks of the section (or all sections), or only the chunk of
+ * the tile, to be pre-rendered again. The textures are kept for reuse */
+void Map::invalidateChunks(int section, int tile_x, int tile_y)
+{
+  for(uint32_t i = 0; i < sub_map.size(); i++)
+  {
+    if(section < 0 || static_cast<uint32_t>(section) == i)
+    {
+      std::vector<std::vector<TileChunk>>& chunks = sub_map[i].chunks;
+
+      if(tile_x >= 0 && tile_y >= 0)
+      {
+        uint32_t chunk_x = tile_x / kCHUNK_TILES;
+        uint32_t chunk_y = tile_y / kCHUNK_TILES;
+        if(chunk_x < chunks.size() && chunk_y < chunks[chunk_x].size())
+          chunks[chunk_x][chunk_y].valid = false;
+      }
+      else
+      {
+        for(uint32_t j = 0; j < chunks.size(); j++)
+          for(uint32_t k = 0; k < chunks[j].size(); k++)
+            chunks[j][k].valid = false;
+      }
+    }
+  }
+}
+
 /* Returns if the color is currently in a transition status */
 bool Map::isColorTransitioning()
 {
@@ -1327,25 +1476,26 @@ MapThing* Map::moveThing(MapThing* thing_ref, uint16_t section_old)
 
 /* Parse coordinate info from file to give the designated tile coordinates
  * to update */
-bool Map::parseCoordinateInfo(std::string row, std::string col, uint16_t index,
-                              uint16_t* r_start, uint16_t* r_end,
-                              uint16_t* c_start, uint16_t* c_end)
+bool Map::parseCoordinateInfo(std::string_view row, std::string_view col,
+                              uint16_t index, uint16_t* r_start,
+                              uint16_t* r_end, uint16_t* c_start,
+                              uint16_t* c_end)
 {
-  std::vector<std::string> row_list = Helpers::split(row, '-');
-  std::vector<std::string> col_list = Helpers::split(col, '-');
-  if(row_list.size() > 0 && col_list.size() > 0)
+  std::string_view row_first, row_last, col_first, col_last;
+  if(Helpers::splitEnds(row, '-', row_first, row_last) &&
+     Helpers::splitEnds(col, '-', col_first, col_last))
   {
     /* Determine the row of parsing - limit to map size */
-    *r_start += std::stoul(row_list.front());
-    *r_end += std::stoul(row_list.back()) + 1;
+    *r_start += Helpers::viewToInt(row_first);
+    *r_end += Helpers::viewToInt(row_last) + 1;
     if(*r_start > sub_map[index].tiles.size())
       *r_start = sub_map[index].tiles.size();
     if(*r_end > sub_map[index].tiles.size())
       *r_end = sub_map[index].tiles.size();
 
     /* Determine the column of parsing - limit to map size */
-    *c_start += std::stoul(col_list.front());
-    *c_end += std::stoul(col_list.back()) + 1;
+    *c_start += Helpers::viewToInt(col_first);
+    *c_end += Helpers::viewToInt(col_last) + 1;
     if(*c_start > sub_map[index].tiles[*r_start].size())
       *c_start = sub_map[index].tiles[*r_start].size();
     if(*c_end > sub_map[index].tiles[*r_start].size())
@@ -1356,6 +1506,105 @@ bool Map::parseCoordinateInfo(std::string row, std::string col, uint16_t index,
   return false;
 }
 
+/* Releases the chunk textures of the sections not in view and of the chunks
+ * more than kCHUNK_KEEP away from the view. All of them if all is set */
+void Map::releaseChunks(bool all)
+{
+  int chunk_x_start = viewport.getXTileStart() / kCHUNK_TILES - kCHUNK_KEEP;
+  int chunk_x_end = viewport.getXTileEnd() / kCHUNK_TILES + kCHUNK_KEEP;
+  int chunk_y_start = viewport.getYTileStart() / kCHUNK_TILES - kCHUNK_KEEP;
+  int chunk_y_end = viewport.getYTileEnd() / kCHUNK_TILES + kCHUNK_KEEP;
+
+  for(uint32_t i = 0; i < sub_map.size(); i++)
+  {
+    for(int j = 0; j < static_cast<int>(sub_map[i].chunks.size()); j++)
+    {
+      for(int k = 0; k < static_cast<int>(sub_map[i].chunks[j].size()); k++)
+      {
+        TileChunk& chunk = sub_map[i].chunks[j][k];
+        if(all || i != map_index || j < chunk_x_start || j > chunk_x_end ||
+           k < chunk_y_start || k > chunk_y_end)
+        {
+          if(chunk.lower != nullptr)
+            TextureRegistry::destroy(chunk.lower);
+          if(chunk.upper != nullptr)
+            TextureRegistry::destroy(chunk.upper);
+          chunk = {nullptr, nullptr, {}, {}, false};
+        }
+      }
+    }
+  }
+}
+
+/* Renders the lower or upper tile layers in view: the textures of the
+ * chunks, then the animated tiles with a batch per layer */
+bool Map::renderChunks(SDL_Renderer* renderer, bool upper, int offset_x,
+                       int offset_y)
+{
+  std::vector<std::vector<TileChunk>>& chunks = sub_map[map_index].chunks;
+  bool success = true;
+
+  /* Chunk range of the viewport */
+  uint16_t chunk_x_start = viewport.getXTileStart() / kCHUNK_TILES;
+  uint16_t chunk_x_end =
+      (viewport.getXTileEnd() + kCHUNK_TILES - 1) / kCHUNK_TILES;
+  if(chunk_x_end > chunks.size())
+    chunk_x_end = chunks.size();
+  uint16_t chunk_y_start = viewport.getYTileStart() / kCHUNK_TILES;
+  uint16_t chunk_y_end =
+      (viewport.getYTileEnd() + kCHUNK_TILES - 1) / kCHUNK_TILES;
+
+  /* Pre-rendered tiles, building the chunks that are out of date */
+  for(uint16_t i = chunk_x_start; i < chunk_x_end; i++)
+  {
+    for(uint16_t j = chunk_y_start; j < chunk_y_end && j < chunks[i].size();
+        j++)
+    {
+      if(!chunks[i][j].valid)
+        success &= buildChunk(renderer, map_index, i, j);
+
+      SDL_Texture* texture = upper ? chunks[i][j].upper : chunks[i][j].lower;
+      if(texture != nullptr)
+      {
+        SDL_Rect rect = {i * kCHUNK_TILES * tile_width - offset_x,
+                         j * kCHUNK_TILES * tile_height - offset_y, 0, 0};
+        SDL_QueryTexture(texture, nullptr, nullptr, &rect.w, &rect.h);
+        success &= (SDL_RenderCopy(renderer, texture, nullptr, &rect) == 0);
+      }
+    }
+  }
+
+  /* Animated tiles in the viewport, on top of nothing else in the layer */
+  uint8_t layers = upper ? Tile::getUpperLayerCount()
+                         : Tile::getLowerLayerCount();
+  for(uint8_t layer = 0; layer < layers; layer++)
+  {
+    for(uint16_t i = chunk_x_start; i < chunk_x_end; i++)
+    {
+      for(uint16_t j = chunk_y_start; j < chunk_y_end && j < chunks[i].size();
+          j++)
+      {
+        for(Tile* tile : upper ? chunks[i][j].live_upper
+                               : chunks[i][j].live_lower)
+        {
+          bool in_view = tile->getX() >= viewport.getXTileStart() &&
+                         tile->getX() < viewport.getXTileEnd() &&
+                         tile->getY() >= viewport.getYTileStart() &&
+                         tile->getY() < viewport.getYTileEnd();
+
+          if(in_view && upper)
+            tile->renderUpper(renderer, tile_batch, layer, offset_x, offset_y);
+          else if(in_view)
+            tile->renderLower(renderer, tile_batch, layer, offset_x, offset_y);
+        }
+      }
+    }
+    success &= tile_batch.flush(renderer);
+  }
+
+  return success;
+}
+
 /* Save the passed in sub map based on the map ID */
 bool Map::saveSubMap(FileHandler* fh, const uint32_t& id,
                      const std::string& wrapper, const bool& write_id)
@@ -1494,9 +1743,10 @@ void Map::setColorMode(ColorMode mode)
   /* Check if change */
   if(mode != ColorMode::INVALID && mode != curr_mode)
   {
-    /* Tile Sprites */
+    /* Tile Sprites, and the chunks pre-rendered with them */
     for(auto i = tile_sprites.begin(); i != tile_sprites.end(); i++)
       (*i)->setColorMode(mode);
+    invalidateChunks();
 
     /* Map Things */
     for(auto i = base_things.begin(); i != base_things.end(); i++)
@@ -1625,14 +1875,16 @@ bool Map::setTiles(MapThing* ref)
 }
 
 /* Splits the ID into a vector of IDs */
-std::vector<std::vector<int32_t>> Map::splitIdString(std::string id,
+std::vector<std::vector<int32_t>> Map::splitIdString(std::string_view id,
                                                      bool matrix)
 {
   std::vector<std::vector<int32_t>> id_stack;
-  std::vector<std::string> xy_split = Helpers::split(id, ',');
+  std::string_view x_range, y_range;
+  uint32_t xy_count = Helpers::splitView(id, ',', nullptr, 0);
+  Helpers::splitEnds(id, ',', x_range, y_range);
 
   /* Only proceed if the string isn't empty and a split occurred */
-  if(xy_split.size() > 0)
+  if(xy_count > 0)
   {
     /* If it is a non-matrix split, handle accordingly */
     if(!matrix)
@@ -1643,21 +1895,21 @@ std::vector<std::vector<int32_t>> Map::splitIdString(std::string id,
       uint16_t multiplier_min = 0;
 
       /* Work with the first element to determine the first and last row id */
-      std::vector<std::string> x_split = Helpers::split(xy_split.front(), '-');
-      if(x_split.size() > 0)
+      std::string_view x_first, x_last;
+      if(Helpers::splitEnds(x_range, '-', x_first, x_last))
       {
-        id_min = std::stoul(x_split.front());
-        id_max = std::stoul(x_split.back());
+        id_min = Helpers::viewToInt(x_first);
+        id_max = Helpers::viewToInt(x_last);
       }
 
       /* Check if there is a multiplier element to work with */
-      if(xy_split.size() > 1)
+      if(xy_count > 1)
       {
-        std::vector<std::string> y_split = Helpers::split(xy_split.back(), '-');
-        if(y_split.size() > 0)
+        std::string_view y_first, y_last;
+        if(Helpers::splitEnds(y_range, '-', y_first, y_last))
         {
-          multiplier_min = std::stoul(y_split.front());
-          multiplier_max = std::stoul(y_split.back());
+          multiplier_min = Helpers::viewToInt(y_first);
+          multiplier_max = Helpers::viewToInt(y_last);
         }
       }
 
@@ -1675,13 +1927,16 @@ std::vector<std::vector<int32_t>> Map::splitIdString(std::string id,
     /* Otherwise, it's an explicitely defined matrix */
     else
     {
-      for(uint16_t i = 0; i < xy_split.size(); i++)
+      size_t xy_pos = 0;
+      while(xy_pos < id.size())
       {
+        std::string_view row = Helpers::nextToken(id, ',', xy_pos);
         std::vector<int32_t> id_row;
 
-        std::vector<std::string> row_split = Helpers::split(xy_split[i], '.');
-        for(uint16_t j = 0; j < row_split.size(); j++)
-          id_row.push_back(std::stoul(row_split[j]));
+        size_t row_pos = 0;
+        while(row_pos < row.size())
+          id_row.push_back(Helpers::viewToInt(
+              Helpers::nextToken(row, '.', row_pos)));
 
         id_stack.push_back(id_row);
       }
@@ -2160,6 +2415,9 @@ void Map::updateTileSize(bool force)
 
     /* Update viewport */
     viewport.setTileSize(tile_width, tile_height);
+
+    /* The chunk textures are sized by the tiles */
+    releaseChunks(true);
   }
 }
 
@@ -2938,54 +3196,68 @@ void Map::keyUpEvent(KeyHandler& key_handler)
 }
 
 /* Loads the map data - called from game */
-bool Map::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Map::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                    std::string base_game_path, bool from_save)
 {
   bool success = true;
-  std::string element = data.getElement(index);
+  XmlToken element = data.getElementToken(index);
 
+  switch(element)
+  {
   /* ---- MAP NAME ---- */
-  if(element == "name")
+  case(XmlToken::NAME):
   {
     std::string new_name = data.getDataString(&success);
     if(success)
       name = new_name;
+    break;
   }
   /* ---- BASE SPRITES ---- */
-  else if(element == "sprite" && !data.getKeyValue(index).empty())
+  case(XmlToken::SPRITE):
   {
-    success &=
-        addSpriteData(data, data.getKeyValue(index), index + 1, renderer, base_game_path);
+    if(!data.getKeyValue(index).empty())
+    {
+      LoadScope load_scope(LoadPhase::MAP_SPRITES);
+      success &= addSpriteData(data, data.getKeyValue(index), index + 1,
+                               renderer, base_game_path);
+    }
+    break;
   }
   /* ---- BASE THINGS ---- */
-  // else if((element == "mapthing" || element == "mapperson" ||
-  //      element == "mapnpc" || element == "mapitem" || element == "mapio") &&
-  //      !data.getKeyValue(index).empty())
-  else if((element == "mapthing" || element == "mapperson" ||
-           element == "mapnpc" || element == "mapio") &&
-          !data.getKeyValue(index).empty())
+  // case(XmlToken::MAPITEM):
+  case(XmlToken::MAPTHING):
+  case(XmlToken::MAPPERSON):
+  case(XmlToken::MAPNPC):
+  case(XmlToken::MAPIO):
   {
-    success &= addThingBaseData(data, index, renderer, base_game_path);
+    if(!data.getKeyValue(index).empty())
+    {
+      LoadScope load_scope(LoadPhase::MAP_THINGS);
+      success &= addThingBaseData(data, index, renderer, base_game_path);
+    }
+    break;
   }
   /* ---- BATTLE SCENES ---- */
-  else if(element == "battlescene")
+  case(XmlToken::BATTLESCENE):
   {
     int id = data.getDataInteger(&success);
     if(success && id >= 0)
       battle_scenes.push_back(id);
+    break;
   }
   /* ---- SUB MAPS ---- */
-  else if(element == "main" || element == "section")
+  case(XmlToken::MAIN):
+  case(XmlToken::SECTION):
   {
     int map_index = -1;
     int height = -1;
     int width = -1;
-    std::string element2 = data.getElement(index + 1);
+    XmlToken element2 = data.getElementToken(index + 1);
 
     /* Determine section */
-    if(element == "main")
+    if(element == XmlToken::MAIN)
       map_index = 0;
-    else if(element == "section")
+    else
       map_index = std::stoi(data.getKeyValue(index));
 
     if(map_index >= 0)
@@ -3004,36 +3276,43 @@ bool Map::loadData(XmlData data, int index, SDL_Renderer* renderer,
         initiateMapSection(map_index, width, height);
       }
 
+      switch(element2)
+      {
       /* -- SECTION WIDTH -- */
-      if(element2 == "width")
+      case(XmlToken::WIDTH):
       {
         width = data.getDataInteger(&success);
         if(success)
           initiateMapSection(map_index, width, height);
+        break;
       }
       /* -- SECTION HEIGHT -- */
-      else if(element2 == "height")
+      case(XmlToken::HEIGHT):
       {
         height = data.getDataInteger(&success);
         if(success)
           initiateMapSection(map_index, width, height);
+        break;
       }
       /* -- BATTLE SCENE -- */
-      else if(element2 == "battlescene")
+      case(XmlToken::BATTLESCENE):
       {
         int id = data.getDataInteger(&success);
         if(success && id >= 0)
           sub_map[map_index].battles.push_back(id);
+        break;
       }
       /* -- MUSIC -- */
-      else if(element2 == "music")
+      case(XmlToken::MUSIC):
       {
         int32_t music_id = data.getDataInteger(&success);
         if(music_id >= 0)
           sub_map[map_index].music.push_back(music_id);
+        break;
       }
       /* -- OVERLAYS and UNDERLAYS -- */
-      else if(element2 == "overlay" || element2 == "underlay")
+      case(XmlToken::OVERLAY):
+      case(XmlToken::UNDERLAY):
       {
         /* Get index */
         int index_ref = -1;
@@ -3046,7 +3325,7 @@ bool Map::loadData(XmlData data, int index, SDL_Renderer* renderer,
         {
           /* Get referenced layer */
           LayOver* lay_ref = nullptr;
-          if(element2 == "overlay")
+          if(element2 == XmlToken::OVERLAY)
           {
             while(static_cast<int>(sub_map[map_index].overlays.size()) <=
                   index_ref)
@@ -3066,29 +3345,46 @@ bool Map::loadData(XmlData data, int index, SDL_Renderer* renderer,
           /* Modify referenced lay */
           *lay_ref = Helpers::updateLayOver(*lay_ref, data, index + 2, base_game_path);
         }
+        break;
       }
       /* -- WEATHER -- */
-      else if(element2 == "weather")
+      case(XmlToken::WEATHER):
       {
         int32_t weather_id = data.getDataInteger(&success);
         if(weather_id >= 0)
           sub_map[map_index].weather = weather_id;
+        break;
       }
       /* -- TILE SPRITES/EVENTS -- */
-      else if(element2 == "base" || element2 == "enhancer" ||
-              element2 == "lower" || element2 == "upper" ||
-              element2 == "tileevent")
+      case(XmlToken::BASE):
+      case(XmlToken::ENHANCER):
+      case(XmlToken::LOWER):
+      case(XmlToken::UPPER):
+      case(XmlToken::TILEEVENT):
       {
+        LoadScope load_scope(LoadPhase::MAP_TILES);
         success &= addTileData(data, map_index);
+        break;
       }
       /* -- TILE THINGS -- */
-      else if(element2 == "mapthing" || element2 == "mapperson" ||
-              element2 == "mapnpc" || element2 == "mapitem" ||
-              element2 == "mapio")
+      case(XmlToken::MAPTHING):
+      case(XmlToken::MAPPERSON):
+      case(XmlToken::MAPNPC):
+      case(XmlToken::MAPITEM):
+      case(XmlToken::MAPIO):
       {
+        LoadScope load_scope(LoadPhase::MAP_THINGS);
         success &= addThingData(data, map_index, renderer, from_save);
+        break;
+      }
+      default:
+        break;
       }
     }
+    break;
+  }
+  default:
+    break;
   }
 
   return success;
@@ -3326,6 +3622,7 @@ bool Map::pickupItem(MapItem* item, int count)
 /* Renders the title screen */
 bool Map::render(SDL_Renderer* renderer)
 {
+  ProfileScope zone_scope(ProfileZone::MAP_RENDER);
   bool success = true;
   if(sub_map.size() > map_index)
   {
@@ -3334,24 +3631,51 @@ bool Map::render(SDL_Renderer* renderer)
     uint16_t tile_x_end = viewport.getXTileEnd();
     uint16_t tile_y_start = viewport.getYTileStart();
     uint16_t tile_y_end = viewport.getYTileEnd();
-    float x_offset = viewport.getX();
-    float y_offset = viewport.getY();
+    float x_offset = viewport.getXRender(render_alpha);
+    float y_offset = viewport.getYRender(render_alpha);
+
+    /* Thing offsets, interpolated between the last two update ticks */
+    auto offset_x = [&](MapThing* thing) -> int {
+      return x_offset + thing->getRenderLag(render_alpha).x;
+    };
+    auto offset_y = [&](MapThing* thing) -> int {
+      return y_offset + thing->getRenderLag(render_alpha).y;
+    };
 
     /* Underlay for map */
     for(auto it = lay_unders.begin(); it != end(lay_unders); ++it)
       if(*it)
         (*it)->render(renderer);
 
-    /* Render the lower tiles within the range of the viewport */
+    /* Render the lower tiles within the range of the viewport. Static tiles
+     * come from the pre-rendered chunks, except while the colors transition
+     * or the map zooms. Each live layer is one batch, drawn with a call per
+     * atlas page */
+    bool use_chunks = SDL_RenderTargetSupported(renderer) && !zooming &&
+                      !isColorTransitioning();
+    if(use_chunks)
+    {
+      success &= renderChunks(renderer, false, x_offset, y_offset);
+    }
+    else
+    {
+      for(uint8_t layer = 0; layer < Tile::getLowerLayerCount(); layer++)
+      {
+        for(uint16_t i = tile_x_start; i < tile_x_end; i++)
+          for(uint16_t j = tile_y_start; j < tile_y_end; j++)
+            sub_map[map_index].tiles[i][j]->renderLower(
+                renderer, tile_batch, layer, x_offset, y_offset);
+        success &= tile_batch.flush(renderer);
+      }
+    }
+
+    /* Render the items and base things on the lower tiles */
     for(uint16_t i = tile_x_start; i < tile_x_end; i++)
     {
       for(uint16_t j = tile_y_start; j < tile_y_end; j++)
       {
         Tile* ref_tile = sub_map[map_index].tiles[i][j];
 
-        /* Lower sprites */
-        ref_tile->renderLower(renderer, x_offset, y_offset);
-
         /* Map Items, if relevant */
         if(ref_tile->isItemsSet())
         {
@@ -3371,15 +3695,16 @@ bool Map::render(SDL_Renderer* renderer)
         /* Base map thing, if relevant */
         MapThing* render_thing = sub_map[map_index].tiles[i][j]->getThing(0);
         if(render_thing != nullptr)
-          render_thing->renderMain(renderer, sub_map[map_index].tiles[i][j], 0,
-                                   x_offset, y_offset);
+          render_thing->renderMain(
+              renderer, sub_map[map_index].tiles[i][j], 0,
+              offset_x(render_thing), offset_y(render_thing));
 
         /* Base map IO, if relevant */
         MapInteractiveObject* render_io =
             sub_map[map_index].tiles[i][j]->getIO(0);
         if(render_io != nullptr)
           render_io->renderMain(renderer, sub_map[map_index].tiles[i][j], 0,
-                                x_offset, y_offset);
+                                offset_x(render_io), offset_y(render_io));
       }
     }
 
@@ -3408,15 +3733,15 @@ bool Map::render(SDL_Renderer* renderer)
                 if(render_person->getMovement() == Direction::EAST ||
                    render_person->getMovement() == Direction::SOUTH)
                 {
-                  render_person->renderPrevious(renderer,
-                                                sub_map[map_index].tiles[i][j],
-                                                index, x_offset, y_offset);
+                  render_person->renderPrevious(
+                      renderer, sub_map[map_index].tiles[i][j], index,
+                      offset_x(render_person), offset_y(render_person));
                 }
                 else
                 {
-                  render_person->renderMain(renderer,
-                                            sub_map[map_index].tiles[i][j],
-                                            index, x_offset, y_offset);
+                  render_person->renderMain(
+                      renderer, sub_map[map_index].tiles[i][j], index,
+                      offset_x(render_person), offset_y(render_person));
                 }
               }
             }
@@ -3428,39 +3753,49 @@ bool Map::render(SDL_Renderer* renderer)
                 if(render_person->getMovement() == Direction::EAST ||
                    render_person->getMovement() == Direction::SOUTH)
                 {
-                  render_person->renderPrevious(renderer,
-                                                sub_map[map_index].tiles[i][j],
-                                                index, x_offset, y_offset);
+                  render_person->renderPrevious(
+                      renderer, sub_map[map_index].tiles[i][j], index,
+                      offset_x(render_person), offset_y(render_person));
                 }
                 else
                 {
-                  render_person->renderMain(renderer,
-                                            sub_map[map_index].tiles[i][j],
-                                            index, x_offset, y_offset);
+                  render_person->renderMain(
+                      renderer, sub_map[map_index].tiles[i][j], index,
+                      offset_x(render_person), offset_y(render_person));
                 }
               }
 
               if(render_thing != nullptr)
-                render_thing->renderMain(renderer,
-                                         sub_map[map_index].tiles[i][j], index,
-                                         x_offset, y_offset);
+                render_thing->renderMain(
+                    renderer, sub_map[map_index].tiles[i][j], index,
+                    offset_x(render_thing), offset_y(render_thing));
 
               if(render_io != nullptr)
-                render_io->renderMain(renderer, sub_map[map_index].tiles[i][j],
-                                      index, x_offset, y_offset);
+                render_io->renderMain(
+                    renderer, sub_map[map_index].tiles[i][j], index,
+                    offset_x(render_io), offset_y(render_io));
             }
           }
         }
       }
     }
 
-    /* Render the upper tiles within the range of the viewport */
-    for(uint16_t i = tile_x_start; i < tile_x_end; i++)
+    /* Render the upper tiles within the range of the viewport, the same as
+     * the lower tiles */
+    if(use_chunks)
     {
-      for(uint16_t j = tile_y_start; j < tile_y_end; j++)
+      success &= renderChunks(renderer, true, x_offset, y_offset);
+      releaseChunks();
+    }
+    else
+    {
+      for(uint8_t layer = 0; layer < Tile::getUpperLayerCount(); layer++)
       {
-        sub_map[map_index].tiles[i][j]->renderUpper(renderer, x_offset,
-                                                    y_offset);
+        for(uint16_t i = tile_x_start; i < tile_x_end; i++)
+          for(uint16_t j = tile_y_start; j < tile_y_end; j++)
+            sub_map[map_index].tiles[i][j]->renderUpper(
+                renderer, tile_batch, layer, x_offset, y_offset);
+        success &= tile_batch.flush(renderer);
       }
     }
 
@@ -3617,6 +3952,12 @@ void Map::setEventHandler(EventHandler* event_handler)
   map_dialog.setEventHandler(event_handler);
 }
 
+/* Sets the render interpolation progress (0.0 - 1.0) between update ticks */
+void Map::setRenderAlpha(float alpha)
+{
+  render_alpha = std::max(0.0f, std::min(alpha, 1.0f));
+}
+
 /* Sets the speed factor of update call on the map side */
 bool Map::setSpeedFactor(float factor)
 {
@@ -3691,6 +4032,9 @@ void Map::unfocus()
 /* Unload all map data */
 void Map::unloadMap()
 {
+  /* Release the pre-rendered tile chunks */
+  releaseChunks(true);
+
   /* Reset the index and applicable parameters */
   battle_eventlose = {nullptr, nullptr};
   battle_eventwin = {nullptr, nullptr};
@@ -3902,7 +4246,10 @@ void Map::unlockTile(int section_id, int tile_x, int tile_y,
 
       /* If unlocked, proceed to parse view and if required */
       if(unlocked)
+      {
+        invalidateChunks(section_id, tile_x, tile_y);
         triggerViewTile(found, section_id, mode_view, view_time);
+      }
     }
   }
 }
@@ -3910,6 +4257,7 @@ void Map::unlockTile(int section_id, int tile_x, int tile_y,
 /* Updates the game state */
 bool Map::update(int cycle_time)
 {
+  ProfileScope zone_scope(ProfileZone::MAP_UPDATE);
   Floatinate player_move;
   std::vector<std::vector<Tile*>> tile_set;
 
@@ -3974,11 +4322,13 @@ bool Map::update(int cycle_time)
 
     /* Update map interactive objects */
     for(uint32_t j = 0; j < sub_map[i].ios.size(); j++)
-      sub_map[i].ios[j]->update(cycle_time, tile_set, active_map);
+      sub_map[i].ios[j]->setRenderDelta(
+          sub_map[i].ios[j]->update(cycle_time, tile_set, active_map));
 
     /* Update map items */
     for(uint32_t j = 0; j < sub_map[i].items.size(); j++)
-      sub_map[i].items[j]->update(cycle_time, tile_set, active_map);
+      sub_map[i].items[j]->setRenderDelta(
+          sub_map[i].items[j]->update(cycle_time, tile_set, active_map));
 
     /* Update persons for movement and animation */
     for(uint32_t j = 0; j < sub_map[i].persons.size(); j++)
@@ -4000,6 +4350,7 @@ bool Map::update(int cycle_time)
       /* Update person */
       Floatinate person_move =
           sub_map[i].persons[j]->update(cycle_time, tile_set, active_map);
+      sub_map[i].persons[j]->setRenderDelta(person_move);
 
       /* If player, record and store move distance */
       if(sub_map[i].persons[j] == player && active_map)
@@ -4008,7 +4359,8 @@ bool Map::update(int cycle_time)
 
     /* Update map things */
     for(uint32_t j = 0; j < sub_map[i].things.size(); j++)
-      sub_map[i].things[j]->update(cycle_time, tile_set, active_map);
+      sub_map[i].things[j]->setRenderDelta(
+          sub_map[i].things[j]->update(cycle_time, tile_set, active_map));
   }
 
   /* If conversation is active, confirm that player is not moving */
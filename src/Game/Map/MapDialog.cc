@@ -19,6 +19,7 @@
  *  - {12} - id to text name reference change
  ******************************************************************************/
 #include "Game/Map/MapDialog.h"
+#include "TextureRegistry.h"
 
 /* Constant Implementation - see header file for descriptions */
 const uint8_t MapDialog::kBORDER_WIDTH = 1;
@@ -597,9 +598,9 @@ void MapDialog::setupConversation(SDL_Renderer* renderer)
     }
 
     /* Render texture creation and setup */
-    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                                             SDL_TEXTUREACCESS_TARGET,
-                                             render_width, render_height);
+    SDL_Texture* texture = TextureRegistry::create(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        render_width, render_height);
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -723,9 +724,9 @@ void MapDialog::setupNotification(SDL_Renderer* renderer)
   }
 
   /* Create rendering texture */
-  SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, render_width, render_height);
+  SDL_Texture* texture = TextureRegistry::create(
+      renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+      render_width, render_height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
@@ -810,9 +811,9 @@ void MapDialog::setupPickup(SDL_Renderer* renderer, bool update)
   render_width += pickup_txt.getWidth();
 
   /* Create rendering texture */
-  SDL_Texture* texture =
-      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET, render_width, render_height);
+  SDL_Texture* texture = TextureRegistry::create(
+      renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+      render_width, render_height);
   SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
   SDL_SetRenderTarget(renderer, texture);
   SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
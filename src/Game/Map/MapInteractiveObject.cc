@@ -709,7 +709,8 @@ void MapInteractiveObject::unsetTile(uint32_t x, uint32_t y, bool no_events)
  *         bool from_save - true if the load is from a save file
  * Output: bool - status if successful
  */
-bool MapInteractiveObject::addThingInformation(XmlData data, int file_index,
+bool MapInteractiveObject::addThingInformation(const XmlData& data,
+                                               int file_index,
                                                int section_index,
                                                SDL_Renderer* renderer,
                                                std::string base_path,
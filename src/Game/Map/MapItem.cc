@@ -202,7 +202,7 @@ void MapItem::unsetTile(uint32_t x, uint32_t y, bool no_events)
  *         bool from_save - true if the load is from a save file
  * Output: bool - status if successful
  */
-bool MapItem::addThingInformation(XmlData data, int file_index,
+bool MapItem::addThingInformation(const XmlData& data, int file_index,
                                   int section_index, SDL_Renderer* renderer,
                                   std::string base_path, bool from_save)
 {
@@ -882,7 +882,7 @@ bool MapNPC::setDirection(Direction direction, bool set_movement, bool forced)
  *         bool from_save - true if the load is from a save file
  * Output: bool - status if successful
  */
-bool MapNPC::addThingInformation(XmlData data, int file_index,
+bool MapNPC::addThingInformation(const XmlData& data, int file_index,
                                  int section_index, SDL_Renderer* renderer,
                                  std::string base_path, bool from_save)
 {
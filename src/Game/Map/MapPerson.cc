@@ -612,7 +612,7 @@ void MapPerson::unsetTile(uint32_t x, uint32_t y, bool no_events)
  *         bool from_save - true if the load is from a save file
  * Output: bool - status if successful
  */
-bool MapPerson::addThingInformation(XmlData data, int file_index,
+bool MapPerson::addThingInformation(const XmlData& data, int file_index,
                                     int section_index, SDL_Renderer* renderer,
                                     std::string base_path, bool from_save)
 {
@@ -56,7 +56,7 @@ MapState::~MapState()
  *         std::string base_path - the base path for resources
  * Output: bool - true if the add was successful
  */
-bool MapState::addFileInformation(XmlData data, int file_index,
+bool MapState::addFileInformation(const XmlData& data, int file_index,
                                   int section_index, SDL_Renderer* renderer,
                                   std::string base_path)
 {
@@ -979,7 +979,7 @@ void MapThing::unsetTile(uint32_t x, uint32_t y, bool no_events)
  *         bool from_save - true if the load is from a save file
  * Output: bool - status if successful
  */
-bool MapThing::addThingInformation(XmlData data, int file_index,
+bool MapThing::addThingInformation(const XmlData& data, int file_index,
                                    int section_index, SDL_Renderer* renderer,
                                    std::string base_path, bool from_save)
 {
@@ -1743,6 +1743,21 @@ uint16_t MapThing::getSpeed() const
   return speed;
 }
 
+/*
+ * Description: Returns the pixel offset between the current location and the
+ *              location interpolated between the last two update ticks. The
+ *              offset is added to the viewport offset when rendering.
+ *
+ * Inputs: float alpha - progress from the last tick to the next (0.0 - 1.0)
+ * Output: Floatinate - the x and y offset, in pixels
+ */
+Floatinate MapThing::getRenderLag(float alpha)
+{
+  float lag = 1.0 - alpha;
+  return Floatinate(render_delta.x * lag * getTileWidth(),
+                    render_delta.y * lag * getTileHeight());
+}
+
 /*
  * Description: Returns the section of map the thing started in, as set by
  *              setLocationStart(*).
@@ -2641,6 +2656,18 @@ void MapThing::setSoundID(int32_t id)
     sound_id = id;
 }
 
+/*
+ * Description: Sets the movement of the last update tick, as returned by the
+ *              update call. Used to interpolate the render location.
+ *
+ * Inputs: Floatinate delta - the x and y movement, in tiles
+ * Output: none
+ */
+void MapThing::setRenderDelta(Floatinate delta)
+{
+  render_delta = delta;
+}
+
 /*
  * Description: Sets the speed of the thing that it is moving in. Default is
  *              150 and gets set if the speed is invalid (less than 0).
@@ -79,13 +79,13 @@ void MapViewport::correlateSize()
   int old_width = map_width;
   map_width = map_width_tiles * tile_width;
   if(old_width > 0 && old_width != map_width)
-    x = map_width * x / old_width;
+    x = x_prev = map_width * x / old_width;
 
   /* Y correlation */
   int old_height = map_height;
   map_height = map_height_tiles * tile_height;
   if(old_height > 0 && old_height != map_height)
-    y = map_height * y / old_height;
+    y = y_prev = map_height * y / old_height;
 }
 
 /*============================================================================
@@ -104,6 +104,7 @@ void MapViewport::clear()
   travel_force = false;
 
   /* Reset the map and viewport coordinates */
+  clearLocation();
   setMapSize(0, 0);
   setSize(kMIN_WIDTH, kMIN_HEIGHT);
   setTileSize(kMIN_WIDTH, kMIN_HEIGHT);
@@ -129,7 +130,9 @@ void MapViewport::clear()
 void MapViewport::clearLocation()
 {
   x = 0.0;
+  x_prev = 0.0;
   y = 0.0;
+  y_prev = 0.0;
 }
 
 /*
@@ -301,6 +304,22 @@ uint16_t MapViewport::getXTileStart()
   return (getXStart() / tile_width);
 }
 
+/*
+ * Description: Gets the X location for rendering, interpolated between the
+ *              previous and current update tick. Jumps of a tile or more (lock
+ *              changes, teleports) are not interpolated.
+ *
+ * Inputs: float alpha - progress from the last tick to the next (0.0 - 1.0)
+ * Output: float - the interpolated X location decimal
+ */
+float MapViewport::getXRender(float alpha)
+{
+  float diff = x - x_prev;
+  if(diff > -tile_width && diff < tile_width)
+    return getX() - (1.0 - alpha) * diff;
+  return getX();
+}
+
 /*
  * Description: Gets the Y location relative to the map in pixels of the top
  *              left location of the viewport.
@@ -383,6 +402,22 @@ uint16_t MapViewport::getYTileStart()
   return (getYStart() / tile_height);
 }
 
+/*
+ * Description: Gets the Y location for rendering, interpolated between the
+ *              previous and current update tick. Jumps of a tile or more (lock
+ *              changes, teleports) are not interpolated.
+ *
+ * Inputs: float alpha - progress from the last tick to the next (0.0 - 1.0)
+ * Output: float - the interpolated Y location decimal
+ */
+float MapViewport::getYRender(float alpha)
+{
+  float diff = y - y_prev;
+  if(diff > -tile_height && diff < tile_height)
+    return getY() - (1.0 - alpha) * diff;
+  return getY();
+}
+
 /*
  * Description: Returns if the travel is forced. If true, once travel is enabled
  *              it will not reset until travel force is disabled
@@ -674,6 +709,9 @@ bool MapViewport::triggerVibrationFinish(bool force)
  */
 void MapViewport::update(int cycle_time)
 {
+  x_prev = x;
+  y_prev = y;
+
   float center_x = 0.0;
   float center_y = 0.0;
   float delta_x = 0.0;
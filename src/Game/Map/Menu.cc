@@ -12,6 +12,8 @@
 * See .h file for TODOs
 *******************************************************************************/
 #include "Game/Map/Menu.h"
+#include "Profiler.h"
+#include "TextureRegistry.h"
 
 /*=============================================================================
  * CONSTANTS
@@ -409,8 +411,8 @@ SDL_Texture* Menu::buildItemListFrame(Item* build_item, int32_t count,
     t_item_count.setText(renderer, std::to_string(count), kCOLOR_TEXT);
 
     SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, width, height);
+        TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                SDL_TEXTUREACCESS_TARGET, width, height);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
@@ -441,8 +443,8 @@ SDL_Texture* Menu::buildSkillListFrame(Skill* build_skill, uint32_t width,
     t_skill_name.setText(renderer, build_skill->getName(), kCOLOR_TEXT);
 
     SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, width, height);
+        TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                SDL_TEXTUREACCESS_TARGET, width, height);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
@@ -1071,8 +1073,8 @@ SDL_Texture* Menu::buildAttributeFrame(Attribute attr, uint32_t width,
     auto inset = (uint32_t)std::round(width * kSLEUTH_ATTRIBUTE_INSET);
 
     SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, width, height);
+        TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                SDL_TEXTUREACCESS_TARGET, width, height);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
@@ -1136,8 +1138,8 @@ SDL_Texture* Menu::buildElementFrame(ElementType element_type, uint32_t width,
     auto inset = (uint32_t)std::round(width * kSLEUTH_ATTRIBUTE_INSET);
 
     SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, width, height);
+        TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                SDL_TEXTUREACCESS_TARGET, width, height);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
@@ -3370,6 +3372,7 @@ void Menu::show()
 /* Render function to call other render functions */
 void Menu::render()
 {
+  ProfileScope zone_scope(ProfileZone::MENU_RENDER);
   if(renderer && config)
   {
     if(main_section.status != WindowStatus::OFF)
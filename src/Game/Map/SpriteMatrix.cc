@@ -10,6 +10,7 @@
 
 /* Constant Implementation - see header file for descriptions */
 const float SpriteMatrix::kBASE_FRAME_COUNT = 2.0;
+const uint8_t SpriteMatrix::kMAX_RANGES = 64;
 
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
@@ -301,7 +302,7 @@ void SpriteMatrix::removeSprite(uint16_t x, uint16_t y, bool delete_sprite)
  *         std::string base_path - the base path for resources
  * Output: bool - true if the add was successful
  */
-bool SpriteMatrix::addFileInformation(XmlData data, int file_index,
+bool SpriteMatrix::addFileInformation(const XmlData& data, int file_index,
                                       SDL_Renderer* renderer,
                                       std::string base_path)
 {
@@ -336,6 +337,7 @@ bool SpriteMatrix::addFileInformation(XmlData data, int file_index,
       growMatrix(x_max, y_max);
 
       /* Go through and set the frames in all relevant sprites */
+      XmlData frame_data = data;
       for(uint32_t i = x_min; i <= x_max; i++)
       {
         for(uint32_t j = y_min; j <= y_max; j++)
@@ -344,8 +346,8 @@ bool SpriteMatrix::addFileInformation(XmlData data, int file_index,
             setSprite(new TileSprite(*valid_sprite), i, j);
           else if(sprite_matrix[i][j]->isFramesSet())
             sprite_matrix[i][j]->removeAll();
-          data.addDataOfType(str_matrix[i-x_min][j-y_min]);
-          sprite_matrix[i][j]->addFileInformation(data, file_index + 1,
+          frame_data.addDataOfType(str_matrix[i-x_min][j-y_min]);
+          sprite_matrix[i][j]->addFileInformation(frame_data, file_index + 1,
                                                   renderer, base_path, true);
         }
       }
@@ -375,22 +377,41 @@ bool SpriteMatrix::addFileInformation(XmlData data, int file_index,
   {
     uint32_t index = 0;
 
-    /* Get the x and y coordinate */
-    std::vector<std::vector<uint16_t>> x_set =
-                          Helpers::parseRangeSet(data.getKeyValue(file_index));
-    std::vector<std::vector<uint16_t>> y_set =
-                      Helpers::parseRangeSet(data.getKeyValue(file_index + 1));
+    /* Get the x and y coordinate. Sets larger than the stack buffers are
+     * parsed again into buffers of their size */
+    ValueRange x_stack[kMAX_RANGES];
+    ValueRange y_stack[kMAX_RANGES];
+    std::vector<ValueRange> x_heap;
+    std::vector<ValueRange> y_heap;
+    ValueRange* x_set = x_stack;
+    ValueRange* y_set = y_stack;
+    std::string x_sequence = data.getKeyValue(file_index);
+    std::string y_sequence = data.getKeyValue(file_index + 1);
+    uint32_t x_count = Helpers::parseRangeSet(x_sequence, x_set, kMAX_RANGES);
+    uint32_t y_count = Helpers::parseRangeSet(y_sequence, y_set, kMAX_RANGES);
+    if(x_count > kMAX_RANGES)
+    {
+      x_heap.resize(x_count);
+      x_set = x_heap.data();
+      Helpers::parseRangeSet(x_sequence, x_set, x_count);
+    }
+    if(y_count > kMAX_RANGES)
+    {
+      y_heap.resize(y_count);
+      y_set = y_heap.data();
+      Helpers::parseRangeSet(y_sequence, y_set, y_count);
+    }
 
     /* Run through all the coordinates */
-    while(index < x_set.size() && index < y_set.size())
+    while(index < x_count && index < y_count)
     {
       /* Ensure that the range is sufficient */
-      growMatrix(x_set[index].back(), y_set[index].back());
+      growMatrix(x_set[index].max, y_set[index].max);
 
       /* Loop through the range and add it to each one */
-      for(uint32_t i = x_set[index].front(); i <= x_set[index].back(); i++)
+      for(uint32_t i = x_set[index].min; i <= x_set[index].max; i++)
       {
-        for(uint32_t j = y_set[index].front(); j <= y_set[index].back(); j++)
+        for(uint32_t j = y_set[index].min; j <= y_set[index].max; j++)
         {
           if(sprite_matrix[i][j] == NULL)
             setSprite(new TileSprite(*valid_sprite), i, j);
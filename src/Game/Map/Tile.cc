@@ -897,6 +897,42 @@ bool Tile::insertUpper(Sprite* upper, uint8_t index)
   return false;
 }
 
+/*
+ * Description: Returns if a sprite of the lower layers (base, enhancer or
+ *              lower) has more than one frame. Tiles without one can be
+ *              pre-rendered.
+ *
+ * Inputs: none
+ * Output: bool - true if a lower layer sprite animates
+ */
+bool Tile::isAnimatedLower() const
+{
+  bool animated = (base != NULL && base->getSize() > 1) ||
+                  (enhancer != NULL && enhancer->getSize() > 1);
+
+  for(uint8_t i = 0; !animated && i < lower.size(); i++)
+    animated = (lower[i] != NULL && lower[i]->getSize() > 1);
+
+  return animated;
+}
+
+/*
+ * Description: Returns if a sprite of the upper layers has more than one
+ *              frame. Tiles without one can be pre-rendered.
+ *
+ * Inputs: none
+ * Output: bool - true if an upper layer sprite animates
+ */
+bool Tile::isAnimatedUpper() const
+{
+  bool animated = false;
+
+  for(uint8_t i = 0; !animated && i < upper.size(); i++)
+    animated = (upper[i] != NULL && upper[i]->getSize() > 1);
+
+  return animated;
+}
+
 /*
  * Description: Returns if the Base Sprite is set
  *
@@ -1196,6 +1232,72 @@ bool Tile::renderUpper(SDL_Renderer* renderer, int offset_x, int offset_y)
   return success;
 }
 
+/*
+ * Description: Renders one lower layer of the tile: 0 is the base (or the
+ *              blank fill), 1 is the enhancer and the rest are the lower
+ *              sprites. Sprites that can be batched are added to the batch,
+ *              which the caller submits once the layer is done for all tiles.
+ *
+ * Inputs: SDL_Renderer* renderer - the sdl graphical rendering context
+ *         RenderBatch& batch - the batch of the layer
+ *         uint8_t layer - the lower layer, below getLowerLayerCount()
+ *         int offset_x - the paint offset in the x direction
+ *         int offset_y - the paint offset in the y direction
+ * Output: bool - status if successful
+ */
+bool Tile::renderLower(SDL_Renderer* renderer, RenderBatch& batch,
+                       uint8_t layer, int offset_x, int offset_y)
+{
+  int pixel_x = getPixelX() - offset_x;
+  int pixel_y = getPixelY() - offset_y;
+  Sprite* sprite = nullptr;
+
+  /* Blanked tiles are filled on the base layer */
+  if(status == BLANKED && layer == 0)
+  {
+    SDL_Rect tile_rect = {pixel_x, pixel_y, width, height};
+    SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xFF);
+    return (SDL_RenderFillRect(renderer, &tile_rect) == 0);
+  }
+  else if(status != ACTIVE)
+  {
+    return true;
+  }
+
+  if(layer == 0)
+    sprite = base;
+  else if(layer == 1)
+    sprite = enhancer;
+  else if(layer - 2 < static_cast<int>(lower.size()))
+    sprite = lower[layer - 2];
+
+  if(sprite != nullptr)
+    return sprite->renderBatch(batch, renderer, pixel_x, pixel_y, width,
+                               height);
+  return true;
+}
+
+/*
+ * Description: Renders one upper layer of the tile. Sprites that can be
+ *              batched are added to the batch, which the caller submits once
+ *              the layer is done for all tiles.
+ *
+ * Inputs: SDL_Renderer* renderer - the sdl graphical rendering context
+ *         RenderBatch& batch - the batch of the layer
+ *         uint8_t layer - the upper layer, below getUpperLayerCount()
+ *         int offset_x - the paint offset in the x direction
+ *         int offset_y - the paint offset in the y direction
+ * Output: bool - status if successful
+ */
+bool Tile::renderUpper(SDL_Renderer* renderer, RenderBatch& batch,
+                       uint8_t layer, int offset_x, int offset_y)
+{
+  if(status == ACTIVE && layer < upper.size() && upper[layer] != nullptr)
+    return upper[layer]->renderBatch(batch, renderer, getPixelX() - offset_x,
+                                     getPixelY() - offset_y, width, height);
+  return true;
+}
+
 /*
  * Description: Sets the base sprite stored within the tile. Only sets it
  *              if the pointer is valid and the number of frames is greater
@@ -1519,8 +1621,8 @@ void Tile::setY(uint16_t y)
  *         int section_index - the relevant map section index
  * Output: bool - returns if the call was successful
  */
-bool Tile::updateEventEnter(XmlData data, int file_index,
-                                          uint16_t section_index)
+bool Tile::updateEventEnter(const XmlData& data, int file_index,
+                            uint16_t section_index)
 {
   /* Parse depending on the key value */
   if(data.getElement(file_index) == "tileevent")
@@ -1542,7 +1644,8 @@ bool Tile::updateEventEnter(XmlData data, int file_index,
  *         int section_index - the relevant map section index
  * Output: bool - returns if the call was successful
  */
-bool Tile::updateEventExit(XmlData data, int file_index, uint16_t section_index)
+bool Tile::updateEventExit(const XmlData& data, int file_index,
+                           uint16_t section_index)
 {
     /* Parse depending on the key value */
   if(data.getElement(file_index) == "tileevent")
@@ -1864,3 +1967,30 @@ bool Tile::unsetUpper(uint8_t index)
   }
   return false;
 }
+
+/*=============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the number of lower render layers of a tile: the
+ *              base, the enhancer and the lower sprites.
+ *
+ * Inputs: none
+ * Output: uint8_t - the number of lower layers
+ */
+uint8_t Tile::getLowerLayerCount()
+{
+  return kLOWER_COUNT_MAX + 2;
+}
+
+/*
+ * Description: Returns the number of upper render layers of a tile.
+ *
+ * Inputs: none
+ * Output: uint8_t - the number of upper layers
+ */
+uint8_t Tile::getUpperLayerCount()
+{
+  return kUPPER_COUNT_MAX;
+}
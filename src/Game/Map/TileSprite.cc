@@ -136,8 +136,8 @@ void TileSprite::copySelf(const TileSprite &source, bool only_sprite)
  *         std::string base_path - the base path for resources
  * Output: bool - true if the add was successful
  */
-bool TileSprite::addFileInformation(XmlData data, int index, 
-                                    SDL_Renderer* renderer, 
+bool TileSprite::addFileInformation(const XmlData& data, int index, 
+                                    SDL_Renderer* renderer,
                                     std::string base_path, bool no_warnings)
 {
   std::string element = data.getElement(index);
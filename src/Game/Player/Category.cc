@@ -269,7 +269,7 @@ bool Category::isImmune(const Infliction &check_immunity)
  *         SDL_Renderer* renderer - the rendering engine
  * Output: bool - true if load was successful
  */
-bool Category::loadData(XmlData data, int index, SDL_Renderer* renderer)
+bool Category::loadData(const XmlData& data, int index, SDL_Renderer* renderer)
 {
   (void)renderer;
   bool success = true;
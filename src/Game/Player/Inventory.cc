@@ -542,7 +542,7 @@ uint32_t Inventory::hasRoom(Item* const i, uint32_t n)
  *         std::string base_path - the base path for file handling
  * Output: bool - true if load was successful
  */
-bool Inventory::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Inventory::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                          std::string base_path)
 {
   (void)renderer;
@@ -363,7 +363,7 @@ bool Item::isBaseItem()
  *         SDL_Renderer* renderer - the rendering engine
  * Output: bool - true if load was successful
  */
-bool Item::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Item::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                     std::string base_path)
 {
   bool success = true;
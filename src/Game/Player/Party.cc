@@ -256,7 +256,7 @@ bool Party::isInParty(Person* const check_person)
  *         SDL_Renderer* renderer - the rendering engine
  * Output: bool - true if load was successful
  */
-bool Party::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Party::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                      std::string base_path)
 {
   bool success = true;
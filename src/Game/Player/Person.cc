@@ -692,7 +692,7 @@ bool Person::isPowerGuarder()
  *         std::string base_path - the base path for file handling
  * Output: bool - true if load was successful
  */
-bool Person::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Person::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                       std::string base_path)
 {
   bool success = true;
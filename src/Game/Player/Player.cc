@@ -260,7 +260,7 @@ uint32_t Player::getSteps()
  *         std::string base_path - the base path for file handling
  * Output: bool - true if load was successful
  */
-bool Player::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Player::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                       std::string base_path)
 {
   bool success = true;
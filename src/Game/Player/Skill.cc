@@ -299,7 +299,7 @@ bool Skill::isValid()
  *         SDL_Renderer* renderer - the rendering engine
  * Output: bool - true if load was successful
  */
-bool Skill::loadData(XmlData data, int index, SDL_Renderer* renderer,
+bool Skill::loadData(const XmlData& data, int index, SDL_Renderer* renderer,
                      std::string base_path)
 {
   bool success = true;
@@ -8,12 +8,22 @@
 * See .h file for TODOs
 ******************************************************************************/
 #include "Game/Save.h"
+#include "FileHandler.h"
+#include "TextureRegistry.h"
+#include "XmlStream.h"
+
+#include <chrono>
+#include <limits>
 
 /*=============================================================================
 * CONSTANTS
 *============================================================================*/
 const int32_t Save::kUNSET_ID = 1;
 const SDL_Color Save::kCOLOR_TEXT{255, 255, 255, 255};
+const std::string Save::kSUMMARY_EXTENSION = ".summary";
+const std::string Save::kSUMMARY_MAGIC = "FISS";
+const uint32_t Save::kSUMMARY_PREFIX = 512;
+const uint32_t Save::kSUMMARY_VERSION = 2;
 
 /*=============================================================================
 * CONSTRUCTORS / DESTRUCTORS
@@ -39,6 +49,7 @@ Save::Save()
       player_name{"Player"},
       player_sex{Sex::FEMALE},
       snapshot_path{""},
+      stamp{""},
       time_hrs{0},
       time_min{0},
       time_sec{0},
@@ -131,6 +142,7 @@ bool Save::clear()
     setFlag(SaveState::EMPTY, true);
     map_name = "";
     snapshot_path = "";
+    stamp = "";
     time_hrs = 0;
     time_min = 0;
     time_sec = 0;
@@ -153,6 +165,12 @@ std::string Save::getSnapshotPath()
   return snapshot_path;
 }
 
+/* Returns the token of the save write */
+std::string Save::getStamp()
+{
+  return stamp;
+}
+
 /* Returns the time data elements */
 uint32_t Save::getTimeHours()
 {
@@ -171,6 +189,45 @@ uint32_t Save::getTimeSeconds()
   return time_sec;
 }
 
+/* Loads the summary of the save, if it exists and was written for the current
+ * save file (matching write token). Nothing changes on failure */
+bool Save::loadSummary(std::string save_path)
+{
+  std::ifstream file(getSummaryPath(save_path).c_str());
+  if(!file.is_open())
+    return false;
+
+  /* Header and stamp */
+  std::string magic;
+  uint32_t version = 0;
+  std::string summary_stamp;
+  file >> magic >> version >> summary_stamp;
+  if(!file || magic != kSUMMARY_MAGIC || version != kSUMMARY_VERSION ||
+     summary_stamp != readStamp(save_path))
+    return false;
+
+  /* Fields - the names fill the last lines */
+  Save summary(*this);
+  std::string sex;
+  file >> summary.date_year >> summary.date_month >> summary.date_day >>
+      summary.date_hour >> summary.date_minute;
+  file >> summary.time_hrs >> summary.time_min >> summary.time_sec;
+  file >> summary.count_level >> summary.count_steps >>
+      summary.count_credits >> sex;
+  file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  std::getline(file, summary.player_name);
+  std::getline(file, summary.map_name);
+  if(!file)
+    return false;
+
+  summary.player_sex = Helpers::sexFromStr(sex);
+  summary.stamp = summary_stamp;
+  summary.setFlag(SaveState::EMPTY, false);
+  *this = summary;
+
+  return true;
+}
+
 /* Prints the class data - primarily for testing */
 void Save::print()
 {
@@ -234,9 +291,9 @@ SDL_Texture* Save::createRenderFrame(SDL_Renderer* renderer)
 
     auto gap = (int32_t)(std::floor((location.height - height) / 2));
 
-    SDL_Texture* texture =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, save_width, save_height);
+    SDL_Texture* texture = TextureRegistry::create(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        save_width, save_height);
     SDL_SetRenderTarget(renderer, texture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
@@ -347,6 +404,36 @@ SDL_Texture* Save::createRenderFrame(SDL_Renderer* renderer)
   return nullptr;
 }
 
+/* Writes the summary of the save next to the save file, stamped with the
+ * token of the save write. Saves without a token get no summary */
+bool Save::saveSummary(std::string save_path)
+{
+  std::string summary_path = getSummaryPath(save_path);
+  if(stamp.empty())
+    return false;
+
+  std::ofstream file(summary_path.c_str(), std::ios::trunc);
+  file << kSUMMARY_MAGIC << " " << kSUMMARY_VERSION << "\n";
+  file << stamp << "\n";
+  file << date_year << " " << date_month << " " << date_day << " "
+       << date_hour << " " << date_minute << "\n";
+  file << time_hrs << " " << time_min << " " << time_sec << "\n";
+  file << count_level << " " << count_steps << " " << count_credits << " "
+       << Helpers::sexToStr(player_sex) << "\n";
+  file << player_name << "\n" << map_name << "\n";
+  file.close();
+
+  if(!file)
+  {
+    std::cerr << "[ERROR] Unable to write save summary: " << summary_path
+              << std::endl;
+    FileHandler::fileDelete(summary_path);
+    return false;
+  }
+
+  return true;
+}
+
 /* Assigns configuration to the save file */
 bool Save::setConfig(Options* config)
 {
@@ -401,6 +488,27 @@ void Save::setDate(uint32_t date_year, uint32_t date_month, uint32_t date_day,
   setFlag(SaveState::EMPTY, false);
 }
 
+/* Assign the date data from the save file date (YYYY/MM/DD HH:MM:SS) */
+bool Save::setDate(std::string date_time)
+{
+  std::string_view date_split[2];
+  std::string_view day_split[3];
+  std::string_view time_split[3];
+
+  /* Year, Month, Day and Hour, Minute, Second */
+  if(Helpers::splitView(date_time, ' ', date_split, 2) == 2 &&
+     Helpers::splitView(date_split[0], '/', day_split, 3) == 3 &&
+     Helpers::splitView(date_split[1], ':', time_split, 3) == 3)
+  {
+    setDate(Helpers::viewToInt(day_split[0]), Helpers::viewToInt(day_split[1]),
+            Helpers::viewToInt(day_split[2]), Helpers::viewToInt(time_split[0]),
+            Helpers::viewToInt(time_split[1]));
+    return true;
+  }
+
+  return false;
+}
+
 /* Assign a MenuState flag a value */
 void Save::setFlag(SaveState set_flags, const bool& set_value)
 {
@@ -421,6 +529,12 @@ void Save::setSnapshotPath(std::string path)
   setFlag(SaveState::EMPTY, false);
 }
 
+/* Sets the token of the save write */
+void Save::setStamp(std::string stamp)
+{
+  this->stamp = stamp;
+}
+
 /* Assign time data to the object */
 void Save::setTime(uint32_t time_hrs, uint32_t time_min, uint32_t time_sec)
 {
@@ -433,3 +547,40 @@ void Save::setTime(uint32_t time_hrs, uint32_t time_min, uint32_t time_sec)
 /*=============================================================================
 * PUBLIC STATIC FUNCTIONS
 *============================================================================*/
+
+/* Creates a new token for a save write - the clock ticks at write time */
+std::string Save::createStamp()
+{
+  return std::to_string(
+      std::chrono::system_clock::now().time_since_epoch().count());
+}
+
+/* Returns the summary path of the save path */
+std::string Save::getSummaryPath(std::string save_path)
+{
+  return save_path + kSUMMARY_EXTENSION;
+}
+
+/* Reads the token of the save write from the start of the save. It follows
+ * the date, so only the first bytes are read. Empty if there is none */
+std::string Save::readStamp(std::string save_path)
+{
+  std::string prefix(kSUMMARY_PREFIX, '\0');
+  std::string save_stamp = "";
+  std::ifstream file(save_path.c_str(), std::ios::binary);
+  if(!file.is_open())
+    return save_stamp;
+
+  file.read(&prefix[0], prefix.size());
+  prefix.resize(file.gcount());
+
+  XmlStream::parse(prefix, [&](const XmlLeaf& leaf) {
+    if(leaf.getNumElements() != 1)
+      return false;
+    if(leaf.getElement(0) == "stamp")
+      save_stamp = std::string(leaf.getText());
+    return save_stamp.empty() && leaf.getElement(0) == "date";
+  });
+
+  return save_stamp;
+}
@@ -0,0 +1,698 @@
+/*******************************************************************************
+ * Class Name: GamePack
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Compiled binary form of a game (or save) XML file. The compiler
+ *              reads every data leaf of the XML once and writes it as a typed
+ *              record into a section: one section for the core data and one
+ *              per map level. A table of contents holds the byte offset,
+ *              length and record count of each section, so a load reads the
+ *              core section and the single requested map directly instead of
+ *              scanning the full document for each. The game also keeps it
+ *              as a cache of the base file: a base file loaded from XML is
+ *              compiled in the background for the next start, together with
+ *              the core tables constructed from it (see GameTables). These
+ *              replace the records of the tables, so the next start restores
+ *              the core objects instead of building them again.
+ ******************************************************************************/
+#include "GamePack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "FileHandler.h"
+#include "LoadReport.h"
+#include "Xxtea.h"
+
+/* Constant Implementation - see header file for descriptions */
+const std::string GamePack::kEXTENSION = ".pack";
+const uint32_t GamePack::kFLAG_ENCRYPTED = 0x1;
+const uint32_t GamePack::kHEADER_SIZE = 48;
+const std::string GamePack::kMAGIC = "FISP";
+const std::vector<std::string> GamePack::kTABLE_ELEMENTS = {
+    "action", "class", "item", "person", "race", "skill", "skillset"};
+const std::string GamePack::kTEMP_EXTENSION = ".tmp";
+const uint32_t GamePack::kVERSION = 5;
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructor function - no pack is open.
+ *
+ * Inputs: none
+ */
+GamePack::GamePack() : pack_encrypted{false}
+{
+}
+
+/*
+ * Description: Destructor function - closes the pack.
+ */
+GamePack::~GamePack()
+{
+  close();
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Encrypts the section buffer in place, padded with zeros to
+ *              whole words and to at least the Xxtea minimum, or decrypts it.
+ *              The padding follows the last record and is never decoded.
+ *
+ * Inputs: std::string& buffer - the section buffer
+ *         bool encrypt - true to encrypt, false to decrypt
+ * Output: bool - true on success. False if an encrypted buffer is not whole
+ *         words
+ */
+bool GamePack::cryptSection(std::string& buffer, bool encrypt)
+{
+  uint32_t length = (buffer.size() + 3) / 4;
+  if(length < Xxtea::getMinLength())
+    length = Xxtea::getMinLength();
+
+  if(encrypt)
+    buffer.resize(length * 4, '\0');
+  else if(buffer.size() != length * 4)
+    return false;
+
+  /* Little endian words, so the pack is the same on every target */
+  std::vector<uint32_t> words(length, 0);
+  for(uint32_t i = 0; i < length * 4; i++)
+    words[i / 4] |= static_cast<uint32_t>(static_cast<uint8_t>(buffer[i]))
+                    << ((i % 4) * 8);
+
+  bool success = encrypt ? Xxtea::encrypt(words.data(), length)
+                         : Xxtea::decrypt(words.data(), length);
+
+  for(uint32_t i = 0; i < length * 4; i++)
+    buffer[i] = static_cast<char>((words[i / 4] >> ((i % 4) * 8)) & 0xFF);
+
+  return success;
+}
+
+/*
+ * Description: Decodes one record from the section buffer into the XML data,
+ *              as it would have been returned by FileHandler::readXmlData().
+ *
+ * Inputs: const std::string& buffer - the section buffer
+ *         uint32_t& pos - the read position. Advanced past the record
+ *         XmlData& data - the decoded data
+ * Output: bool - true if the record was complete
+ */
+bool GamePack::decodeRecord(const std::string& buffer, uint32_t& pos,
+                            XmlData& data)
+{
+  uint64_t count = 0;
+  uint64_t type = 0;
+  bool success = takeValue(buffer, pos, count, 1);
+
+  /* Element stack */
+  for(uint64_t i = 0; success && i < count; i++)
+  {
+    std::string element, key, value;
+    success &= takeString(buffer, pos, element) &&
+               takeString(buffer, pos, key) && takeString(buffer, pos, value);
+    if(success)
+      data.addElement(element, key, value);
+  }
+
+  /* Typed data */
+  success &= takeValue(buffer, pos, type, 1);
+  if(success)
+  {
+    uint64_t raw = 0;
+
+    if(type == XmlData::BOOLEAN && takeValue(buffer, pos, raw, 1))
+    {
+      data.addDataOfType(raw != 0);
+    }
+    else if(type == XmlData::INTEGER && takeValue(buffer, pos, raw, 4))
+    {
+      data.addDataOfType(static_cast<int>(static_cast<int32_t>(raw)));
+    }
+    else if(type == XmlData::FLOAT && takeValue(buffer, pos, raw, 4))
+    {
+      uint32_t bits = raw;
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      data.addDataOfType(value);
+    }
+    else if(type == XmlData::STRING)
+    {
+      std::string value;
+      success &= takeString(buffer, pos, value, true);
+      data.addDataOfType(value);
+    }
+    else
+    {
+      success = false;
+    }
+  }
+
+  return success;
+}
+
+/*
+ * Description: Encodes the element stack and typed data of one XML data leaf
+ *              onto the section buffer.
+ *
+ * Inputs: std::string& buffer - the section buffer
+ *         XmlData& data - the data to encode
+ * Output: none
+ */
+void GamePack::encodeRecord(std::string& buffer, XmlData& data)
+{
+  std::vector<std::string> elements = data.getAllElements();
+  std::vector<std::string> keys = data.getAllKeys();
+  std::vector<std::string> values = data.getAllKeyValues();
+
+  /* Element stack */
+  putValue(buffer, elements.size(), 1);
+  for(uint32_t i = 0; i < elements.size(); i++)
+  {
+    putString(buffer, elements[i]);
+    putString(buffer, keys[i]);
+    putString(buffer, values[i]);
+  }
+
+  /* Typed data */
+  XmlData::DataType type = data.getDataType();
+  putValue(buffer, type, 1);
+  if(type == XmlData::BOOLEAN)
+  {
+    putValue(buffer, data.getDataBool() ? 1 : 0, 1);
+  }
+  else if(type == XmlData::INTEGER)
+  {
+    putValue(buffer, static_cast<uint32_t>(data.getDataInteger()), 4);
+  }
+  else if(type == XmlData::FLOAT)
+  {
+    float value = data.getDataFloat();
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    putValue(buffer, bits, 4);
+  }
+  else if(type == XmlData::STRING)
+  {
+    putString(buffer, data.getDataString(), true);
+  }
+}
+
+/*
+ * Description: Appends a length prefixed string. Element strings use a 16 bit
+ *              length and data strings (wide) a 32 bit length.
+ *
+ * Inputs: std::string& buffer - the buffer to append to
+ *         const std::string& value - the string
+ *         bool wide - true for a 32 bit length
+ * Output: none
+ */
+void GamePack::putString(std::string& buffer, const std::string& value,
+                         bool wide)
+{
+  putValue(buffer, value.size(), wide ? 4 : 2);
+  buffer.append(value);
+}
+
+/*
+ * Description: Appends an unsigned value in little endian order.
+ *
+ * Inputs: std::string& buffer - the buffer to append to
+ *         uint64_t value - the value
+ *         uint8_t bytes - the number of bytes to write (1 to 8)
+ * Output: none
+ */
+void GamePack::putValue(std::string& buffer, uint64_t value, uint8_t bytes)
+{
+  for(uint8_t i = 0; i < bytes; i++)
+    buffer.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+/*
+ * Description: Reads a length prefixed string, as written by putString().
+ *
+ * Inputs: const std::string& buffer - the buffer to read from
+ *         uint32_t& pos - the read position. Advanced past the string
+ *         std::string& value - the read string
+ *         bool wide - true for a 32 bit length
+ * Output: bool - true if the string was within the buffer
+ */
+bool GamePack::takeString(const std::string& buffer, uint32_t& pos,
+                          std::string& value, bool wide)
+{
+  uint64_t length = 0;
+
+  if(!takeValue(buffer, pos, length, wide ? 4 : 2) ||
+     pos + length > buffer.size())
+    return false;
+
+  value.assign(buffer, pos, length);
+  pos += length;
+  return true;
+}
+
+/*
+ * Description: Reads an unsigned little endian value, as written by
+ *              putValue().
+ *
+ * Inputs: const std::string& buffer - the buffer to read from
+ *         uint32_t& pos - the read position. Advanced past the value
+ *         uint64_t& value - the read value
+ *         uint8_t bytes - the number of bytes to read (1 to 8)
+ * Output: bool - true if the value was within the buffer
+ */
+bool GamePack::takeValue(const std::string& buffer, uint32_t& pos,
+                         uint64_t& value, uint8_t bytes)
+{
+  if(pos + bytes > buffer.size())
+    return false;
+
+  value = 0;
+  for(uint8_t i = 0; i < bytes; i++)
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(buffer[pos + i]))
+             << (i * 8);
+  pos += bytes;
+  return true;
+}
+
+/*
+ * Description: Stores the source modified time in the header of the open
+ *              pack, in place. Only the time is written.
+ *
+ * Inputs: int64_t source_time - the source modified time
+ * Output: bool - true if the time was written
+ */
+bool GamePack::putSourceTime(int64_t source_time)
+{
+  std::string value;
+  putValue(value, static_cast<uint64_t>(source_time), 8);
+
+  std::fstream out(pack_path.c_str(),
+                   std::ios::in | std::ios::out | std::ios::binary);
+  out.seekp(kMAGIC.size() + 16);
+  out.write(value.data(), value.size());
+  out.close();
+
+  return out.good();
+}
+
+/*
+ * Description: Reads the bytes of a section, decrypted if the pack is. Only
+ *              the bytes of the section are read from the pack.
+ *
+ * Inputs: const PackSection& section - the section
+ *         std::string& buffer - the read bytes
+ * Output: bool - true if the section was read without error
+ */
+bool GamePack::readBuffer(const PackSection& section, std::string& buffer)
+{
+  buffer.assign(section.length, '\0');
+  {
+    LoadScope load_scope(LoadPhase::FILE_READ);
+    pack_stream.seekg(section.offset);
+    pack_stream.read(&buffer[0], section.length);
+  }
+  if(!pack_stream.good() || (pack_encrypted && !cryptSection(buffer, false)))
+  {
+    std::cerr << "[ERROR] Game pack \"" << pack_path
+              << "\" section could not be read" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * Description: Reads all records of a section. Only the bytes of the section
+ *              are read from the pack. A missing section reads no records.
+ *
+ * Inputs: PackSectionType type - the section type
+ *         std::string key - the section key (map level, empty for core)
+ *         std::vector<XmlData>& records - the read records are appended
+ * Output: bool - true if the section was read without error
+ */
+bool GamePack::readSection(PackSectionType type, std::string key,
+                           std::vector<XmlData>& records)
+{
+  if(!isOpen())
+    return false;
+
+  for(auto& section : sections)
+  {
+    if(section.type == type && section.key == key)
+    {
+      std::string buffer;
+      if(!readBuffer(section, buffer))
+        return false;
+
+      uint32_t pos = 0;
+      records.reserve(records.size() + section.count);
+      for(uint32_t i = 0; i < section.count; i++)
+      {
+        XmlData data;
+        if(!decodeRecord(buffer, pos, data))
+        {
+          std::cerr << "[ERROR] Game pack \"" << pack_path
+                    << "\" has a corrupt record" << std::endl;
+          return false;
+        }
+        records.push_back(data);
+      }
+
+      return true;
+    }
+  }
+
+  return true;
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Closes the open pack, if any.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void GamePack::close()
+{
+  if(pack_stream.is_open())
+    pack_stream.close();
+  pack_encrypted = false;
+  pack_path = "";
+  sections.clear();
+}
+
+/*
+ * Description: Returns if a pack is open.
+ *
+ * Inputs: none
+ * Output: bool - true if open
+ */
+bool GamePack::isOpen()
+{
+  return pack_stream.is_open();
+}
+
+/*
+ * Description: Opens the pack of the source file and reads its table of
+ *              contents. Fails quietly if there is no pack, or if it is of
+ *              another version or was compiled from a different source - the
+ *              caller then reads the XML source instead. A source of the
+ *              stored size and modified time is trusted without reading it.
+ *              It is only hashed when the time differs but the size matches.
+ *
+ * Inputs: std::string source - the XML source file path
+ * Output: bool - true if a current pack was opened
+ */
+bool GamePack::open(std::string source)
+{
+  uint64_t source_hash = 0;
+  uint64_t source_size = 0;
+  int64_t source_time = 0;
+
+  close();
+  if(!FileHandler::fileInfo(source, source_size, source_time))
+    return false;
+
+  pack_stream.open(getPackPath(source).c_str(),
+                   std::ios::in | std::ios::binary);
+  if(!pack_stream.is_open())
+    return false;
+  pack_path = getPackPath(source);
+
+  /* Header */
+  std::string header(kHEADER_SIZE, '\0');
+  uint32_t pos = kMAGIC.size();
+  uint64_t version = 0, flags = 0, size = 0, time = 0, hash = 0, count = 0;
+  uint64_t toc_offset = 0;
+  pack_stream.read(&header[0], kHEADER_SIZE);
+  bool success = pack_stream.good() &&
+                 header.compare(0, kMAGIC.size(), kMAGIC) == 0 &&
+                 takeValue(header, pos, version, 4) &&
+                 takeValue(header, pos, flags, 4) &&
+                 takeValue(header, pos, size, 8) &&
+                 takeValue(header, pos, time, 8) &&
+                 takeValue(header, pos, hash, 8) &&
+                 takeValue(header, pos, count, 4) &&
+                 takeValue(header, pos, toc_offset, 8);
+  success &= (version == kVERSION && size == source_size);
+
+  /* Same time, same source. Otherwise the content decides, and the time of
+   * a matching source is kept for the next open */
+  if(success && static_cast<int64_t>(time) != source_time)
+  {
+    success &= FileHandler::fileHash(source, source_hash) &&
+               hash == source_hash;
+    if(success)
+      putSourceTime(source_time);
+  }
+  pack_encrypted = (flags & kFLAG_ENCRYPTED) != 0;
+
+  /* Table of contents - runs to the end of the pack */
+  if(success)
+  {
+    pack_stream.seekg(0, std::ios::end);
+    uint64_t pack_size = pack_stream.tellg();
+    success &= (toc_offset <= pack_size);
+
+    if(success)
+    {
+      std::string toc(pack_size - toc_offset, '\0');
+      pack_stream.seekg(toc_offset);
+      pack_stream.read(&toc[0], toc.size());
+      success &= pack_stream.good();
+
+      pos = 0;
+      for(uint64_t i = 0; success && i < count; i++)
+      {
+        PackSection section;
+        uint64_t type = 0, offset = 0, length = 0, records = 0;
+
+        success &= takeValue(toc, pos, type, 1) &&
+                   takeString(toc, pos, section.key) &&
+                   takeValue(toc, pos, offset, 8) &&
+                   takeValue(toc, pos, length, 4) &&
+                   takeValue(toc, pos, records, 4);
+        success &= (offset + length <= toc_offset);
+
+        section.type = static_cast<PackSectionType>(type);
+        section.offset = offset;
+        section.length = length;
+        section.count = records;
+        sections.push_back(section);
+      }
+    }
+  }
+
+  if(!success)
+    close();
+  return success;
+}
+
+/*
+ * Description: Reads the core data records (game/core and game/currentmap).
+ *
+ * Inputs: std::vector<XmlData>& records - the read records are appended
+ * Output: bool - true if read without error
+ */
+bool GamePack::readCore(std::vector<XmlData>& records)
+{
+  return readSection(PackSectionType::CORE, "", records);
+}
+
+/*
+ * Description: Reads the records of one map level (game/map with the id).
+ *
+ * Inputs: std::string level - the map level id
+ *         std::vector<XmlData>& records - the read records are appended
+ * Output: bool - true if read without error
+ */
+bool GamePack::readMap(std::string level, std::vector<XmlData>& records)
+{
+  return readSection(PackSectionType::MAP, level, records);
+}
+
+/*
+ * Description: Reads the core table snapshot (see GameTables). It may be zero
+ *              padded, if the pack is encrypted.
+ *
+ * Inputs: std::string& tables - the snapshot. Empty if there is none
+ * Output: bool - true if read without error
+ */
+bool GamePack::readTables(std::string& tables)
+{
+  tables.clear();
+  if(!isOpen())
+    return false;
+
+  for(auto& section : sections)
+    if(section.type == PackSectionType::TABLES)
+      return readBuffer(section, tables);
+
+  return true;
+}
+
+/*=============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Compiles the XML source file into its pack. Every data leaf
+ *              within game/core and game/currentmap goes into the core
+ *              section and every leaf within game/map into the section of its
+ *              level, in document order. A given core table snapshot is
+ *              written as the tables section, and the records of the tables
+ *              are then left out of the core section. The sections of an
+ *              encrypted source are encrypted as well. The pack is written to
+ *              a temporary file first, so a reader never opens a partial pack.
+ *
+ * Inputs: std::string source - the XML source file path
+ *         bool encryption - true if the source is encrypted
+ *         const std::string& tables - the core table snapshot. Empty for none
+ * Output: bool - true if the pack was written
+ */
+bool GamePack::compile(std::string source, bool encryption,
+                       const std::string& tables)
+{
+  uint64_t source_hash = 0;
+  uint64_t source_size = 0;
+  int64_t source_time = 0;
+  std::vector<PackSection> sections;
+  std::vector<std::string> buffers;
+
+  if(!FileHandler::fileInfo(source, source_size, source_time) ||
+     !FileHandler::fileHash(source, source_hash))
+  {
+    std::cerr << "[ERROR] Game pack source \"" << source << "\" does not exist"
+              << std::endl;
+    return false;
+  }
+
+  /* Sort all data leafs into their sections */
+  FileHandler fh(source, false, true, encryption);
+  XmlData data;
+  fh.setStreamEnabled(true);
+  bool success = fh.start();
+  success = success && fh.readXmlStream([&](const XmlLeaf& leaf) {
+    if(leaf.getNumElements() < 2 || leaf.getElement(0) != "game")
+      return true;
+
+    PackSection found = {PackSectionType::CORE, "", 0, 0, 0};
+    if(leaf.getElement(1) == "map")
+    {
+      found.type = PackSectionType::MAP;
+      found.key = leaf.getKeyValue(1);
+    }
+    else if(leaf.getElement(1) != "core" && leaf.getElement(1) != "currentmap")
+      return true;
+    else if(!tables.empty() && leaf.getElement(1) == "core" &&
+            leaf.getNumElements() > 2 &&
+            std::find(kTABLE_ELEMENTS.begin(), kTABLE_ELEMENTS.end(),
+                      leaf.getElement(2)) != kTABLE_ELEMENTS.end())
+      return true;
+
+    uint32_t index = 0;
+    while(index < sections.size() && (sections[index].type != found.type ||
+                                      sections[index].key != found.key))
+      index++;
+    if(index == sections.size())
+    {
+      sections.push_back(found);
+      buffers.push_back("");
+    }
+
+    leaf.toXmlData(data);
+    encodeRecord(buffers[index], data);
+    sections[index].count++;
+    return true;
+  });
+  success &= fh.stop();
+
+  if(!success)
+  {
+    std::cerr << "[ERROR] Game pack source \"" << source
+              << "\" could not be read" << std::endl;
+    return false;
+  }
+
+  /* The constructed tables, in place of their records */
+  if(!tables.empty())
+  {
+    sections.push_back({PackSectionType::TABLES, "", 0, 0, 0});
+    buffers.push_back(tables);
+  }
+
+  /* Keep the records of an encrypted source encrypted */
+  if(encryption)
+    for(auto& buffer : buffers)
+      cryptSection(buffer, true);
+
+  /* Header, sections then table of contents */
+  std::string pack = kMAGIC;
+  uint64_t offset = kHEADER_SIZE;
+  std::string toc;
+  for(uint32_t i = 0; i < sections.size(); i++)
+  {
+    putValue(toc, static_cast<uint8_t>(sections[i].type), 1);
+    putString(toc, sections[i].key);
+    putValue(toc, offset, 8);
+    putValue(toc, buffers[i].size(), 4);
+    putValue(toc, sections[i].count, 4);
+    offset += buffers[i].size();
+  }
+  putValue(pack, kVERSION, 4);
+  putValue(pack, encryption ? kFLAG_ENCRYPTED : 0, 4);
+  putValue(pack, source_size, 8);
+  putValue(pack, static_cast<uint64_t>(source_time), 8);
+  putValue(pack, source_hash, 8);
+  putValue(pack, sections.size(), 4);
+  putValue(pack, offset, 8);
+
+  std::string pack_temp = getPackPath(source) + kTEMP_EXTENSION;
+  std::ofstream out(pack_temp.c_str(),
+                    std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!out.good())
+  {
+    std::cerr << "[ERROR] Game pack \"" << pack_temp
+              << "\" could not be opened" << std::endl;
+    return false;
+  }
+  out.write(pack.data(), pack.size());
+  for(auto& buffer : buffers)
+    out.write(buffer.data(), buffer.size());
+  out.write(toc.data(), toc.size());
+  out.close();
+
+  success = out.good() &&
+            FileHandler::fileRename(pack_temp, getPackPath(source), true);
+  if(!success)
+  {
+    std::cerr << "[ERROR] Game pack \"" << getPackPath(source)
+              << "\" could not be written" << std::endl;
+    FileHandler::fileDelete(pack_temp);
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * Description: Returns the pack path of the source file.
+ *
+ * Inputs: std::string source - the XML source file path
+ * Output: std::string - the pack path
+ */
+std::string GamePack::getPackPath(std::string source)
+{
+  return source + kEXTENSION;
+}
@@ -15,6 +15,7 @@
  * See .h file for TODOs
  ******************************************************************************/
 #include "Helpers.h"
+#include "TextureRegistry.h"
 
 /* Constant Implementation - see header file for descriptions */
 const uint8_t Helpers::kMAX_RENDER_DEPTH = 10;
@@ -31,6 +32,7 @@ SDL_Texture* Helpers::mask_white = nullptr;
 const uint32_t Helpers::seed_original =
     std::chrono::high_resolution_clock::now().time_since_epoch().count();
 
+uint32_t Helpers::seed_current = seed_original;
 std::mt19937 Helpers::rand_eng(seed_original);
 std::mt19937_64 Helpers::rand_64_eng(seed_original);
 
@@ -144,6 +146,33 @@ uint64_t Helpers::randU64()
   return rand_64_eng();
 }
 
+/*
+ * Description: Returns the seed that the random number generators were last
+ *              seeded with. This is seed_original unless setSeed() was called.
+ *
+ * Inputs: none
+ * Output: uint32_t - the current seed
+ */
+uint32_t Helpers::getSeed()
+{
+  return seed_current;
+}
+
+/*
+ * Description: Re-seeds both random number generators with the given seed.
+ *              Seeding with a recorded seed (before anything is generated)
+ *              reproduces the same sequence of random numbers.
+ *
+ * Inputs: uint32_t seed - the new seed
+ * Output: none
+ */
+void Helpers::setSeed(uint32_t seed)
+{
+  seed_current = seed;
+  rand_eng.seed(seed);
+  rand_64_eng.seed(seed);
+}
+
 /*
  * Description: Simulates the rolling of an s-sided time x # of times and
  *              returns the result.
@@ -1715,58 +1744,58 @@ std::string Helpers::formatUInt(uint32_t i, std::string d)
  */
 std::vector<std::vector<std::string>> Helpers::frameSeparator(std::string path)
 {
-  /* Split string on '[' */
-  std::vector<std::string> first_split = split(path, '[');
-
-  /* Parse each string and split on the ']' character */
-  std::vector<std::string> split_strings;
+  /* Split string on '[' and parse each piece on the ']' character. The
+   * pieces are views into the path, appended in order to build each frame */
+  std::vector<std::string_view> split_strings;
   std::vector<uint32_t> range_ids;
   int range_count = 0; /* Max of 2 */
-  for(uint32_t i = 0; i < first_split.size(); i++)
+  size_t first_pos = 0;
+  while(first_pos < path.size())
   {
-    std::vector<std::string> second_split = split(first_split[i], ']');
+    std::string_view first_split = nextToken(path, '[', first_pos);
+    size_t second_pos = 0;
 
-    if(second_split.size() == 1 && second_split.front() == first_split[i])
+    if(first_split.empty())
     {
-      split_strings.push_back(second_split.front());
+      continue;
     }
-    else if(second_split.size() >= 1)
+    else if(first_split.find(']') == std::string_view::npos)
+    {
+      split_strings.push_back(first_split);
+    }
+    else
     {
       /* Check if the first string in the set is valid in the 'A-B' category
        */
-      std::vector<std::string> range_split = split(second_split.front(), '-');
-      if(range_count < 2 && range_split.size() == 2 &&
-         range_split.front().size() == 1 && range_split.back().size() == 1 &&
-         range_split.front().front() >= 'A' &&
-         range_split.front().front() <= 'Z' &&
-         range_split.back().front() >= 'A' &&
-         range_split.back().front() <= 'Z') // &&
-      // range_split.front().front() <= range_split.back().front())
+      std::string_view second_front = nextToken(first_split, ']', second_pos);
+      std::string_view range_split[2];
+      if(range_count < 2 && splitView(second_front, '-', range_split, 2) == 2 &&
+         range_split[0].size() == 1 && range_split[1].size() == 1 &&
+         range_split[0].front() >= 'A' && range_split[0].front() <= 'Z' &&
+         range_split[1].front() >= 'A' && range_split[1].front() <= 'Z')
       {
         /* String contains a range that's identical (Eg B-B) */
-        if(range_split.front().front() == range_split.back().front())
+        if(range_split[0].front() == range_split[1].front())
         {
-          split_strings.push_back(range_split.front());
+          split_strings.push_back(range_split[0]);
         }
         /* String contains a correct range (Eg A-B) or (B-A) */
         else
         {
-          split_strings.push_back(second_split.front());
+          split_strings.push_back(second_front);
           range_ids.push_back(split_strings.size() - 1);
           range_count++;
         }
-
-        for(uint32_t j = 1; j < second_split.size(); j++)
-          split_strings.push_back(second_split[j]);
       }
-      /* String either contains an invalid range or no range */
+      /* String either contains an invalid range or no range - the pieces
+       * are appended around the removed ']' */
       else
       {
-        std::string combined_version = "";
-        for(uint32_t j = 0; j < second_split.size(); j++)
-          combined_version += second_split[j];
-        split_strings.push_back(combined_version);
+        split_strings.push_back(second_front);
       }
+
+      while(second_pos < first_split.size())
+        split_strings.push_back(nextToken(first_split, ']', second_pos));
     }
   }
 
@@ -1781,9 +1810,9 @@ std::vector<std::vector<std::string>> Helpers::frameSeparator(std::string path)
     if(j < range_ids.size() && range_ids[j] == i)
     {
       uint32_t base_elements = linear_set.size();
-      std::vector<std::string> range_str = split(split_strings[i], '-');
-      int32_t new_elements =
-          range_str.back().front() - range_str.front().front();
+      std::string_view range_front, range_back;
+      splitEnds(split_strings[i], '-', range_front, range_back);
+      int32_t new_elements = range_back.front() - range_front.front();
       uint32_t abs_elements = new_elements;
       if(new_elements < 0)
         abs_elements = 0 - new_elements;
@@ -1804,9 +1833,9 @@ std::vector<std::vector<std::string>> Helpers::frameSeparator(std::string path)
       {
         char element;
         if(new_elements > 0)
-          element = range_str.front().front() + (k / base_elements);
+          element = range_front.front() + (k / base_elements);
         else
-          element = range_str.front().front() - (k / base_elements);
+          element = range_front.front() - (k / base_elements);
         linear_set[k] += element;
       }
 
@@ -1817,7 +1846,7 @@ std::vector<std::vector<std::string>> Helpers::frameSeparator(std::string path)
     {
       if(linear_set.size() == 0)
       {
-        linear_set.push_back(split_strings[i]);
+        linear_set.emplace_back(split_strings[i]);
       }
       else
       {
@@ -1994,19 +2023,44 @@ std::string Helpers::ltrim(std::string s)
   return s;
 }
 
+/*
+ * Description: Returns the token of the line that starts at the position, up
+ *              to the next delimiter, and moves the position past the
+ *              delimiter. Tokens remain while the position is within the line,
+ *              so looping until then gives the same tokens as split() without
+ *              allocating any.
+ *
+ * Inputs: std::string_view line - the line to tokenize
+ *         char delim - the character delimiter
+ *         size_t& pos - the start of the token. Moved to the next token
+ * Output: std::string_view - the token, as a view into the line
+ */
+std::string_view Helpers::nextToken(std::string_view line, char delim,
+                                    size_t& pos)
+{
+  size_t end = line.find(delim, pos);
+  if(end == std::string_view::npos)
+    end = line.size();
+
+  std::string_view token = line.substr(pos, end - pos);
+  pos = end + 1;
+
+  return token;
+}
+
 /*
  * Description: Takes a string range in the format x1-x2,y1-y2 and parses to
  *              return the parts of it, in unsigned integer form. It can also
  *              handle the case where it's not a range but a single coordinate
  *              i.e. x1,y1-y2 or x1,y1
  *
- * Inputs: std::string sequence - the string sequence to parse
+ * Inputs: std::string_view sequence - the string sequence to parse
  *         uint32_t x_min, x_max, y_min, y_max - the range variables for the
                                  parsed data to return. Passed by reference.
  * Output: bool - status if the data is good and referenced vars are set
  */
-bool Helpers::parseRange(std::string sequence, uint32_t& x_min, uint32_t& x_max,
-                         uint32_t& y_min, uint32_t& y_max)
+bool Helpers::parseRange(std::string_view sequence, uint32_t& x_min,
+                         uint32_t& x_max, uint32_t& y_min, uint32_t& y_max)
 {
   uint32_t x_max_tmp = 0;
   uint32_t x_min_tmp = 0;
@@ -2015,30 +2069,31 @@ bool Helpers::parseRange(std::string sequence, uint32_t& x_min, uint32_t& x_max,
   bool good_data = false;
 
   /* Get the range of elements to process */
-  std::vector<std::string> range_set = split(sequence, ',');
-  if(range_set.size() == 2)
+  std::string_view range_set[2];
+  if(splitView(sequence, ',', range_set, 2) == 2)
   {
     good_data = true;
-    std::vector<std::string> x_set = split(range_set.front(), '-');
-    std::vector<std::string> y_set = split(range_set.back(), '-');
+    std::string_view x_first, x_last, y_first, y_last;
+    splitEnds(range_set[0], '-', x_first, x_last);
+    splitEnds(range_set[1], '-', y_first, y_last);
 
     /* Convert the data over */
-    int new_coord = atoi(x_set.front().c_str());
+    int new_coord = viewToInt(x_first);
     if(new_coord < 0)
       good_data = false;
     x_min_tmp = new_coord;
 
-    new_coord = atoi(x_set.back().c_str());
+    new_coord = viewToInt(x_last);
     if(new_coord < 0)
       good_data = false;
     x_max_tmp = new_coord;
 
-    new_coord = atoi(y_set.front().c_str());
+    new_coord = viewToInt(y_first);
     if(new_coord < 0)
       good_data = false;
     y_min_tmp = new_coord;
 
-    new_coord = atoi(y_set.back().c_str());
+    new_coord = viewToInt(y_last);
     if(new_coord < 0)
       good_data = false;
     y_max_tmp = new_coord;
@@ -2070,43 +2125,60 @@ bool Helpers::parseRange(std::string sequence, uint32_t& x_min, uint32_t& x_max,
  */
 std::vector<std::vector<uint16_t>> Helpers::parseRangeSet(std::string sequence)
 {
-  std::vector<std::vector<uint16_t>> set_elements;
+  std::vector<ValueRange> ranges(parseRangeSet(sequence, nullptr, 0));
+  parseRangeSet(sequence, ranges.data(), ranges.size());
 
-  /* Get the range of elements to process */
-  std::vector<std::string> range_set = split(sequence, ',');
-  for(uint32_t i = 0; i < range_set.size(); i++)
+  /* A single value is a row of one */
+  std::vector<std::vector<uint16_t>> set_elements;
+  set_elements.reserve(ranges.size());
+  for(uint32_t i = 0; i < ranges.size(); i++)
   {
-    std::vector<std::string> range = split(range_set[i], '-');
-    std::vector<uint16_t> row;
+    if(ranges[i].min == ranges[i].max)
+      set_elements.push_back({ranges[i].min});
+    else
+      set_elements.push_back({ranges[i].min, ranges[i].max});
+  }
+
+  return set_elements;
+}
 
-    /* If a range, push both values back */
-    if(range.size() > 1)
+/*
+ * Description: Takes a comma delimited set of ranges and parses them into the
+ *              caller's buffer, sorted min to max. A single value is a range
+ *              of itself. Nothing is allocated - if the buffer is too small,
+ *              the ranges past it are counted but not written so the caller
+ *              can retry with the returned count.
+ * Example: "12-14,10,6-2" would become {12, 14}, {10, 10}, {2, 6}
+ *
+ * Inputs: std::string_view sequence - the comma delimited sequence
+ *         ValueRange* ranges - the buffer for the parsed ranges
+ *         uint32_t max_ranges - the size of the buffer
+ * Output: uint32_t - the number of ranges in the sequence
+ */
+uint32_t Helpers::parseRangeSet(std::string_view sequence, ValueRange* ranges,
+                                uint32_t max_ranges)
+{
+  uint32_t count = 0;
+  size_t pos = 0;
+
+  while(pos < sequence.size())
+  {
+    std::string_view range = nextToken(sequence, ',', pos);
+    if(count < max_ranges)
     {
-      uint16_t first = atoi(range.front().c_str());
-      uint16_t second = atoi(range.back().c_str());
+      std::string_view first, last;
+      splitEnds(range, '-', first, last);
+      uint16_t first_value = viewToInt(first);
+      uint16_t last_value = viewToInt(last);
 
       /* Sort based on range */
-      if(first > second)
-      {
-        row.push_back(second);
-        row.push_back(first);
-      }
-      else
-      {
-        row.push_back(first);
-        row.push_back(second);
-      }
-    }
-    /* If only a single value, only add it */
-    else if(range.size() == 1)
-    {
-      row.push_back(atoi(range.front().c_str()));
+      ranges[count] = ValueRange(std::min(first_value, last_value),
+                                 std::max(first_value, last_value));
     }
-
-    set_elements.push_back(row);
+    count++;
   }
 
-  return set_elements;
+  return count;
 }
 
 /*
@@ -2141,16 +2213,78 @@ std::string Helpers::rtrim(std::string s)
 std::vector<std::string> Helpers::split(const std::string& line, char delim)
 {
   std::vector<std::string> elements;
-  std::string item;
-  std::stringstream ss(line);
+  size_t pos = 0;
 
   /* Parse the string and separate as per each delimiter */
-  while(std::getline(ss, item, delim))
-    elements.push_back(item);
+  while(pos < line.size())
+    elements.emplace_back(nextToken(line, delim, pos));
 
   return elements;
 }
 
+/*
+ * Description: Finds the first and last tokens that split() would return for
+ *              the line, without producing the tokens between. Used for the
+ *              "min-max" ranges where only the ends are of interest.
+ *
+ * Inputs: std::string_view line - the line to split
+ *         char delim - the character delimiter
+ *         std::string_view& first - the first token. Empty if none
+ *         std::string_view& last - the last token. Empty if none
+ * Output: bool - true if the line has a token
+ */
+bool Helpers::splitEnds(std::string_view line, char delim,
+                        std::string_view& first, std::string_view& last)
+{
+  first = std::string_view();
+  last = std::string_view();
+  if(line.empty())
+    return false;
+
+  /* A final delimiter does not give an empty final token */
+  size_t end = line.size();
+  if(line.back() == delim)
+    end--;
+
+  size_t start = (end == 0) ? std::string_view::npos :
+                              line.rfind(delim, end - 1);
+  start = (start == std::string_view::npos) ? 0 : start + 1;
+
+  first = line.substr(0, line.find(delim));
+  last = line.substr(start, end - start);
+
+  return true;
+}
+
+/*
+ * Description: Splits the line on the delimiter into views of the line, in
+ *              the caller's buffer. The tokens are those of split(), with no
+ *              strings allocated. If the buffer is too small, the tokens past
+ *              it are counted but not written.
+ *
+ * Inputs: std::string_view line - the line to split
+ *         char delim - the character delimiter
+ *         std::string_view* tokens - the buffer for the tokens
+ *         uint32_t max_tokens - the size of the buffer
+ * Output: uint32_t - the number of tokens in the line
+ */
+uint32_t Helpers::splitView(std::string_view line, char delim,
+                            std::string_view* tokens, uint32_t max_tokens)
+{
+  uint32_t count = 0;
+  size_t pos = 0;
+
+  while(pos < line.size())
+  {
+    std::string_view token = nextToken(line, delim, pos);
+    if(count < max_tokens)
+      tokens[count] = token;
+    count++;
+  }
+
+  return count;
+}
+
 /*
  * Description Trims white space from both sides of a std::string
  *
@@ -2162,6 +2296,41 @@ std::string Helpers::trim(std::string s)
   return ltrim(rtrim(s));
 }
 
+/*
+ * Description: Converts the leading integer of the view, as atoi() does for a
+ *              string: leading whitespace and a sign are accepted and the
+ *              conversion stops at the first non-digit. Out of range values
+ *              are clamped.
+ *
+ * Inputs: std::string_view view - the view to convert
+ * Output: int32_t - the integer. 0 if the view does not start with one
+ */
+int32_t Helpers::viewToInt(std::string_view view)
+{
+  size_t pos = 0;
+  while(pos < view.size() && std::isspace(static_cast<uint8_t>(view[pos])))
+    pos++;
+
+  bool negative = false;
+  if(pos < view.size() && (view[pos] == '-' || view[pos] == '+'))
+  {
+    negative = (view[pos] == '-');
+    pos++;
+  }
+
+  const int64_t limit = static_cast<int64_t>(INT32_MAX) + 1;
+  int64_t value = 0;
+  while(pos < view.size() && view[pos] >= '0' && view[pos] <= '9')
+  {
+    value = std::min(value * 10 + (view[pos] - '0'), limit);
+    pos++;
+  }
+
+  if(negative)
+    return -value;
+  return std::min(value, limit - 1);
+}
+
 /*
  * Description: Updates the lay over structure passed in with the load data
  *              as defined by XmlData with the associated index
@@ -2174,8 +2343,8 @@ std::string Helpers::trim(std::string s)
  *the
  *                   load failed.
  */
-LayOver Helpers::updateLayOver(LayOver lay_over, XmlData data, int file_index,
-                               std::string base_directory)
+LayOver Helpers::updateLayOver(LayOver lay_over, const XmlData& data,
+                               int file_index, std::string base_directory)
 {
   bool success = true;
   LayOver new_layover = lay_over;
@@ -2212,7 +2381,7 @@ LayOver Helpers::updateLayOver(LayOver lay_over, XmlData data, int file_index,
  * Output: BattleScene - the updated scene with the load data. No changes if
  *                       the load failed.
  */
-BattleScene Helpers::updateScene(BattleScene scene, XmlData data,
+BattleScene Helpers::updateScene(BattleScene scene, const XmlData& data,
                                  int file_index, std::string base_directory)
 {
   bool success = true;
@@ -2530,9 +2699,9 @@ void Helpers::createMaskBlack(SDL_Renderer* renderer)
 {
   if(mask_black == nullptr)
   {
-    mask_black =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, kTILE_SIZE, kTILE_SIZE);
+    mask_black = TextureRegistry::create(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        kTILE_SIZE, kTILE_SIZE);
     SDL_SetRenderTarget(renderer, mask_black);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
@@ -2556,9 +2725,9 @@ void Helpers::createMaskWhite(SDL_Renderer* renderer)
 {
   if(mask_white == nullptr)
   {
-    mask_white =
-        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET, kTILE_SIZE, kTILE_SIZE);
+    mask_white = TextureRegistry::create(
+        renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        kTILE_SIZE, kTILE_SIZE);
     SDL_SetRenderTarget(renderer, mask_white);
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     SDL_RenderClear(renderer);
@@ -2581,11 +2750,11 @@ void Helpers::createMaskWhite(SDL_Renderer* renderer)
 void Helpers::deleteMasks()
 {
   if(mask_black != nullptr)
-    SDL_DestroyTexture(mask_black);
+    TextureRegistry::destroy(mask_black);
   mask_black = nullptr;
 
   if(mask_white != nullptr)
-    SDL_DestroyTexture(mask_white);
+    TextureRegistry::destroy(mask_white);
   mask_white = NULL;
 }
 
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Class Name: LoadReport
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Per phase breakdown of the game load time. Each load phase
+ *              (file read, XML parse, core data, map sprites/tiles/things,
+ *              load finish and the lazy sprite texture builds of the first
+ *              frame) is timed by a LoadScope into an atomic total. Once the
+ *              first frame after the load is rendered, the breakdown is
+ *              appended as a row to a CSV report so load times can be tracked
+ *              across game builds.
+ ******************************************************************************/
+#include "LoadReport.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "FileHandler.h"
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t LoadReport::kPHASE_COUNT =
+    static_cast<uint32_t>(LoadPhase::COUNT);
+
+/* Static Implementation - see header file for descriptions */
+std::atomic<bool> LoadReport::active{false};
+std::string LoadReport::game_file = "";
+int LoadReport::game_level = 0;
+Timer LoadReport::load_timer;
+uint64_t LoadReport::load_time = 0;
+std::string LoadReport::output_path = "";
+std::vector<std::atomic<uint32_t>> LoadReport::phase_counts(kPHASE_COUNT);
+std::vector<std::atomic<uint64_t>> LoadReport::phase_times(kPHASE_COUNT);
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Completes the report once the first frame after the load has
+ *              been rendered. The row (date, game file, level, load and total
+ *              time, then the time and count of each phase) is appended to the
+ *              CSV report, with a header if the report is new.
+ *
+ * Inputs: none
+ * Output: bool - true if the report row was written
+ */
+bool LoadReport::finish()
+{
+  if(!isActive())
+    return false;
+  active.store(false, std::memory_order_release);
+
+  uint64_t total_time = load_timer.elapsedMicro();
+  bool new_report = !FileHandler::fileExists(output_path);
+
+  std::ofstream out(output_path.c_str(), std::ios::out | std::ios::app);
+  if(!out.good())
+  {
+    std::cerr << "[ERROR] Load report \"" << output_path
+              << "\" could not be opened" << std::endl;
+    return false;
+  }
+
+  /* Header */
+  if(new_report)
+  {
+    out << "date,game,level,load_ms,total_ms";
+    for(uint32_t i = 0; i < kPHASE_COUNT; i++)
+      out << "," << getPhaseName(static_cast<LoadPhase>(i)) << "_ms";
+    for(uint32_t i = 0; i < kPHASE_COUNT; i++)
+      out << "," << getPhaseName(static_cast<LoadPhase>(i)) << "_count";
+    out << std::endl;
+  }
+
+  /* Load row */
+  out << std::fixed << std::setprecision(3) << FileHandler::getCurrentDate()
+      << "," << game_file << "," << game_level << "," << load_time / 1000.0
+      << "," << total_time / 1000.0;
+  for(uint32_t i = 0; i < kPHASE_COUNT; i++)
+    out << "," << phase_times[i].load(std::memory_order_relaxed) / 1000.0;
+  for(uint32_t i = 0; i < kPHASE_COUNT; i++)
+    out << "," << phase_counts[i].load(std::memory_order_relaxed);
+  out << std::endl;
+  out.close();
+
+  return true;
+}
+
+/*
+ * Description: Returns the column name of the load phase.
+ *
+ * Inputs: LoadPhase phase - the phase
+ * Output: std::string - the column name
+ */
+std::string LoadReport::getPhaseName(LoadPhase phase)
+{
+  if(phase == LoadPhase::FILE_READ)
+    return "file_read";
+  else if(phase == LoadPhase::XML_PARSE)
+    return "xml_parse";
+  else if(phase == LoadPhase::CORE_DATA)
+    return "core_data";
+  else if(phase == LoadPhase::MAP_SPRITES)
+    return "map_sprites";
+  else if(phase == LoadPhase::MAP_TILES)
+    return "map_tiles";
+  else if(phase == LoadPhase::MAP_THINGS)
+    return "map_things";
+  else if(phase == LoadPhase::MAP_FINISH)
+    return "map_finish";
+  else if(phase == LoadPhase::SPRITE_BUILD)
+    return "sprite_build";
+  return "";
+}
+
+/*
+ * Description: Returns if a load is currently being reported.
+ *
+ * Inputs: none
+ * Output: bool - true if reporting
+ */
+bool LoadReport::isActive()
+{
+  return active.load(std::memory_order_acquire);
+}
+
+/*
+ * Description: Marks the end of the load call itself. Phases are still
+ *              recorded until finish(), to capture the first frame.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void LoadReport::loadEnd()
+{
+  if(isActive())
+    load_time = load_timer.elapsedMicro();
+}
+
+/*
+ * Description: Records the time spent in a load phase. Does not lock - the
+ *              time is added to the atomic total.
+ *
+ * Inputs: LoadPhase phase - the phase
+ *         uint32_t microseconds - the time spent in the phase
+ * Output: none
+ */
+void LoadReport::record(LoadPhase phase, uint32_t microseconds)
+{
+  if(phase != LoadPhase::COUNT && isActive())
+  {
+    phase_times[static_cast<uint32_t>(phase)].fetch_add(
+        microseconds, std::memory_order_relaxed);
+    phase_counts[static_cast<uint32_t>(phase)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+}
+
+/*
+ * Description: Sets the output path of the CSV report. An empty path disables
+ *              the report.
+ *
+ * Inputs: std::string path - the CSV report path
+ * Output: none
+ */
+void LoadReport::setOutput(std::string path)
+{
+  output_path = path;
+  if(path.empty())
+    active.store(false, std::memory_order_release);
+}
+
+/*
+ * Description: Starts reporting a load. All phase totals are cleared. Does
+ *              nothing if the report is disabled.
+ *
+ * Inputs: std::string file - the game file being loaded
+ *         int level - the map level being loaded
+ * Output: none
+ */
+void LoadReport::start(std::string file, int level)
+{
+  if(output_path.empty())
+    return;
+
+  game_file = file;
+  game_level = level;
+  load_time = 0;
+  for(uint32_t i = 0; i < kPHASE_COUNT; i++)
+  {
+    phase_counts[i].store(0, std::memory_order_relaxed);
+    phase_times[i].store(0, std::memory_order_relaxed);
+  }
+
+  load_timer.reset();
+  active.store(true, std::memory_order_release);
+}
@@ -6,7 +6,10 @@
  *              necessary subsystems and starts up the application.
  ******************************************************************************/
 #include "Application.h"
+#include "AssetPack.h"
+#include "GamePack.h"
 #include "Helpers.h"
+#include "LoadReport.h"
 
 #include <unistd.h>
 
@@ -55,15 +58,81 @@ bool initSDL()
 
 int main(int argc, char** argv)
 {
+  /* Pull out the file options: --record, --replay, --load-report,
+   * --compile-pack <file> (--encrypted for encrypted game and save files) or
+   * --pack-assets <directory> */
+  std::vector<std::string> pack_assets;
+  bool pack_encryption = false;
+  std::vector<std::string> pack_sources;
+  std::string record_path = "";
+  std::string replay_path = "";
+  std::vector<std::string> args;
+  for(int i = 0; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    if(arg == "--compile-pack" && i + 1 < argc)
+      pack_sources.push_back(argv[++i]);
+    else if(arg == "--encrypted")
+      pack_encryption = true;
+    else if(arg == "--pack-assets" && i + 1 < argc)
+      pack_assets.push_back(argv[++i]);
+    else if(arg == "--load-report" && i + 1 < argc)
+      LoadReport::setOutput(argv[++i]);
+    else if(arg == "--record" && i + 1 < argc)
+      record_path = argv[++i];
+    else if(arg == "--replay" && i + 1 < argc)
+      replay_path = argv[++i];
+    else
+      args.push_back(arg);
+  }
+  argc = args.size();
+
+  /* Compile the game and save files into packs, without starting the game */
+  if(!pack_sources.empty() || !pack_assets.empty())
+  {
+    bool compiled = true;
+    for(auto& source : pack_sources)
+      compiled &= GamePack::compile(source, pack_encryption);
+    for(auto& directory : pack_assets)
+    {
+      if(!directory.empty() && directory.back() != '/' &&
+         directory.back() != '\\')
+        directory += '/';
+      compiled &= AssetPack::build(directory);
+    }
+    return compiled ? 0 : 1;
+  }
+
+#ifdef BENCH
+  /* Benchmark runs are headless: <game file> <level> [frames] [output csv] */
+  if(argc < 3)
+  {
+    std::cerr << "Usage: " << args[0] << " <game file> <level> [frames] "
+              << "[output csv] [--replay <input file>]" << std::endl;
+    return 1;
+  }
+  uint32_t bench_frames = Benchmark::kDEFAULT_FRAMES;
+  std::string bench_output = Benchmark::kDEFAULT_OUTPUT;
+  if(argc > 3)
+    bench_frames = std::stoi(args[3]);
+  if(argc > 4)
+    bench_output = args[4];
+
+  /* Dummy video and audio drivers, unless overridden by the environment */
+  SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+  SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+  SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+#endif
+
   /* See if there is a map to skip all proceedings for */
   std::string init_app = "";
   if(argc > 1)
-    init_app += argv[1];
+    init_app += args[1];
   int map_lvl = 0;
   bool map_requested = false;
   if(argc > 2)
   {
-    map_lvl = std::stoi(argv[2]);
+    map_lvl = std::stoi(args[2]);
     map_requested = true;
   }
 
@@ -73,6 +142,22 @@ int main(int argc, char** argv)
   std::string dir_string(directory);
   SDL_free(directory);
 
+  /* Images and audio are read from the asset pack, if one was built */
+  AssetPack::open(dir_string);
+
+  /* Start the input recording or replay - this seeds the generators, so it
+   * must come before anything is loaded */
+  KeyRecorder key_recorder;
+  if(!replay_path.empty())
+  {
+    if(!key_recorder.startReplay(replay_path))
+      return 1;
+  }
+  else if(!record_path.empty())
+  {
+    key_recorder.startRecording(record_path);
+  }
+
   /* Initialize SDL libraries */
   bool success = initSDL();
 
@@ -80,8 +165,15 @@ int main(int argc, char** argv)
   {
     /* Create the application and start the run loop */
     Application* game_app = new Application(dir_string, init_app, map_lvl);
+#ifdef BENCH
+    Benchmark benchmark(bench_frames, bench_output);
+    game_app->setBenchmark(&benchmark);
+#endif
+    if(key_recorder.getMode() != RecordMode::DISABLED)
+      game_app->setKeyRecorder(&key_recorder);
     if(game_app->initialize())
       game_app->run(map_requested);
+    key_recorder.stop();
 
     /* Clean up the application, after the run loop is finished */
     //game_app->uninitialize();
@@ -95,6 +187,7 @@ int main(int argc, char** argv)
   TTF_Quit();
   IMG_Quit();
   SDL_Quit();
+  AssetPack::close();
 
   return 0;
 }
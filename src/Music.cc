@@ -12,6 +12,7 @@
  *    plays at.
  ******************************************************************************/
 #include "Music.h"
+#include "AssetPack.h"
 
 /* Constant Implementation - see header file for descriptions */
 const short Music::kFADE_TIME = 5000;
@@ -107,7 +108,7 @@ bool Music::setMusicFile(std::string path)
   if(!path.empty())
   {
     unsetMusicFile();
-    raw_data = Mix_LoadMUS(path.c_str());
+    raw_data = AssetPack::loadMusic(path);
 
     /* Determine if the setting of the sound was valid */
     if(raw_data == NULL)
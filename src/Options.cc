@@ -46,6 +46,12 @@ const std::uint32_t Options::kDEF_MUSIC_LEVEL{30};
 const std::uint32_t Options::kDEF_SCALING_TEXT{50};
 const std::uint32_t Options::kDEF_SCALING_UI{0};
 
+/* Default simulation tick rate and render frame limit, and tick rate range */
+const std::uint32_t Options::kDEF_FRAME_LIMIT{120};
+const std::uint32_t Options::kDEF_TICK_RATE{60};
+const std::uint32_t Options::kMAX_TICK_RATE{240};
+const std::uint32_t Options::kMIN_TICK_RATE{20};
+
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -92,6 +98,8 @@ void Options::copySelf(const Options& source)
   resolution_y = source.resolution_y;
   flags = source.flags;
   flags_default = source.flags_default;
+  frame_limit = source.frame_limit;
+  tick_rate = source.tick_rate;
 }
 
 void Options::setAllToDefault()
@@ -104,6 +112,10 @@ void Options::setAllToDefault()
   setScalingText(kDEF_SCALING_TEXT);
   setScalingUI(kDEF_SCALING_UI);
 
+  /* Timing options */
+  setFrameLimit(kDEF_FRAME_LIMIT);
+  setTickRate(kDEF_TICK_RATE);
+
   /* Flags */
   setLinearFiltering(false);
 
@@ -235,6 +247,12 @@ TTF_Font* Options::getFontTTF(FontName font)
   return nullptr;
 }
 
+/* Render frame limit getter, in frames per second (0 is unlimited) */
+uint32_t Options::getFrameLimit()
+{
+  return frame_limit;
+}
+
 int32_t Options::getMusicLevel()
 {
   return music_level;
@@ -280,6 +298,12 @@ uint16_t Options::getScreenWidth()
   return kRESOLUTIONS_X[resolution_x];
 }
 
+/* Simulation tick rate getter, in updates per second */
+uint32_t Options::getTickRate()
+{
+  return tick_rate;
+}
+
 bool Options::isAudioEnabled()
 {
   return !getFlag(OptionState::MUTE);
@@ -302,53 +326,53 @@ bool Options::isVsyncEnabled()
   return getFlag(OptionState::VSYNC);
 }
 
-bool Options::loadData(XmlData data, int index)
+bool Options::loadData(const XmlData& data, int index)
 {
   bool success{true};
 
-  if(data.getElement(index) == "linear_filtering")
+  switch(data.getElementToken(index))
   {
+  case(XmlToken::LINEAR_FILTERING):
     setFlag(OptionState::LINEAR_FILTERING, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "vsync")
-  {
+    break;
+  case(XmlToken::VSYNC):
     setFlag(OptionState::VSYNC, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "fullscreen")
-  {
+    break;
+  case(XmlToken::FULLSCREEN):
     setFlag(OptionState::FULLSCREEN, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "autorun")
-  {
+    break;
+  case(XmlToken::AUTORUN):
     setFlag(OptionState::AUTO_RUN, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "battle_animations")
-  {
+    break;
+  case(XmlToken::BATTLE_ANIMATIONS):
     setFlag(OptionState::BATTLE_ANIMATIONS, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "gui_enabled")
-  {
+    break;
+  case(XmlToken::GUI_ENABLED):
     setFlag(OptionState::GUI_ENABLED, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "FAST_BATTLE")
-  {
+    break;
+  case(XmlToken::FAST_BATTLE):
     setFlag(OptionState::FAST_BATTLE, data.getDataBool(&success));
-  }
-  else if(data.getElement(index) == "audio_level")
-  {
+    break;
+  case(XmlToken::AUDIO_LEVEL):
     audio_level = data.getDataInteger(&success);
-  }
-  else if(data.getElement(index) == "music_level")
-  {
+    break;
+  case(XmlToken::MUSIC_LEVEL):
     music_level = data.getDataInteger(&success);
-  }
-  else if(data.getElement(index) == "scaling_text")
-  {
+    break;
+  case(XmlToken::SCALING_TEXT):
     scaling_text = data.getDataInteger(&success);
-  }
-  else if(data.getElement(index) == "scaling_ui")
-  {
+    break;
+  case(XmlToken::SCALING_UI):
     scaling_ui = data.getDataInteger(&success);
+    break;
+  case(XmlToken::FRAME_LIMIT):
+    setFrameLimit(data.getDataInteger(&success));
+    break;
+  case(XmlToken::TICK_RATE):
+    setTickRate(data.getDataInteger(&success));
+    break;
+  default:
+    break;
   }
 
   return success;
@@ -378,6 +402,8 @@ bool Options::saveData(FileHandler* fh)
     fh->writeXmlData("music_level", music_level);
     fh->writeXmlData("scaling_text", scaling_text);
     fh->writeXmlData("scaling_ui", scaling_ui);
+    fh->writeXmlData("frame_limit", frame_limit);
+    fh->writeXmlData("tick_rate", tick_rate);
 
     fh->writeXmlElementEnd();
 
@@ -408,6 +434,12 @@ void Options::setFlag(OptionState flag, bool set_value)
   // TODO: repair. Especially regarding VSync, Full Screen, etc SDL
 }
 
+/* Render frame limit setter, in frames per second (0 is unlimited) */
+void Options::setFrameLimit(int32_t new_limit)
+{
+  frame_limit = (new_limit > 0) ? new_limit : 0;
+}
+
 void Options::setMusicLevel(int32_t new_level)
 {
   music_level = Sound::setMusicVolumes(new_level);
@@ -434,6 +466,13 @@ void Options::setSoundHandler(SoundHandler* new_handler)
   sound_handler = new_handler;
 }
 
+/* Simulation tick rate setter, in updates per second. Clamped to range */
+void Options::setTickRate(int32_t new_rate)
+{
+  tick_rate = std::max(std::min(new_rate, (int32_t)kMAX_TICK_RATE),
+                       (int32_t)kMIN_TICK_RATE);
+}
+
 void Options::update()
 {
   if(sound_handler)
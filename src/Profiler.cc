@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * Class Name: Profiler
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Scoped zone profiler for the hot paths of the run loop. Each
+ *              zone is timed by a ProfileScope (a Timer which records on
+ *              destruction) into a per frame ring buffer of atomic counters, so
+ *              recording never locks. The ring buffer is summarized into
+ *              rolling averages and a frame time graph by an overlay that is
+ *              drawn on top of the frame.
+ ******************************************************************************/
+#include "Profiler.h"
+#include "TextureRegistry.h"
+
+#include <iomanip>
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t Profiler::kFRAME_BUDGET = 16667;
+const uint32_t Profiler::kFRAME_COUNT = 128;
+const uint16_t Profiler::kGRAPH_HEIGHT = 60;
+const uint16_t Profiler::kOVERLAY_GAP = 6;
+const uint32_t Profiler::kOVERLAY_REFRESH = 30;
+const uint32_t Profiler::kZONE_COUNT =
+    static_cast<uint32_t>(ProfileZone::COUNT);
+
+/* Static Implementation - see header file for descriptions */
+std::atomic<uint32_t> Profiler::frame_index{0};
+Timer Profiler::frame_timer;
+std::vector<std::atomic<uint32_t>> Profiler::frame_times(kFRAME_COUNT);
+std::vector<Text*> Profiler::overlay_lines;
+uint32_t Profiler::overlay_refresh = 0;
+std::atomic<bool> Profiler::overlay_enabled{false};
+std::vector<std::atomic<uint32_t>> Profiler::zone_times(kFRAME_COUNT *
+                                                        kZONE_COUNT);
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Builds the overlay text lines (frame and per zone average and
+ *              max, in ms) from the current state of the ring buffer.
+ *
+ * Inputs: SDL_Renderer* renderer - the rendering engine
+ *         TTF_Font* font - the font to build the lines with
+ * Output: none
+ */
+void Profiler::buildOverlay(SDL_Renderer* renderer, TTF_Font* font)
+{
+  SDL_Color color = {255, 255, 255, 255};
+  std::vector<std::string> lines;
+
+  unloadOverlay();
+
+  /* Frame line */
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(2) << "Frame: "
+     << getAverageFrame() / 1000.0 << " ms (max " << getMaxFrame() / 1000.0
+     << ")";
+  lines.push_back(ss.str());
+
+  /* Zone lines */
+  for(uint32_t i = 0; i < kZONE_COUNT; i++)
+  {
+    ProfileZone zone = static_cast<ProfileZone>(i);
+
+    ss.str("");
+    ss << getZoneName(zone) << ": " << getAverage(zone) / 1000.0
+       << " ms (max " << getMax(zone) / 1000.0 << ")";
+    lines.push_back(ss.str());
+  }
+
+  /* Texture lines, in MiB */
+  ss.str("");
+  ss << "Textures: " << TextureRegistry::getCount() << " ("
+     << TextureRegistry::getBytes() / 1048576.0 << " MiB)";
+  lines.push_back(ss.str());
+  ss.str("");
+  ss << "Grey: "
+     << TextureRegistry::getBytes(TextureSource::FRAME_GREY) / 1048576.0
+     << " MiB, Targets: "
+     << TextureRegistry::getBytes(TextureSource::SPRITE_TARGET) / 1048576.0
+     << " MiB";
+  lines.push_back(ss.str());
+
+  for(auto& line : lines)
+  {
+    Text* text = new Text(font);
+    text->setText(renderer, line, color);
+    overlay_lines.push_back(text);
+  }
+}
+
+/*
+ * Description: Returns the number of completed frames in the ring buffer. The
+ *              slot of the frame currently being recorded is excluded.
+ *
+ * Inputs: none
+ * Output: uint32_t - the completed frame count
+ */
+uint32_t Profiler::getFrameSpan()
+{
+  return std::min(frame_index.load(std::memory_order_relaxed),
+                  kFRAME_COUNT - 1);
+}
+
+/*
+ * Description: Returns the ring buffer slot of the frame which is the given
+ *              number of frames back from the frame currently recorded.
+ *
+ * Inputs: uint32_t frames_back - frames back from current (0 is current)
+ * Output: uint32_t - the ring buffer slot
+ */
+uint32_t Profiler::getSlot(uint32_t frames_back)
+{
+  return (frame_index.load(std::memory_order_relaxed) - frames_back) %
+         kFRAME_COUNT;
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Completes the current frame by storing its total time, then
+ *              clears the next slot and starts recording into it.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Profiler::frameEnd()
+{
+  uint32_t index = frame_index.load(std::memory_order_relaxed);
+  uint32_t next = (index + 1) % kFRAME_COUNT;
+
+  frame_times[index % kFRAME_COUNT].store(frame_timer.elapsedMicro(),
+                                          std::memory_order_relaxed);
+  frame_timer.reset();
+
+  frame_times[next].store(0, std::memory_order_relaxed);
+  for(uint32_t i = 0; i < kZONE_COUNT; i++)
+    zone_times[next * kZONE_COUNT + i].store(0, std::memory_order_relaxed);
+
+  frame_index.store(index + 1, std::memory_order_release);
+}
+
+/*
+ * Description: Returns the average time spent in the zone per frame, over the
+ *              completed frames in the ring buffer.
+ *
+ * Inputs: ProfileZone zone - the zone to average
+ * Output: uint32_t - the average, in microseconds
+ */
+uint32_t Profiler::getAverage(ProfileZone zone)
+{
+  uint32_t span = getFrameSpan();
+  uint64_t total = 0;
+
+  for(uint32_t i = 1; i <= span; i++)
+    total += zone_times[getSlot(i) * kZONE_COUNT +
+                        static_cast<uint32_t>(zone)].load(
+        std::memory_order_relaxed);
+
+  return (span > 0) ? (total / span) : 0;
+}
+
+/*
+ * Description: Returns the average total frame time, over the completed frames
+ *              in the ring buffer.
+ *
+ * Inputs: none
+ * Output: uint32_t - the average, in microseconds
+ */
+uint32_t Profiler::getAverageFrame()
+{
+  uint32_t span = getFrameSpan();
+  uint64_t total = 0;
+
+  for(uint32_t i = 1; i <= span; i++)
+    total += frame_times[getSlot(i)].load(std::memory_order_relaxed);
+
+  return (span > 0) ? (total / span) : 0;
+}
+
+/*
+ * Description: Returns the maximum time spent in the zone in a single frame,
+ *              over the completed frames in the ring buffer.
+ *
+ * Inputs: ProfileZone zone - the zone to check
+ * Output: uint32_t - the maximum, in microseconds
+ */
+uint32_t Profiler::getMax(ProfileZone zone)
+{
+  uint32_t max = 0;
+
+  for(uint32_t i = 1; i <= getFrameSpan(); i++)
+    max = std::max(max, zone_times[getSlot(i) * kZONE_COUNT +
+                                   static_cast<uint32_t>(zone)].load(
+                            std::memory_order_relaxed));
+
+  return max;
+}
+
+/*
+ * Description: Returns the maximum total frame time, over the completed frames
+ *              in the ring buffer.
+ *
+ * Inputs: none
+ * Output: uint32_t - the maximum, in microseconds
+ */
+uint32_t Profiler::getMaxFrame()
+{
+  uint32_t max = 0;
+
+  for(uint32_t i = 1; i <= getFrameSpan(); i++)
+    max = std::max(max,
+                   frame_times[getSlot(i)].load(std::memory_order_relaxed));
+
+  return max;
+}
+
+/*
+ * Description: Returns the display name of the zone.
+ *
+ * Inputs: ProfileZone zone - the zone
+ * Output: std::string - the display name
+ */
+std::string Profiler::getZoneName(ProfileZone zone)
+{
+  if(zone == ProfileZone::APP_UPDATE)
+    return "App Update";
+  else if(zone == ProfileZone::APP_RENDER)
+    return "App Render";
+  else if(zone == ProfileZone::MAP_UPDATE)
+    return "Map Update";
+  else if(zone == ProfileZone::MAP_RENDER)
+    return "Map Render";
+  else if(zone == ProfileZone::BATTLE_UPDATE)
+    return "Battle Update";
+  else if(zone == ProfileZone::BATTLE_RENDER)
+    return "Battle Render";
+  else if(zone == ProfileZone::MENU_RENDER)
+    return "Menu Render";
+  else if(zone == ProfileZone::SOUND_PROCESS)
+    return "Sound Process";
+  return "";
+}
+
+/*
+ * Description: Returns if the overlay is displayed on top of the frame.
+ *
+ * Inputs: none
+ * Output: bool - true if displayed
+ */
+bool Profiler::isOverlayEnabled()
+{
+  return overlay_enabled.load(std::memory_order_relaxed);
+}
+
+/*
+ * Description: Records the time spent in a zone for the current frame. Does
+ *              not lock - the time is added to the atomic slot.
+ *
+ * Inputs: ProfileZone zone - the zone
+ *         uint32_t microseconds - the time spent in the zone
+ * Output: none
+ */
+void Profiler::record(ProfileZone zone, uint32_t microseconds)
+{
+  if(zone != ProfileZone::COUNT)
+  {
+    uint32_t slot = frame_index.load(std::memory_order_acquire) % kFRAME_COUNT;
+    zone_times[slot * kZONE_COUNT + static_cast<uint32_t>(zone)].fetch_add(
+        microseconds, std::memory_order_relaxed);
+  }
+}
+
+/*
+ * Description: Renders the overlay in the top left corner, if enabled. This
+ *              includes the average text (rebuilt every kOVERLAY_REFRESH
+ *              frames) and the frame time graph of the ring buffer, with the
+ *              frame budget marked.
+ *
+ * Inputs: SDL_Renderer* renderer - the rendering engine
+ *         TTF_Font* font - the font for the overlay text
+ * Output: bool - true if the overlay was rendered
+ */
+bool Profiler::renderOverlay(SDL_Renderer* renderer, TTF_Font* font)
+{
+  if(!isOverlayEnabled() || renderer == nullptr || font == nullptr)
+    return false;
+
+  /* Rebuild the text on the refresh interval */
+  if(overlay_lines.empty() || overlay_refresh == 0)
+  {
+    buildOverlay(renderer, font);
+    overlay_refresh = kOVERLAY_REFRESH;
+  }
+  overlay_refresh--;
+
+  /* Determine the overlay size */
+  int width = kFRAME_COUNT;
+  int height = kGRAPH_HEIGHT + kOVERLAY_GAP;
+  for(auto& line : overlay_lines)
+  {
+    width = std::max(width, line->getWidth());
+    height += line->getHeight();
+  }
+
+  /* Backdrop */
+  SDL_Rect backdrop = {0, 0, width + kOVERLAY_GAP * 2,
+                       height + kOVERLAY_GAP * 2};
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+  SDL_RenderFillRect(renderer, &backdrop);
+
+  /* Text lines */
+  int y = kOVERLAY_GAP;
+  for(auto& line : overlay_lines)
+  {
+    line->render(renderer, kOVERLAY_GAP, y);
+    y += line->getHeight();
+  }
+  y += kOVERLAY_GAP + kGRAPH_HEIGHT;
+
+  /* Frame time graph, oldest to newest. Full height is twice the budget */
+  uint32_t span = getFrameSpan();
+  for(uint32_t i = span; i > 0; i--)
+  {
+    uint32_t time = frame_times[getSlot(i)].load(std::memory_order_relaxed);
+    int bar = std::min(static_cast<int>(kGRAPH_HEIGHT),
+                       static_cast<int>(time * kGRAPH_HEIGHT /
+                                        (kFRAME_BUDGET * 2)));
+    int x = kOVERLAY_GAP + (span - i);
+
+    if(time > kFRAME_BUDGET)
+      SDL_SetRenderDrawColor(renderer, 230, 50, 50, 255);
+    else
+      SDL_SetRenderDrawColor(renderer, 50, 200, 80, 255);
+    SDL_RenderDrawLine(renderer, x, y, x, y - bar);
+  }
+
+  /* Budget marker */
+  SDL_SetRenderDrawColor(renderer, 240, 220, 60, 255);
+  SDL_RenderDrawLine(renderer, kOVERLAY_GAP, y - kGRAPH_HEIGHT / 2,
+                     kOVERLAY_GAP + kFRAME_COUNT, y - kGRAPH_HEIGHT / 2);
+
+  return true;
+}
+
+/*
+ * Description: Sets if the overlay is displayed on top of the frame. The text
+ *              is freed when disabled.
+ *
+ * Inputs: bool enabled - true to display the overlay
+ * Output: none
+ */
+void Profiler::setOverlayEnabled(bool enabled)
+{
+  overlay_enabled.store(enabled, std::memory_order_relaxed);
+  if(!enabled)
+    unloadOverlay();
+}
+
+/*
+ * Description: Frees the overlay text lines.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Profiler::unloadOverlay()
+{
+  for(auto& line : overlay_lines)
+    delete line;
+  overlay_lines.clear();
+  overlay_refresh = 0;
+}
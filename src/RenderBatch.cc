@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Class Name: RenderBatch
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Batch of textured quads, submitted with one SDL_RenderGeometry
+ *              call per texture. Frames packed in the texture atlas add their
+ *              quads here in place of a copy each, so a layer of tiles costs
+ *              one draw call per atlas page.
+ ******************************************************************************/
+#include "RenderBatch.h"
+
+#include <utility>
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructs an empty batch.
+ *
+ * Inputs: none
+ */
+RenderBatch::RenderBatch() : groups_used{0}, quads{0}
+{
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Adds a quad, drawing the source rect of the texture to the
+ *              destination rect, to the group of the texture.
+ *
+ * Inputs: SDL_Texture* texture - the texture
+ *         const SDL_Rect& src - the source rect of the texture
+ *         const SDL_Rect& dest - the destination rect on the render target
+ *         SDL_Color color - the color and alpha modulation of the quad
+ *         SDL_RendererFlip flip - the flip of the source rect
+ * Output: none
+ */
+void RenderBatch::addQuad(SDL_Texture* texture, const SDL_Rect& src,
+                          const SDL_Rect& dest, SDL_Color color,
+                          SDL_RendererFlip flip)
+{
+  /* Find the group of the texture, or take the next one */
+  BatchGroup* group = nullptr;
+  for(uint32_t i = 0; group == nullptr && i < groups_used; i++)
+    if(groups[i].texture == texture)
+      group = &groups[i];
+
+  if(group == nullptr)
+  {
+    if(groups_used == groups.size())
+      groups.push_back(BatchGroup());
+    group = &groups[groups_used++];
+    group->texture = texture;
+    if(SDL_QueryTexture(texture, nullptr, nullptr, &group->texture_width,
+                        &group->texture_height) != 0)
+      group->texture_width = group->texture_height = 1;
+  }
+
+  /* Texture coordinates, flipped as required */
+  float u1 = static_cast<float>(src.x) / group->texture_width;
+  float u2 = static_cast<float>(src.x + src.w) / group->texture_width;
+  float v1 = static_cast<float>(src.y) / group->texture_height;
+  float v2 = static_cast<float>(src.y + src.h) / group->texture_height;
+  if(flip & SDL_FLIP_HORIZONTAL)
+    std::swap(u1, u2);
+  if(flip & SDL_FLIP_VERTICAL)
+    std::swap(v1, v2);
+
+  /* Two triangles: top left, top right, bottom right and bottom left */
+  float x1 = dest.x;
+  float x2 = dest.x + dest.w;
+  float y1 = dest.y;
+  float y2 = dest.y + dest.h;
+  int base = group->vertices.size();
+  group->vertices.push_back({{x1, y1}, color, {u1, v1}});
+  group->vertices.push_back({{x2, y1}, color, {u2, v1}});
+  group->vertices.push_back({{x2, y2}, color, {u2, v2}});
+  group->vertices.push_back({{x1, y2}, color, {u1, v2}});
+  for(int index : {0, 1, 2, 0, 2, 3})
+    group->indices.push_back(base + index);
+
+  quads++;
+}
+
+/*
+ * Description: Submits the quads with one SDL_RenderGeometry call per texture
+ *              and empties the batch. The allocations are kept for the next
+ *              batch.
+ *
+ * Inputs: SDL_Renderer* renderer - the renderer to draw with
+ * Output: bool - true if every draw call succeeded
+ */
+bool RenderBatch::flush(SDL_Renderer* renderer)
+{
+  bool success = true;
+
+  for(uint32_t i = 0; i < groups_used; i++)
+  {
+    BatchGroup& group = groups[i];
+
+    SDL_SetTextureBlendMode(group.texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureAlphaMod(group.texture, 255);
+    SDL_SetTextureColorMod(group.texture, 255, 255, 255);
+    success &= (SDL_RenderGeometry(renderer, group.texture,
+                                   group.vertices.data(),
+                                   group.vertices.size(), group.indices.data(),
+                                   group.indices.size()) == 0);
+
+    group.indices.clear();
+    group.vertices.clear();
+  }
+
+  groups_used = 0;
+  quads = 0;
+
+  return success;
+}
+
+/*
+ * Description: Returns the number of quads in the batch, not yet submitted.
+ *
+ * Inputs: none
+ * Output: uint32_t - the number of quads
+ */
+uint32_t RenderBatch::getQuadCount() const
+{
+  return quads;
+}
@@ -12,6 +12,7 @@
  * TODO:
  ******************************************************************************/
 #include "Sound.h"
+#include "AssetPack.h"
 
 /* Constant Implementation - see header file for descriptions */
 const float Sound::kDEFAULT_RATIO = 0.75;
@@ -451,7 +452,7 @@ bool Sound::setSoundFile(std::string path)
   if(!path.empty())
   {
     /* First, try wav loader */
-    Mix_Chunk* sound = Mix_LoadWAV(path.c_str());
+    Mix_Chunk* sound = AssetPack::loadSound(path);
 
     /* Determine if the setting of the sound was valid */
     if(sound == NULL)
@@ -7,6 +7,7 @@
  *              they don't, etc.
  ******************************************************************************/
 #include "SoundHandler.h"
+#include "Profiler.h"
 
 /*=============================================================================
  * CONSTRUCTORS / DESTRUCTORS
@@ -295,41 +296,48 @@ bool SoundHandler::isSoundSet(uint32_t id)
  *         std::string base_path - base path to project directory
  * Output: bool - true if load was successful
  */
-bool SoundHandler::load(XmlData data, int index, std::string base_path)
+bool SoundHandler::load(const XmlData& data, int index, std::string base_path)
 {
   bool success = true;
   Sound* edit_chunk = nullptr;
 
   /* Get chunk pointer */
-  if(data.getElement(index) == "music" && !data.getKeyValue(index).empty())
+  switch(data.getElementToken(index))
   {
-    int id = stoi(data.getKeyValue(index));
-    edit_chunk = createAudioMusic(id);
-  }
-  else if(data.getElement(index) == "sound" && !data.getKeyValue(index).empty())
-  {
-    int id = stoi(data.getKeyValue(index));
-    edit_chunk = createAudioSound(id);
+  case(XmlToken::MUSIC):
+    if(!data.getKeyValue(index).empty())
+      edit_chunk = createAudioMusic(stoi(data.getKeyValue(index)));
+    break;
+  case(XmlToken::SOUND):
+    if(!data.getKeyValue(index).empty())
+      edit_chunk = createAudioSound(stoi(data.getKeyValue(index)));
+    break;
+  default:
+    break;
   }
 
   /* Process changes */
   if(edit_chunk != nullptr)
   {
-    if(data.getElement(index + 1) == "fade")
+    switch(data.getElementToken(index + 1))
     {
+    case(XmlToken::FADE):
       edit_chunk->setFadeTime(data.getDataInteger());
-    }
-    else if(data.getElement(index + 1) == "path")
-    {
+      break;
+    case(XmlToken::PATH):
       success &= edit_chunk->setSoundFile(base_path + data.getDataString());
-    }
-    else if(data.getElement(index + 1) == "vol")
+      break;
+    case(XmlToken::VOL):
     {
       int sound_vol = data.getDataInteger();
       if(sound_vol >= 0 && sound_vol <= 255)
         edit_chunk->setVolume(sound_vol);
       else
         success = false;
+      break;
+    }
+    default:
+      break;
     }
   }
   else
@@ -348,6 +356,7 @@ bool SoundHandler::load(XmlData data, int index, std::string base_path)
  */
 void SoundHandler::process()
 {
+  ProfileScope zone_scope(ProfileZone::SOUND_PROCESS);
   /* Pre-Processing */
   queueCleanUp();
 
@@ -13,6 +13,8 @@
  *   1. Sound added for particular sprite (category based)
 *******************************************************************************/
 #include "Sprite.h"
+#include "LoadReport.h"
+#include "TextureRegistry.h"
 
 /*=============================================================================
  * SPRITE CONSTANTS -- See .h file for details
@@ -27,6 +29,9 @@ const uint8_t Sprite::kDOUBLE_DIGITS = 10;
 const double Sprite::kMAX_BRIGHTNESS = 2.0;
 const int32_t Sprite::kUNSET_SOUND_ID = -1;
 
+/* Static Implementation - see header file for descriptions */
+std::unordered_set<Sprite*> Sprite::pending_sprites;
+
 /*=============================================================================
  * SPRITE CONSTRUCTORS / DESTRUCTORS
  *============================================================================*/
@@ -114,6 +119,7 @@ Sprite::Sprite(const Sprite& source) : Sprite()
  */
 Sprite::~Sprite()
 {
+  pending_sprites.erase(this);
   clear();
 }
 
@@ -145,6 +151,58 @@ uint16_t Sprite::parseAdjustments(std::vector<std::string> adjustments)
   return angle;
 }
 
+/*
+ * Description: Unlinks the frames of the sprite which have no texture after
+ *              their deferred decode failed, as if their insert had failed.
+ *              They are not deleted, since copies may still point at them,
+ *              but are mapped to the next frame left in the sequence (NULL if
+ *              none is left).
+ *
+ * Inputs: std::unordered_map<Frame*, Frame*>& removed - the removed frames
+ * Output: none
+ */
+void Sprite::removeFailed(std::unordered_map<Frame*, Frame*>& removed)
+{
+  Frame* frame = head;
+  int count = size;
+
+  for(int i = 0; i < count; i++)
+  {
+    Frame* next_frame = frame->getNext();
+
+    if(!frame->isTextureSet())
+    {
+      if(size == 1)
+      {
+        head = nullptr;
+        next_frame = nullptr;
+      }
+      else
+      {
+        /* Reset linked list pointers around the failed frame */
+        Frame* previous_frame = frame->getPrevious();
+        next_frame->setPrevious(previous_frame);
+        previous_frame->setNext(next_frame);
+
+        if(frame == head)
+          head = next_frame;
+      }
+
+      removed[frame] = next_frame;
+      size--;
+    }
+
+    frame = next_frame;
+  }
+
+  /* Reset the current frame if any were removed */
+  if(size != count)
+  {
+    current = head;
+    texture_update = true;
+  }
+}
+
 /* Description: Sets the texture color modification on the sprite texture. This
  *              is based on the internal stored red, green, blue values which
  *              can be changed using setColorBalance().
@@ -216,7 +274,7 @@ void Sprite::clear()
   /* Delete all class data */
   if(!non_unique)
     removeAll();
-  SDL_DestroyTexture(texture);
+  TextureRegistry::destroy(texture);
 
   /* Reset variables back to blank */
   current = nullptr;
@@ -255,6 +313,10 @@ void Sprite::copySelf(const Sprite& source)
   setRotation(source.getRotation());
   setHead(source.getFirstFrame());
 
+  /* Shares the source frames, so also needs them dropped if they fail */
+  if(pending_sprites.count(const_cast<Sprite*>(&source)) > 0)
+    pending_sprites.insert(this);
+
   setOpacity(source.getOpacity());
   setRotation(source.getRotation());
   setSoundID(source.getSoundID());
@@ -276,9 +338,9 @@ void Sprite::copySelf(const Sprite& source)
  *         bool no_warnings - should warnings not fire? default false.
  * Output: bool - true if the add was successful
  */
-bool Sprite::addFileInformation(XmlData data, int index, SDL_Renderer* renderer,
-                                std::string base_path, bool no_warnings,
-                                bool build_data)
+bool Sprite::addFileInformation(const XmlData& data, int index,
+                                SDL_Renderer* renderer, std::string base_path,
+                                bool no_warnings, bool build_data)
 {
   std::string element = data.getElement(index);
   bool success = true;
@@ -364,11 +426,13 @@ bool Sprite::addFileInformation(XmlData data, int index, SDL_Renderer* renderer,
  */
 void Sprite::createTexture(SDL_Renderer* renderer)
 {
-  if(head != nullptr && head->isTextureSet() && texture == nullptr)
+  if(head != nullptr && head->isTextureSet() && !head->isTexturePending() &&
+     texture == nullptr)
   {
-    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                                SDL_TEXTUREACCESS_TARGET, head->getWidth(),
-                                head->getHeight());
+    texture = TextureRegistry::create(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                      SDL_TEXTUREACCESS_TARGET,
+                                      head->getWidth(), head->getHeight(),
+                                      TextureSource::SPRITE_TARGET);
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     setColorMod();
     setOpacity(opacity);
@@ -710,6 +774,9 @@ Frame* Sprite::insert(std::string path, SDL_Renderer* renderer, int position,
       if(position == 0)
         head = new_frame;
 
+      if(new_frame->isTexturePending())
+        pending_sprites.insert(this);
+
       size++;
       return new_frame;
     }
@@ -742,19 +809,20 @@ Frame* Sprite::insertFirst(std::string path, SDL_Renderer* renderer,
 
     if(head->isTextureSet())
     {
-      /* First set the rendering texture, if unset */
-      if(texture == NULL)
+      /* First set the rendering texture, if unset. A frame still decoding
+       * has no size yet, so its sprite creates it on the first render */
+      if(texture == NULL && !head->isTexturePending())
       {
-        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                                    SDL_TEXTUREACCESS_TARGET, head->getWidth(),
-                                    head->getHeight());
+        texture = TextureRegistry::create(
+            renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+            head->getWidth(), head->getHeight(), TextureSource::SPRITE_TARGET);
         SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
         setColorMod();
         setOpacity(opacity);
       }
 
       /* Only proceed with finishing if the rendering texture could be set */
-      if(texture != NULL)
+      if(texture != NULL || head->isTexturePending())
       {
         head->setNext(head);
         head->setPrevious(head);
@@ -762,6 +830,9 @@ Frame* Sprite::insertFirst(std::string path, SDL_Renderer* renderer,
         size = 1;
         texture_update = true;
 
+        if(head->isTexturePending())
+          pending_sprites.insert(this);
+
         return head;
       }
     }
@@ -1091,10 +1162,17 @@ void Sprite::resetLoops()
 bool Sprite::render(SDL_Renderer* renderer, int x, int y, int w, int h)
 {
   if(!built_texture)
+  {
+    LoadScope load_scope(LoadPhase::SPRITE_BUILD);
     loadData(renderer);
+  }
 
   if(current != nullptr && renderer != nullptr)
   {
+    /* Frames set under deferred loading leave the texture to the render */
+    if(texture == nullptr)
+      createTexture(renderer);
+
     /* Proceed to update the running texture if it's changed */
     if(texture_update || color_mode == ColorMode::GREYING ||
        color_mode == ColorMode::COLORING)
@@ -1147,6 +1225,45 @@ bool Sprite::render(SDL_Renderer* renderer, int x, int y, int w, int h)
   return false;
 }
 
+/*
+ * Description: Adds the current frame to the batch, with the color balance,
+ *              brightness and opacity of the sprite as the quad color. This
+ *              skips the sprite texture, so only plain sprites can be batched:
+ *              color mode, no brightening, rotation or source rect and the
+ *              frame packed in the atlas. Any other sprite is rendered.
+ *
+ * Inputs: RenderBatch& batch - the batch to add to
+ *         SDL_Renderer* renderer - the rendering engine, if rendered
+ *         int x - the x coordinate on the painted viewport
+ *         int y - the y coordinate on the painted viewport
+ *         int w - the width of the texture painted
+ *         int h - the height of the texture painted
+ * Output: bool - status if the add or render was successful
+ */
+bool Sprite::renderBatch(RenderBatch& batch, SDL_Renderer* renderer, int x,
+                         int y, int w, int h)
+{
+  if(!built_texture)
+  {
+    LoadScope load_scope(LoadPhase::SPRITE_BUILD);
+    loadData(renderer);
+  }
+
+  if(current != nullptr && color_mode == ColorMode::COLOR &&
+     brightness <= kDEFAULT_BRIGHTNESS && rotation_angle == 0 &&
+     !src_rect_use)
+  {
+    SDL_Color color = {static_cast<uint8_t>(brightness * color_red),
+                       static_cast<uint8_t>(brightness * color_green),
+                       static_cast<uint8_t>(brightness * color_blue),
+                       opacity};
+    if(current->renderBatch(batch, x, y, w, h, color))
+      return true;
+  }
+
+  return render(renderer, x, y, w, h);
+}
+
 /*
  * Description: Revers the normal color mod values to the values to the value
  *              stored in the temporary color mod. variables.
@@ -1815,3 +1932,55 @@ int Sprite::getAngle(RotatedAngle angle)
     return 180;
   return 0;
 }
+
+/*
+ * Description: Starts deferred loading of the frames. See
+ *              Frame::beginDeferredLoad().
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Sprite::beginDeferredLoad()
+{
+  Frame::beginDeferredLoad();
+}
+
+/*
+ * Description: Ends deferred loading of the frames. See
+ *              Frame::endDeferredLoad(). Each frame whose image failed to
+ *              decode is then removed from its sprite, the same as when an
+ *              immediate load fails, and copies sharing it move their head on.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void Sprite::endDeferredLoad()
+{
+  Frame::endDeferredLoad();
+
+  /* Unlink the failed frames from the sprites that own them */
+  std::unordered_map<Frame*, Frame*> removed;
+  for(auto& sprite : pending_sprites)
+    if(!sprite->non_unique)
+      sprite->removeFailed(removed);
+
+  /* Copies share the frames of their source, so move them off removed ones */
+  if(!removed.empty())
+  {
+    for(auto& sprite : pending_sprites)
+    {
+      Frame* new_head = sprite->head;
+      for(auto it = removed.find(new_head); it != removed.end();
+          it = removed.find(new_head))
+        new_head = it->second;
+
+      if(new_head != sprite->head)
+        sprite->setHead(new_head);
+    }
+
+    for(auto& frame : removed)
+      delete frame.first;
+  }
+
+  pending_sprites.clear();
+}
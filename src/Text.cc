@@ -7,6 +7,7 @@
  *              sizing.
  ******************************************************************************/
 #include "Text.h"
+#include "TextureRegistry.h"
 
 /* Constant Implementation - see header file for descriptions */
 const uint8_t Text::kDEFAULT_ALPHA = 255;
@@ -259,8 +260,8 @@ bool Text::setText(SDL_Renderer* renderer, string text, SDL_Color text_color)
     if(text_surface != NULL)
     {
       /* Create the texture */
-      SDL_Texture* text_texture =
-                          SDL_CreateTextureFromSurface(renderer, text_surface);
+      SDL_Texture* text_texture = TextureRegistry::createFromSurface(
+          renderer, text_surface, TextureSource::TEXT);
       if(text_texture != NULL)
       {
         /* Set the internal class texture */
@@ -344,8 +345,8 @@ bool Text::setText(SDL_Renderer* renderer,
       /* -- Valid surface: convert to texture -- */
       if(text_surfaces[i] != nullptr)
       {
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer,
-                                                          text_surfaces[i]);
+        SDL_Texture* texture = TextureRegistry::createFromSurface(
+            renderer, text_surfaces[i], TextureSource::TEXT);
         if(texture != nullptr)
         {
           text_textures.push_back(pair<SDL_Texture*, SDL_Point>(
@@ -369,10 +370,9 @@ bool Text::setText(SDL_Renderer* renderer,
     {
       /* Combine into one large texture */
       SDL_Texture* orig_render = SDL_GetRenderTarget(renderer);
-      SDL_Texture* texture = SDL_CreateTexture(renderer,
-                                               SDL_PIXELFORMAT_RGBA8888,
-                                               SDL_TEXTUREACCESS_TARGET,
-                                               total_width, max_height);
+      SDL_Texture* texture = TextureRegistry::create(
+          renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+          total_width, max_height, TextureSource::TEXT);
       int x_ref = 0;
       SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
       SDL_SetRenderTarget(renderer, texture);
@@ -403,7 +403,7 @@ bool Text::setText(SDL_Renderer* renderer,
     /* Clean-up surfaces and textures created */
     for(uint32_t i = 0; i < text_textures.size(); i++)
       if(text_textures[i].first != nullptr)
-        SDL_DestroyTexture(text_textures[i].first);
+        TextureRegistry::destroy(text_textures[i].first);
     text_textures.clear();
     for(uint32_t i = 0; i < text_surfaces.size(); i++)
       if(text_surfaces[i] != nullptr)
@@ -436,7 +436,7 @@ void Text::unsetFont()
  */
 void Text::unsetTexture()
 {
-  SDL_DestroyTexture(texture);
+  TextureRegistry::destroy(texture);
   texture = NULL;
 }
 
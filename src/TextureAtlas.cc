@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Class Name: TextureAtlas
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Packing of small frame images into large shared textures
+ *              (pages). Tile sized images loaded with the map are copied into
+ *              a page in shelf order, and the frame renders its rect of the
+ *              page in place of owning a texture. Each page has a greyscale
+ *              twin with the same layout for the greyscale duplicates.
+ ******************************************************************************/
+#include "TextureAtlas.h"
+#include "TextureRegistry.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int TextureAtlas::kMAX_IMAGE = 128;
+const int TextureAtlas::kPADDING = 1;
+const int TextureAtlas::kPAGE_SIZE = 1024;
+const uint32_t TextureAtlas::kFORMAT = SDL_PIXELFORMAT_ARGB8888;
+
+/* Static Implementation - see header file for descriptions */
+std::vector<AtlasPage> TextureAtlas::pages;
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Copies the surface pixels into the page texture at the rect,
+ *              converting them to the page format if needed.
+ *
+ * Inputs: SDL_Texture* texture - the page texture
+ *         SDL_Surface* surface - the image
+ *         const SDL_Rect& rect - the region of the page, the image size
+ * Output: bool - true if the pixels were copied
+ */
+bool TextureAtlas::copySurface(SDL_Texture* texture, SDL_Surface* surface,
+                               const SDL_Rect& rect)
+{
+  SDL_Surface* converted = surface;
+  if(surface->format->format != kFORMAT)
+    converted = SDL_ConvertSurfaceFormat(surface, kFORMAT, 0);
+  if(converted == nullptr)
+    return false;
+
+  bool success = (SDL_UpdateTexture(texture, &rect, converted->pixels,
+                                    converted->pitch) == 0);
+
+  if(converted != surface)
+    SDL_FreeSurface(converted);
+  return success;
+}
+
+/*
+ * Description: Creates a transparent page texture, blended when rendered.
+ *
+ * Inputs: SDL_Renderer* renderer - the renderer of the page
+ * Output: SDL_Texture* - the page texture. Null on failure
+ */
+SDL_Texture* TextureAtlas::createPage(SDL_Renderer* renderer)
+{
+  SDL_Texture* texture =
+      TextureRegistry::create(renderer, kFORMAT, SDL_TEXTUREACCESS_STATIC,
+                              kPAGE_SIZE, kPAGE_SIZE, TextureSource::ATLAS);
+
+  if(texture != nullptr)
+  {
+    std::vector<uint32_t> clear(kPAGE_SIZE * kPAGE_SIZE, 0);
+    SDL_UpdateTexture(texture, nullptr, clear.data(),
+                      kPAGE_SIZE * sizeof(uint32_t));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  }
+
+  return texture;
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Packs the image into the last page of the renderer, on the
+ *              current shelf or a new one. A new page is started once the
+ *              last one is full. The greyscale duplicate takes the same rect
+ *              of the greyscale twin.
+ *
+ * Inputs: SDL_Renderer* renderer - the renderer of the page
+ *         SDL_Surface* surface - the image
+ *         SDL_Surface* surface_grey - the greyscale duplicate. May be null
+ *         SDL_Rect& rect - set to the region of the page
+ *         SDL_Texture*& texture - set to the page texture
+ *         SDL_Texture*& texture_grey - set to the greyscale page texture. Null
+ *                                      without the greyscale duplicate
+ * Output: bool - true if packed. False if the image is too large to pack
+ */
+bool TextureAtlas::add(SDL_Renderer* renderer, SDL_Surface* surface,
+                       SDL_Surface* surface_grey, SDL_Rect& rect,
+                       SDL_Texture*& texture, SDL_Texture*& texture_grey)
+{
+  if(renderer == nullptr || surface == nullptr || surface->w > kMAX_IMAGE ||
+     surface->h > kMAX_IMAGE)
+    return false;
+
+  /* Find the spot on the last page of the renderer */
+  AtlasPage* page = nullptr;
+  for(auto it = pages.rbegin(); page == nullptr && it != pages.rend(); ++it)
+    if(it->renderer == renderer)
+      page = &(*it);
+
+  if(page != nullptr && page->shelf_x + surface->w > kPAGE_SIZE)
+  {
+    page->shelf_x = 0;
+    page->shelf_y += page->shelf_height + kPADDING;
+    page->shelf_height = 0;
+  }
+  if(page == nullptr || page->shelf_y + surface->h > kPAGE_SIZE)
+  {
+    AtlasPage new_page = {renderer, createPage(renderer), nullptr, 0, 0, 0, 0};
+    if(new_page.texture == nullptr)
+      return false;
+
+    pages.push_back(new_page);
+    page = &pages.back();
+  }
+
+  /* Greyscale twin, once the page has a greyscale image */
+  if(surface_grey != nullptr && page->texture_grey == nullptr)
+    page->texture_grey = createPage(renderer);
+
+  /* Copy in the image and take the region */
+  rect = {page->shelf_x, page->shelf_y, surface->w, surface->h};
+  bool success = copySurface(page->texture, surface, rect);
+  if(success && surface_grey != nullptr)
+    success &= page->texture_grey != nullptr &&
+               copySurface(page->texture_grey, surface_grey, rect);
+  page->regions++;
+  if(!success)
+  {
+    release(page->texture);
+    return false;
+  }
+
+  page->shelf_x += surface->w + kPADDING;
+  if(surface->h > page->shelf_height)
+    page->shelf_height = surface->h;
+
+  texture = page->texture;
+  texture_grey = (surface_grey != nullptr) ? page->texture_grey : nullptr;
+  return true;
+}
+
+/*
+ * Description: Returns the number of live pages, over all renderers.
+ *
+ * Inputs: none
+ * Output: uint32_t - the number of pages
+ */
+uint32_t TextureAtlas::getPageCount()
+{
+  return pages.size();
+}
+
+/*
+ * Description: Releases a region of the page. The page and its greyscale twin
+ *              are destroyed with the last region.
+ *
+ * Inputs: SDL_Texture* texture - the page texture of the region
+ * Output: none
+ */
+void TextureAtlas::release(SDL_Texture* texture)
+{
+  for(auto it = pages.begin(); it != pages.end(); ++it)
+  {
+    if(it->texture == texture)
+    {
+      if(--it->regions == 0)
+      {
+        TextureRegistry::destroy(it->texture);
+        if(it->texture_grey != nullptr)
+          TextureRegistry::destroy(it->texture_grey);
+        pages.erase(it);
+      }
+      return;
+    }
+  }
+}
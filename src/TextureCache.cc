@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Class Name: TextureCache
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Shared, reference counted frame textures. Frames that load the
+ *              same image (path, rotation angle and greyscale option) with the
+ *              same renderer share one texture and its greyscale duplicate, so
+ *              each image is decoded and uploaded once. The textures are
+ *              destroyed when the last frame releases them.
+ ******************************************************************************/
+#include "TextureCache.h"
+#include "TextureAtlas.h"
+#include "TextureRegistry.h"
+
+/* Static Implementation - see header file for descriptions */
+std::unordered_map<std::string, TextureCacheEntry> TextureCache::entries;
+uint64_t TextureCache::hits = 0;
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Takes a reference to the shared textures of the image, if it
+ *              is loaded.
+ *
+ * Inputs: const std::string& key - the image key, from getKey()
+ *         TextureCacheEntry& entry - set to the shared textures, if found
+ * Output: bool - true if the image is shared and a reference was taken
+ */
+bool TextureCache::acquire(const std::string& key, TextureCacheEntry& entry)
+{
+  auto found = entries.find(key);
+  if(found == entries.end())
+    return false;
+
+  found->second.references++;
+  entry = found->second;
+  hits++;
+
+  return true;
+}
+
+/*
+ * Description: Adds the textures of a newly loaded image, with the reference
+ *              of the frame that loaded it. The cache then owns the textures.
+ *
+ * Inputs: const std::string& key - the image key, from getKey()
+ *         const TextureCacheEntry& entry - the textures, size and atlas rect
+ *                                          of the image
+ * Output: none
+ */
+void TextureCache::add(const std::string& key, const TextureCacheEntry& entry)
+{
+  if(entry.texture != nullptr && entries.find(key) == entries.end())
+  {
+    entries[key] = entry;
+    entries[key].references = 1;
+  }
+}
+
+/*
+ * Description: Returns the number of shared images.
+ *
+ * Inputs: none
+ * Output: uint32_t - the number of images
+ */
+uint32_t TextureCache::getCount()
+{
+  return entries.size();
+}
+
+/*
+ * Description: Returns the number of frame loads served from the cache, in
+ *              place of decoding and uploading the image again.
+ *
+ * Inputs: none
+ * Output: uint64_t - the number of cache hits
+ */
+uint64_t TextureCache::getHits()
+{
+  return hits;
+}
+
+/*
+ * Description: Returns the cache key of an image: the renderer, the full path,
+ *              the rotation angle and if a greyscale duplicate is made.
+ *
+ * Inputs: SDL_Renderer* renderer - the renderer of the textures
+ *         const std::string& path - the full image path
+ *         uint16_t angle - the rotation angle
+ *         bool enable_greyscale - is a greyscale duplicate made
+ * Output: std::string - the key
+ */
+std::string TextureCache::getKey(SDL_Renderer* renderer,
+                                 const std::string& path, uint16_t angle,
+                                 bool enable_greyscale)
+{
+  return std::to_string(reinterpret_cast<uintptr_t>(renderer)) + "|" +
+         std::to_string(angle) + "|" + (enable_greyscale ? "G" : "C") + "|" +
+         path;
+}
+
+/*
+ * Description: Drops a reference to the textures of the image. With the last
+ *              reference, the textures are destroyed or their atlas region is
+ *              released.
+ *
+ * Inputs: const std::string& key - the image key, from getKey()
+ * Output: bool - true if the image is shared. False if the caller owns it
+ */
+bool TextureCache::release(const std::string& key)
+{
+  auto found = entries.find(key);
+  if(found == entries.end())
+    return false;
+
+  TextureCacheEntry& entry = found->second;
+  if(--entry.references == 0)
+  {
+    if(entry.rect_valid)
+    {
+      TextureAtlas::release(entry.texture);
+    }
+    else
+    {
+      TextureRegistry::destroy(entry.texture);
+      if(entry.texture_grey != nullptr)
+        TextureRegistry::destroy(entry.texture_grey);
+    }
+    entries.erase(found);
+  }
+
+  return true;
+}
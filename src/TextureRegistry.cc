@@ -0,0 +1,303 @@
+/*******************************************************************************
+ * Class Name: TextureRegistry
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Accounting of every SDL_Texture created by the engine. Textures
+ *              are created and destroyed through the registry, which records
+ *              the dimensions, estimated bytes, source (frame, greyscale
+ *              duplicate, sprite render target, text, ad-hoc build, atlas
+ *              page or map tile chunk) and the owning view (title, map,
+ *              battle, menu) of each. Totals are available to the profiler
+ *              overlay and the full set can be dumped to a CSV file.
+ ******************************************************************************/
+#include "TextureRegistry.h"
+
+#include <fstream>
+#include <iostream>
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t TextureRegistry::kOWNER_COUNT =
+    static_cast<uint32_t>(TextureOwner::COUNT);
+const uint32_t TextureRegistry::kSOURCE_COUNT =
+    static_cast<uint32_t>(TextureSource::COUNT);
+
+/* Static Implementation - see header file for descriptions */
+TextureOwner TextureRegistry::owner = TextureOwner::GENERAL;
+std::unordered_map<SDL_Texture*, TextureEntry> TextureRegistry::textures;
+uint64_t TextureRegistry::total_bytes = 0;
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Registers a newly created texture with its queried size and
+ *              estimated bytes, under the current owner.
+ *
+ * Inputs: SDL_Texture* texture - the created texture (may be null)
+ *         TextureSource source - what the texture was created for
+ * Output: SDL_Texture* - the same texture, for chaining
+ */
+SDL_Texture* TextureRegistry::add(SDL_Texture* texture, TextureSource source)
+{
+  if(texture != nullptr)
+  {
+    TextureEntry entry;
+    uint32_t format = 0;
+
+    SDL_QueryTexture(texture, &format, nullptr, &entry.width, &entry.height);
+    entry.bytes = entry.width * entry.height * SDL_BYTESPERPIXEL(format);
+    entry.owner = owner;
+    entry.source = source;
+
+    /* A reused pointer would otherwise be counted twice */
+    auto found = textures.find(texture);
+    if(found != textures.end())
+      total_bytes -= found->second.bytes;
+
+    textures[texture] = entry;
+    total_bytes += entry.bytes;
+  }
+
+  return texture;
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Creates a texture with SDL_CreateTexture() and registers it.
+ *
+ * Inputs: SDL_Renderer* renderer - the rendering engine
+ *         uint32_t format - the SDL pixel format
+ *         int access - the SDL texture access
+ *         int w - the texture width
+ *         int h - the texture height
+ *         TextureSource source - what the texture is created for
+ * Output: SDL_Texture* - the created texture. Null on failure
+ */
+SDL_Texture* TextureRegistry::create(SDL_Renderer* renderer, uint32_t format,
+                                     int access, int w, int h,
+                                     TextureSource source)
+{
+  return add(SDL_CreateTexture(renderer, format, access, w, h), source);
+}
+
+/*
+ * Description: Creates a texture with SDL_CreateTextureFromSurface() and
+ *              registers it.
+ *
+ * Inputs: SDL_Renderer* renderer - the rendering engine
+ *         SDL_Surface* surface - the surface to copy into the texture
+ *         TextureSource source - what the texture is created for
+ * Output: SDL_Texture* - the created texture. Null on failure
+ */
+SDL_Texture* TextureRegistry::createFromSurface(SDL_Renderer* renderer,
+                                                SDL_Surface* surface,
+                                                TextureSource source)
+{
+  return add(SDL_CreateTextureFromSurface(renderer, surface), source);
+}
+
+/*
+ * Description: Removes the texture from the registry and destroys it. Null
+ *              textures are ignored.
+ *
+ * Inputs: SDL_Texture* texture - the texture to destroy
+ * Output: none
+ */
+void TextureRegistry::destroy(SDL_Texture* texture)
+{
+  if(texture != nullptr)
+  {
+    auto found = textures.find(texture);
+    if(found != textures.end())
+    {
+      total_bytes -= found->second.bytes;
+      textures.erase(found);
+    }
+
+    SDL_DestroyTexture(texture);
+  }
+}
+
+/*
+ * Description: Dumps the registry to a CSV file. The totals by owner and by
+ *              source are written first, followed by every live texture.
+ *
+ * Inputs: std::string path - the CSV file path
+ * Output: bool - true if the file was written
+ */
+bool TextureRegistry::dump(std::string path)
+{
+  std::ofstream out(path.c_str(), std::ios::out | std::ios::trunc);
+  if(!out.good())
+  {
+    std::cerr << "[ERROR] Texture dump \"" << path << "\" could not be opened"
+              << std::endl;
+    return false;
+  }
+
+  /* Totals */
+  out << "group,name,count,bytes" << std::endl;
+  out << "total,all," << getCount() << "," << getBytes() << std::endl;
+  for(uint32_t i = 0; i < kOWNER_COUNT; i++)
+  {
+    TextureOwner dump_owner = static_cast<TextureOwner>(i);
+    uint32_t count = 0;
+    for(auto& texture : textures)
+      if(texture.second.owner == dump_owner)
+        count++;
+    out << "owner," << getOwnerName(dump_owner) << "," << count << ","
+        << getBytes(dump_owner) << std::endl;
+  }
+  for(uint32_t i = 0; i < kSOURCE_COUNT; i++)
+  {
+    TextureSource dump_source = static_cast<TextureSource>(i);
+    uint32_t count = 0;
+    for(auto& texture : textures)
+      if(texture.second.source == dump_source)
+        count++;
+    out << "source," << getSourceName(dump_source) << "," << count << ","
+        << getBytes(dump_source) << std::endl;
+  }
+
+  /* Live textures */
+  out << std::endl << "texture,owner,source,width,height,bytes" << std::endl;
+  for(auto& texture : textures)
+    out << texture.first << "," << getOwnerName(texture.second.owner) << ","
+        << getSourceName(texture.second.source) << "," << texture.second.width
+        << "," << texture.second.height << "," << texture.second.bytes
+        << std::endl;
+  out.close();
+
+  std::cout << "Textures: " << getCount() << " (" << getBytes() / 1024
+            << " KiB) dumped to " << path << std::endl;
+
+  return true;
+}
+
+/*
+ * Description: Returns the estimated bytes of all live textures.
+ *
+ * Inputs: none
+ * Output: uint64_t - the total bytes
+ */
+uint64_t TextureRegistry::getBytes()
+{
+  return total_bytes;
+}
+
+/*
+ * Description: Returns the estimated bytes of the live textures of an owner.
+ *
+ * Inputs: TextureOwner owner - the owning view
+ * Output: uint64_t - the total bytes of the owner
+ */
+uint64_t TextureRegistry::getBytes(TextureOwner owner)
+{
+  uint64_t bytes = 0;
+
+  for(auto& texture : textures)
+    if(texture.second.owner == owner)
+      bytes += texture.second.bytes;
+
+  return bytes;
+}
+
+/*
+ * Description: Returns the estimated bytes of the live textures of a source.
+ *
+ * Inputs: TextureSource source - the texture source
+ * Output: uint64_t - the total bytes of the source
+ */
+uint64_t TextureRegistry::getBytes(TextureSource source)
+{
+  uint64_t bytes = 0;
+
+  for(auto& texture : textures)
+    if(texture.second.source == source)
+      bytes += texture.second.bytes;
+
+  return bytes;
+}
+
+/*
+ * Description: Returns the number of live textures.
+ *
+ * Inputs: none
+ * Output: uint32_t - the texture count
+ */
+uint32_t TextureRegistry::getCount()
+{
+  return textures.size();
+}
+
+/*
+ * Description: Returns the owner that is assigned to newly created textures.
+ *
+ * Inputs: none
+ * Output: TextureOwner - the current owner
+ */
+TextureOwner TextureRegistry::getOwner()
+{
+  return owner;
+}
+
+/*
+ * Description: Returns the display name of the texture owner.
+ *
+ * Inputs: TextureOwner owner - the owning view
+ * Output: std::string - the display name
+ */
+std::string TextureRegistry::getOwnerName(TextureOwner owner)
+{
+  if(owner == TextureOwner::GENERAL)
+    return "general";
+  else if(owner == TextureOwner::TITLE)
+    return "title";
+  else if(owner == TextureOwner::MAP)
+    return "map";
+  else if(owner == TextureOwner::BATTLE)
+    return "battle";
+  else if(owner == TextureOwner::MENU)
+    return "menu";
+  return "";
+}
+
+/*
+ * Description: Returns the display name of the texture source.
+ *
+ * Inputs: TextureSource source - the texture source
+ * Output: std::string - the display name
+ */
+std::string TextureRegistry::getSourceName(TextureSource source)
+{
+  if(source == TextureSource::FRAME)
+    return "frame";
+  else if(source == TextureSource::FRAME_GREY)
+    return "frame_grey";
+  else if(source == TextureSource::SPRITE_TARGET)
+    return "sprite_target";
+  else if(source == TextureSource::TEXT)
+    return "text";
+  else if(source == TextureSource::BUILD)
+    return "build";
+  else if(source == TextureSource::ATLAS)
+    return "atlas";
+  else if(source == TextureSource::CHUNK)
+    return "chunk";
+  return "";
+}
+
+/*
+ * Description: Sets the owner that is assigned to newly created textures.
+ *
+ * Inputs: TextureOwner owner - the owning view
+ * Output: none
+ */
+void TextureRegistry::setOwner(TextureOwner owner)
+{
+  TextureRegistry::owner = owner;
+}
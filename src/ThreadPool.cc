@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Class Name: ThreadPool
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Fixed set of worker threads for CPU bound work off the main
+ *              thread. Tasks can be submitted individually (with a future to
+ *              wait on) or as a parallel loop over an index range, which the
+ *              calling thread also works on until every index is done.
+ ******************************************************************************/
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t ThreadPool::kMAX_THREADS = 16;
+
+/*=============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructor function - starts the worker threads.
+ *
+ * Inputs: uint32_t thread_count - the number of workers. 0 for one per
+ *                                 hardware thread, less the calling thread
+ */
+ThreadPool::ThreadPool(uint32_t thread_count) : stopping{false}
+{
+  if(thread_count == 0)
+  {
+    uint32_t hardware = std::thread::hardware_concurrency();
+    thread_count = (hardware > 1) ? hardware - 1 : 1;
+  }
+  if(thread_count > kMAX_THREADS)
+    thread_count = kMAX_THREADS;
+
+  for(uint32_t i = 0; i < thread_count; i++)
+    threads.push_back(std::thread(&ThreadPool::work, this));
+}
+
+/*
+ * Description: Destructor function - runs the queued tasks, then stops and
+ *              joins the worker threads.
+ */
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  condition.notify_all();
+
+  for(auto& thread : threads)
+    thread.join();
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Queues a task and wakes a worker for it.
+ *
+ * Inputs: std::function<void()> task - the task
+ * Output: none
+ */
+void ThreadPool::enqueue(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(task);
+  }
+  condition.notify_one();
+}
+
+/*
+ * Description: Worker thread loop. Runs queued tasks until the pool stops
+ *              and the queue is empty.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void ThreadPool::work()
+{
+  while(true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this] { return stopping || !tasks.empty(); });
+      if(tasks.empty())
+        return;
+
+      task = tasks.front();
+      tasks.pop_front();
+    }
+
+    task();
+  }
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the number of worker threads.
+ *
+ * Inputs: none
+ * Output: uint32_t - the worker count
+ */
+uint32_t ThreadPool::getThreadCount()
+{
+  return threads.size();
+}
+
+/*
+ * Description: Runs the task for every index in [0, count) and returns once
+ *              all have run. Indexes are claimed one at a time by the calling
+ *              thread and by up to one helper task per worker, so uneven
+ *              indexes balance out. Helpers that start after every index is
+ *              claimed return straight away.
+ *
+ * Inputs: uint32_t count - the number of indexes
+ *         std::function<void(uint32_t)> task - the task, run once per index
+ * Output: none
+ */
+void ThreadPool::parallelFor(uint32_t count,
+                             std::function<void(uint32_t)> task)
+{
+  struct LoopState
+  {
+    std::atomic<uint32_t> next{0};
+    std::atomic<uint32_t> done{0};
+    std::condition_variable condition;
+    std::mutex mutex;
+  };
+
+  if(count == 0)
+    return;
+
+  auto state = std::make_shared<LoopState>();
+  auto body = [state, count, task]() {
+    uint32_t index;
+    while((index = state->next.fetch_add(1)) < count)
+    {
+      task(index);
+      if(state->done.fetch_add(1) + 1 == count)
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->condition.notify_all();
+      }
+    }
+  };
+
+  /* Helpers, then the calling thread */
+  uint32_t helpers = std::min(getThreadCount(), count - 1);
+  for(uint32_t i = 0; i < helpers; i++)
+    enqueue(body);
+  body();
+
+  /* Wait for indexes still running on the workers */
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->condition.wait(lock, [&] { return state->done.load() == count; });
+}
+
+/*
+ * Description: Queues a task for the workers.
+ *
+ * Inputs: std::function<void()> task - the task
+ * Output: std::future<void> - ready once the task has run
+ */
+std::future<void> ThreadPool::submit(std::function<void()> task)
+{
+  auto packaged = std::make_shared<std::packaged_task<void()>>(task);
+  std::future<void> result = packaged->get_future();
+
+  enqueue([packaged]() { (*packaged)(); });
+
+  return result;
+}
+
+/*=============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the pool shared by the engine, created on first use.
+ *
+ * Inputs: none
+ * Output: ThreadPool& - the shared pool
+ */
+ThreadPool& ThreadPool::getShared()
+{
+  static ThreadPool shared;
+  return shared;
+}
@@ -7,6 +7,8 @@
  *****************************************************************************/
 #include "XmlData.h"
 
+#include <unordered_map>
+
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *===========================================================================*/
@@ -250,6 +252,7 @@ bool XmlData::addElement(std::string element,
   if(!element.empty())
   {
     this->element.push_back(element);
+    this->token.push_back(tokenize(element));
 
     /* Only add key-value pair if key is not empty (aka default) */
     if(!key.empty())
@@ -281,6 +284,7 @@ bool XmlData::clearElements()
   element.clear();
   key.clear();
   value.clear();
+  token.clear();
 
   return true;
 }
@@ -318,6 +322,7 @@ void XmlData::flipElements()
   std::vector<std::string> flipped_elements;
   std::vector<std::string> flipped_keys;
   std::vector<std::string> flipped_values;
+  std::vector<XmlToken> flipped_tokens;
   
   /* Flip all the elements */
   for(int i = element.size() - 1; i >= 0; i--)
@@ -325,12 +330,14 @@ void XmlData::flipElements()
     flipped_elements.push_back(element[i]);
     flipped_keys.push_back(key[i]);
     flipped_values.push_back(value[i]);
+    flipped_tokens.push_back(token[i]);
   }
   
   /* Swap the vectors */
   element = flipped_elements;
   key = flipped_keys;
   value =flipped_values;
+  token = flipped_tokens;
 }
 
 /*
@@ -340,7 +347,7 @@ void XmlData::flipElements()
  * Inputs: bool* success - status if the data in the class in not invalid
  * Output: std::string - the data as a string
  */
-std::string XmlData::getData(bool* success)
+std::string XmlData::getData(bool* success) const
 {
   std::string data_str = "";
 
@@ -379,7 +386,7 @@ std::string XmlData::getData(bool* success)
  * Inputs: bool* success - status if the data in the class is bool
  * Output: bool - the bool data available in the class
  */
-bool XmlData::getDataBool(bool* success)
+bool XmlData::getDataBool(bool* success) const
 {
   /* Only return data if the data stored is a boolean */
   if(data_type == BOOLEAN)
@@ -402,7 +409,7 @@ bool XmlData::getDataBool(bool* success)
  * Inputs: bool* success - status if the data in the class is bool
  * Output: float - the float data available in the class
  */
-float XmlData::getDataFloat(bool* success)
+float XmlData::getDataFloat(bool* success) const
 {
   /* Only return data if the data stored is a float */
   if(data_type == FLOAT)
@@ -425,7 +432,7 @@ float XmlData::getDataFloat(bool* success)
  * Inputs: bool* success - status if the data in the class is bool
  * Output: int - the integer data available in the class
  */
-int XmlData::getDataInteger(bool* success)
+int XmlData::getDataInteger(bool* success) const
 {
   /* Only return data if the data stored is an integer */
   if(data_type == INTEGER)
@@ -448,7 +455,7 @@ int XmlData::getDataInteger(bool* success)
  * Inputs: bool* success - status if the data in the class is bool
  * Output: std::string - the string data available in the class
  */
-std::string XmlData::getDataString(bool* success)
+std::string XmlData::getDataString(bool* success) const
 {
   /* Only return data if the data stored is a string */
   if(data_type == STRING)
@@ -470,7 +477,7 @@ std::string XmlData::getDataString(bool* success)
  * Inputs: none
  * Output: XmlData::DataType - the data type to define
  */
-XmlData::DataType XmlData::getDataType()
+XmlData::DataType XmlData::getDataType() const
 {
   return data_type;
 }
@@ -481,7 +488,7 @@ XmlData::DataType XmlData::getDataType()
  * Inputs: none
  * Output: std::vector<std::string> - the list of all elements in the class
  */
-std::vector<std::string> XmlData::getAllElements()
+std::vector<std::string> XmlData::getAllElements() const
 {
   return element;
 }
@@ -493,7 +500,7 @@ std::vector<std::string> XmlData::getAllElements()
  * Inputs: none
  * Output: std::vector<std::string> - the list of all keys in the class
  */
-std::vector<std::string> XmlData::getAllKeys()
+std::vector<std::string> XmlData::getAllKeys() const
 {
   return key;
 }
@@ -506,7 +513,7 @@ std::vector<std::string> XmlData::getAllKeys()
  * Output: std::vector<std::string> - the list of all values (of keys) in the 
  *                                    class
  */
-std::vector<std::string> XmlData::getAllKeyValues()
+std::vector<std::string> XmlData::getAllKeyValues() const
 {
   return value;
 }
@@ -518,13 +525,28 @@ std::vector<std::string> XmlData::getAllKeyValues()
  * Inputs: uint16_t index - the index of the element to return
  * Output: std::string - the element to be returned
  */
-std::string XmlData::getElement(uint16_t index)
+std::string XmlData::getElement(uint16_t index) const
 {
   if(index < element.size())
     return element[index];
   return "";
 }
 
+/*
+ * Description: Returns the interned token of the element at the given index,
+ *              if it's within range. Otherwise, it returns UNKNOWN, as it does
+ *              for element names that are not interned.
+ *
+ * Inputs: uint16_t index - the index of the element token to return
+ * Output: XmlToken - the element token
+ */
+XmlToken XmlData::getElementToken(uint16_t index) const
+{
+  if(index < token.size())
+    return token[index];
+  return XmlToken::UNKNOWN;
+}
+
 /* 
  * Description: Returns a single key of the given index, if it's within
  *              range. Otherwise, it's returns a blank string. This key
@@ -533,7 +555,7 @@ std::string XmlData::getElement(uint16_t index)
  * Inputs: uint16_t index - the index of the key to return
  * Output: std::string - the key to be returned
  */
-std::string XmlData::getKey(uint16_t index)
+std::string XmlData::getKey(uint16_t index) const
 {
   if(index < key.size())
     return key[index];
@@ -547,7 +569,7 @@ std::string XmlData::getKey(uint16_t index)
  * Inputs: uint16_t index - the index of the value (of the key) to return
  * Output: std::string - the value (of the key) to be returned
  */
-std::string XmlData::getKeyValue(uint16_t index)
+std::string XmlData::getKeyValue(uint16_t index) const
 {
   if(index < value.size())
     return value[index];
@@ -562,7 +584,7 @@ std::string XmlData::getKeyValue(uint16_t index)
  * Inputs: none
  * Output: int - the number of elements in the class
  */
-int XmlData::getNumElements()
+int XmlData::getNumElements() const
 {
   return element.size();
 }
@@ -573,7 +595,7 @@ int XmlData::getNumElements()
  * Inputs: uint16_t index - the index for the starting element
  * Output: std::vector<std::string> - the vector stack of elements
  */
-std::vector<std::string> XmlData::getTailElements(uint16_t index)
+std::vector<std::string> XmlData::getTailElements(uint16_t index) const
 {
   std::vector<std::string> tail_elements;
   
@@ -592,7 +614,7 @@ std::vector<std::string> XmlData::getTailElements(uint16_t index)
  * Inputs: none
  * Output: bool - returns if the data is a boolean.
  */
-bool XmlData::isDataBool()
+bool XmlData::isDataBool() const
 {
   return (data_type == BOOLEAN);
 }
@@ -603,7 +625,7 @@ bool XmlData::isDataBool()
  * Inputs: none
  * Output: bool - returns if the data is a float.
  */
-bool XmlData::isDataFloat()
+bool XmlData::isDataFloat() const
 {
   return (data_type == FLOAT);
 }
@@ -614,7 +636,7 @@ bool XmlData::isDataFloat()
  * Inputs: none
  * Output: bool - returns if the data is an integer.
  */
-bool XmlData::isDataInteger()
+bool XmlData::isDataInteger() const
 {
   return (data_type == INTEGER);
 }
@@ -625,7 +647,7 @@ bool XmlData::isDataInteger()
  * Inputs: none
  * Output: bool - returns if the data is a string.
  */
-bool XmlData::isDataString()
+bool XmlData::isDataString() const
 {
   return (data_type == STRING);
 }
@@ -636,7 +658,7 @@ bool XmlData::isDataString()
  * Inputs: none
  * Output: bool - returns if the data is unset.
  */
-bool XmlData::isDataUnset()
+bool XmlData::isDataUnset() const
 {
   return (data_type == NONE);
 }
@@ -657,7 +679,88 @@ bool XmlData::removeLastElement()
     element.pop_back();
     key.pop_back();
     value.pop_back();
+    token.pop_back();
     return true;
   }
   return false;
 }
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the interned token of the element name. The table is
+ *              built on the first call and only read after, so it is safe to
+ *              tokenize from several threads.
+ *
+ * Inputs: std::string_view element - the element name
+ * Output: XmlToken - the element token. UNKNOWN if the name is not interned
+ */
+XmlToken XmlData::tokenize(std::string_view element)
+{
+  static const std::unordered_map<std::string_view, XmlToken> tokens = {
+      {"action", XmlToken::ACTION},
+      {"app", XmlToken::APP},
+      {"audio_level", XmlToken::AUDIO_LEVEL},
+      {"autorun", XmlToken::AUTORUN},
+      {"base", XmlToken::BASE},
+      {"battlescene", XmlToken::BATTLESCENE},
+      {"battle_animations", XmlToken::BATTLE_ANIMATIONS},
+      {"bearacks", XmlToken::BEARACKS},
+      {"class", XmlToken::CLASS},
+      {"core", XmlToken::CORE},
+      {"currentmap", XmlToken::CURRENTMAP},
+      {"date", XmlToken::DATE},
+      {"enhancer", XmlToken::ENHANCER},
+      {"fade", XmlToken::FADE},
+      {"FAST_BATTLE", XmlToken::FAST_BATTLE},
+      {"frame_limit", XmlToken::FRAME_LIMIT},
+      {"fullscreen", XmlToken::FULLSCREEN},
+      {"game", XmlToken::GAME},
+      {"gui_enabled", XmlToken::GUI_ENABLED},
+      {"height", XmlToken::HEIGHT},
+      {"inventory", XmlToken::INVENTORY},
+      {"item", XmlToken::ITEM},
+      {"learned", XmlToken::LEARNED},
+      {"linear_filtering", XmlToken::LINEAR_FILTERING},
+      {"lower", XmlToken::LOWER},
+      {"main", XmlToken::MAIN},
+      {"map", XmlToken::MAP},
+      {"mapio", XmlToken::MAPIO},
+      {"mapitem", XmlToken::MAPITEM},
+      {"mapnpc", XmlToken::MAPNPC},
+      {"mapperson", XmlToken::MAPPERSON},
+      {"mapthing", XmlToken::MAPTHING},
+      {"music", XmlToken::MUSIC},
+      {"music_level", XmlToken::MUSIC_LEVEL},
+      {"name", XmlToken::NAME},
+      {"options", XmlToken::OPTIONS},
+      {"overlay", XmlToken::OVERLAY},
+      {"party", XmlToken::PARTY},
+      {"path", XmlToken::PATH},
+      {"person", XmlToken::PERSON},
+      {"player", XmlToken::PLAYER},
+      {"race", XmlToken::RACE},
+      {"scaling_text", XmlToken::SCALING_TEXT},
+      {"scaling_ui", XmlToken::SCALING_UI},
+      {"section", XmlToken::SECTION},
+      {"skill", XmlToken::SKILL},
+      {"skillset", XmlToken::SKILLSET},
+      {"sleuth", XmlToken::SLEUTH},
+      {"sound", XmlToken::SOUND},
+      {"sprite", XmlToken::SPRITE},
+      {"tick_rate", XmlToken::TICK_RATE},
+      {"tileevent", XmlToken::TILEEVENT},
+      {"underlay", XmlToken::UNDERLAY},
+      {"upper", XmlToken::UPPER},
+      {"vol", XmlToken::VOL},
+      {"vsync", XmlToken::VSYNC},
+      {"weather", XmlToken::WEATHER},
+      {"width", XmlToken::WIDTH}};
+
+  auto found = tokens.find(element);
+  if(found != tokens.end())
+    return found->second;
+  return XmlToken::UNKNOWN;
+}
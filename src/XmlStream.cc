@@ -0,0 +1,565 @@
+/*******************************************************************************
+ * Class Name: XmlStream
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Streaming reader of the game XML files. The source buffer is
+ *              scanned once from the start and every data leaf (the text
+ *              within an element) is handed to a visitor as a view: the text
+ *              and the stack of open elements, each with its first attribute,
+ *              as string views into the source. No document tree is built and
+ *              nothing is copied per leaf unless it holds an entity.
+ ******************************************************************************/
+#include "XmlStream.h"
+
+#include <iostream>
+
+/* Constant Implementation - see header file for descriptions */
+const std::string XmlStream::kWHITESPACE = " \t\n\r\v\f";
+
+/*
+ * Description: Returns the view without leading and trailing whitespace.
+ *
+ * Inputs: std::string_view view - the view to trim
+ *         const std::string& whitespace - the whitespace characters
+ * Output: std::string_view - the trimmed view
+ */
+static std::string_view trim(std::string_view view,
+                             const std::string& whitespace)
+{
+  size_t start = view.find_first_not_of(whitespace);
+  if(start == std::string_view::npos)
+    return std::string_view();
+  return view.substr(start, view.find_last_not_of(whitespace) - start + 1);
+}
+
+/*=============================================================================
+ * XMLLEAF - CONSTRUCTORS / DESTRUCTORS
+ *============================================================================*/
+
+/*
+ * Description: Constructor function - views the element stack and text.
+ *
+ * Inputs: const std::vector<XmlElementView>& elements - the open elements
+ *         std::string_view text - the text of the leaf
+ */
+XmlLeaf::XmlLeaf(const std::vector<XmlElementView>& elements,
+                 std::string_view text)
+    : elements(elements), text{text}
+{
+}
+
+/*=============================================================================
+ * XMLLEAF - PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Returns the element name at the depth of the stack.
+ *
+ * Inputs: uint32_t index - the depth, 0 being the root
+ * Output: std::string_view - the element name. Empty if out of range
+ */
+std::string_view XmlLeaf::getElement(uint32_t index) const
+{
+  if(index < elements.size())
+    return elements[index].element;
+  return std::string_view();
+}
+
+/*
+ * Description: Returns the interned element token at the depth of the stack.
+ *
+ * Inputs: uint32_t index - the depth, 0 being the root
+ * Output: XmlToken - the element token. UNKNOWN if out of range
+ */
+XmlToken XmlLeaf::getElementToken(uint32_t index) const
+{
+  if(index < elements.size())
+    return elements[index].token;
+  return XmlToken::UNKNOWN;
+}
+
+/*
+ * Description: Returns the first attribute key at the depth of the stack.
+ *
+ * Inputs: uint32_t index - the depth, 0 being the root
+ * Output: std::string_view - the attribute key. Empty if out of range
+ */
+std::string_view XmlLeaf::getKey(uint32_t index) const
+{
+  if(index < elements.size())
+    return elements[index].key;
+  return std::string_view();
+}
+
+/*
+ * Description: Returns the first attribute value at the depth of the stack.
+ *
+ * Inputs: uint32_t index - the depth, 0 being the root
+ * Output: std::string_view - the attribute value. Empty if out of range
+ */
+std::string_view XmlLeaf::getKeyValue(uint32_t index) const
+{
+  if(index < elements.size())
+    return elements[index].value;
+  return std::string_view();
+}
+
+/*
+ * Description: Returns the number of elements in the stack.
+ *
+ * Inputs: none
+ * Output: uint32_t - the element count
+ */
+uint32_t XmlLeaf::getNumElements() const
+{
+  return elements.size();
+}
+
+/*
+ * Description: Returns the text of the leaf.
+ *
+ * Inputs: none
+ * Output: std::string_view - the text
+ */
+std::string_view XmlLeaf::getText() const
+{
+  return text;
+}
+
+/*
+ * Description: Fills the XmlData with the leaf, as readXmlData() would have
+ *              returned it. The stacks of the XmlData are resized and the
+ *              strings assigned in place, so a data set reused across leaves
+ *              stops allocating once it has seen the deepest leaf.
+ *
+ * Inputs: XmlData& data - the data to fill
+ * Output: bool - true if the text converted to the type of the leaf
+ */
+bool XmlLeaf::toXmlData(XmlData& data) const
+{
+  data.element.resize(elements.size());
+  data.key.resize(elements.size());
+  data.value.resize(elements.size());
+  data.token.resize(elements.size());
+
+  for(uint32_t i = 0; i < elements.size(); i++)
+  {
+    data.element[i].assign(elements[i].element);
+    data.key[i].assign(elements[i].key);
+    data.value[i].assign(elements[i].value);
+    data.token[i] = elements[i].token;
+  }
+
+  /* Clear the data of the last leaf, in case the type is not known */
+  data.clearData();
+  return data.addData(std::string(text));
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Decodes the standard (&lt; &gt; &amp; &quot; &apos;) and the
+ *              numeric entities of the view. Views without an entity are
+ *              returned as is. Unknown entities are kept as written.
+ *
+ * Inputs: std::string_view view - the raw text or attribute value
+ *         std::string& scratch - storage for the decoded text
+ * Output: std::string_view - the decoded view
+ */
+std::string_view XmlStream::decode(std::string_view view,
+                                   std::string& scratch)
+{
+  size_t amp = view.find('&');
+  if(amp == std::string_view::npos)
+    return view;
+
+  scratch.assign(view.data(), amp);
+  while(amp < view.size())
+  {
+    size_t end = view.find(';', amp);
+    std::string_view name;
+    if(end != std::string_view::npos)
+      name = view.substr(amp + 1, end - amp - 1);
+
+    uint32_t code = 0;
+    if(name == "lt")
+      code = '<';
+    else if(name == "gt")
+      code = '>';
+    else if(name == "amp")
+      code = '&';
+    else if(name == "quot")
+      code = '"';
+    else if(name == "apos")
+      code = '\'';
+    else if(name.size() > 1 && name[0] == '#')
+    {
+      bool hex = (name[1] == 'x' || name[1] == 'X');
+      std::string digits(name.substr(hex ? 2 : 1));
+      const char* valid = hex ? "0123456789abcdefABCDEF" : "0123456789";
+      if(!digits.empty() && digits.size() <= 8 &&
+         digits.find_first_not_of(valid) == std::string::npos)
+        code = std::stoul(digits, nullptr, hex ? 16 : 10);
+    }
+
+    /* Numeric codes are written as UTF-8 */
+    if(code == 0 || code > 0x10FFFF)
+    {
+      scratch.push_back('&');
+      end = amp;
+    }
+    else if(code < 0x80)
+    {
+      scratch.push_back(code);
+    }
+    else if(code < 0x800)
+    {
+      scratch.push_back(0xC0 | (code >> 6));
+      scratch.push_back(0x80 | (code & 0x3F));
+    }
+    else if(code < 0x10000)
+    {
+      scratch.push_back(0xE0 | (code >> 12));
+      scratch.push_back(0x80 | ((code >> 6) & 0x3F));
+      scratch.push_back(0x80 | (code & 0x3F));
+    }
+    else
+    {
+      scratch.push_back(0xF0 | (code >> 18));
+      scratch.push_back(0x80 | ((code >> 12) & 0x3F));
+      scratch.push_back(0x80 | ((code >> 6) & 0x3F));
+      scratch.push_back(0x80 | (code & 0x3F));
+    }
+
+    /* Copy through to the next entity */
+    amp = view.find('&', end + 1);
+    if(amp == std::string_view::npos)
+      amp = view.size();
+    scratch.append(view.data() + end + 1, amp - end - 1);
+  }
+
+  return scratch;
+}
+
+/*=============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Parses the source from the start, calling the visitor for
+ *              each data leaf in document order. Declarations, comments and
+ *              the document type are skipped. Only the first attribute of an
+ *              element is kept, as per the XmlData stacks. Fails on a tag that
+ *              is malformed, unterminated or closes the wrong element.
+ *
+ * Inputs: std::string_view source - the full XML document
+ *         const std::function<bool(const XmlLeaf&)>& visitor - called per
+ *             leaf. Returns false to stop the parse early
+ * Output: bool - true if the source parsed up to the end or the stop
+ */
+bool XmlStream::parse(std::string_view source,
+                      const std::function<bool(const XmlLeaf&)>& visitor)
+{
+  const size_t npos = std::string_view::npos;
+  std::vector<XmlElementView> elements;
+  std::deque<std::string> value_scratch;
+  std::string text_scratch;
+  size_t pos = 0;
+
+  while(pos < source.size())
+  {
+    std::string_view text;
+    bool is_text = false;
+
+    /* Text up to the next tag - whitespace alone is not a leaf */
+    if(source[pos] != '<')
+    {
+      size_t end = source.find('<', pos);
+      if(end == npos)
+        end = source.size();
+      text = source.substr(pos, end - pos);
+      is_text = (text.find_first_not_of(kWHITESPACE) != npos);
+      if(is_text)
+        text = decode(text, text_scratch);
+      pos = end;
+    }
+    /* Declarations, comments and the document type are skipped */
+    else if(source.compare(pos, 2, "<?") == 0)
+    {
+      size_t end = source.find("?>", pos);
+      pos = (end == npos) ? npos : end + 2;
+    }
+    else if(source.compare(pos, 4, "<!--") == 0)
+    {
+      size_t end = source.find("-->", pos);
+      pos = (end == npos) ? npos : end + 3;
+    }
+    else if(source.compare(pos, 9, "<![CDATA[") == 0)
+    {
+      size_t end = source.find("]]>", pos);
+      if(end != npos)
+      {
+        text = source.substr(pos + 9, end - pos - 9);
+        is_text = true;
+        end += 3;
+      }
+      pos = end;
+    }
+    else if(source.compare(pos, 2, "<!") == 0)
+    {
+      size_t end = source.find('>', pos);
+      pos = (end == npos) ? npos : end + 1;
+    }
+    /* Closing tag */
+    else if(source.compare(pos, 2, "</") == 0)
+    {
+      size_t end = source.find('>', pos);
+      if(end == npos)
+      {
+        pos = npos;
+      }
+      else
+      {
+        std::string_view name = trim(source.substr(pos + 2, end - pos - 2),
+                                     kWHITESPACE);
+        if(elements.empty() || elements.back().element != name)
+        {
+          std::cerr << "[ERROR] XML stream closing tag \"" << name
+                    << "\" does not match the open element" << std::endl;
+          return false;
+        }
+        elements.pop_back();
+        pos = end + 1;
+      }
+    }
+    /* Opening tag - the first attribute is kept */
+    else
+    {
+      size_t end = pos + 1;
+      while(end < source.size() && source[end] != '/' && source[end] != '>' &&
+            kWHITESPACE.find(source[end]) == std::string::npos)
+        end++;
+
+      XmlElementView view = {source.substr(pos + 1, end - pos - 1), {}, {},
+                             XmlToken::UNKNOWN};
+      bool first_attribute = true;
+      bool self_closed = false;
+      pos = view.element.empty() ? npos : end;
+
+      while(pos != npos)
+      {
+        pos = source.find_first_not_of(kWHITESPACE, pos);
+        if(pos == npos)
+          break;
+
+        if(source[pos] == '>')
+        {
+          pos++;
+          break;
+        }
+        if(source.compare(pos, 2, "/>") == 0)
+        {
+          self_closed = true;
+          pos += 2;
+          break;
+        }
+
+        /* Attribute - key="value" or key='value' */
+        size_t equals = source.find('=', pos);
+        size_t quote = (equals == npos) ? npos :
+                       source.find_first_not_of(kWHITESPACE, equals + 1);
+        size_t close = npos;
+        if(quote != npos && (source[quote] == '"' || source[quote] == '\''))
+          close = source.find(source[quote], quote + 1);
+        if(close == npos)
+        {
+          pos = npos;
+          break;
+        }
+
+        if(first_attribute)
+        {
+          if(value_scratch.size() <= elements.size())
+            value_scratch.resize(elements.size() + 1);
+
+          view.key = trim(source.substr(pos, equals - pos), kWHITESPACE);
+          view.value = decode(source.substr(quote + 1, close - quote - 1),
+                              value_scratch[elements.size()]);
+          first_attribute = false;
+        }
+        pos = close + 1;
+      }
+
+      if(pos != npos && !self_closed)
+      {
+        view.token = XmlData::tokenize(view.element);
+        elements.push_back(view);
+      }
+    }
+
+    if(pos == npos)
+    {
+      std::cerr << "[ERROR] XML stream has an unterminated or malformed tag"
+                << std::endl;
+      return false;
+    }
+
+    /* Text outside of the elements is not a leaf */
+    if(is_text && !elements.empty())
+    {
+      XmlLeaf leaf(elements, text);
+      if(!visitor(leaf))
+        return true;
+    }
+  }
+
+  if(!elements.empty())
+  {
+    std::cerr << "[ERROR] XML stream element \"" << elements.back().element
+              << "\" is not closed" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * Description: Splits the direct children of the top level root element into
+ *              sections of raw text, in document order. Each section keeps
+ *              its element name, the value of its first attribute (decoded
+ *              as in the leaves) and the exact text that holds it, extended
+ *              to whole lines where it is alone on them. Only the tag
+ *              structure is scanned - no leaf is decoded - so the split costs
+ *              a single pass over the source.
+ *
+ * Inputs: std::string_view source - the full XML document
+ *         std::string_view root - the name of the top level root element
+ *         std::vector<XmlSectionView>& sections - the found sections
+ * Output: bool - true if the tags of the source are balanced
+ */
+bool XmlStream::sections(std::string_view source, std::string_view root,
+                         std::vector<XmlSectionView>& sections)
+{
+  const size_t npos = std::string_view::npos;
+  XmlSectionView section = {};
+  size_t section_start = 0;
+  uint32_t depth = 0;
+  bool in_root = false;
+  size_t pos = source.find('<');
+
+  sections.clear();
+  while(pos != npos)
+  {
+    size_t end = npos;
+
+    /* Declarations, comments, CDATA and the document type hold no tags */
+    if(source.compare(pos, 4, "<!--") == 0)
+    {
+      end = source.find("-->", pos);
+      end = (end == npos) ? npos : end + 3;
+    }
+    else if(source.compare(pos, 9, "<![CDATA[") == 0)
+    {
+      end = source.find("]]>", pos);
+      end = (end == npos) ? npos : end + 3;
+    }
+    else if(source.compare(pos, 2, "<?") == 0)
+    {
+      end = source.find("?>", pos);
+      end = (end == npos) ? npos : end + 2;
+    }
+    else if(source.compare(pos, 2, "<!") == 0)
+    {
+      end = source.find('>', pos);
+      end = (end == npos) ? npos : end + 1;
+    }
+    /* Element tag - the end is found past any quoted attribute value */
+    else
+    {
+      char quote = 0;
+      end = pos + 1;
+      while(end < source.size() && (quote != 0 || source[end] != '>'))
+      {
+        if(quote == 0 && (source[end] == '"' || source[end] == '\''))
+          quote = source[end];
+        else if(source[end] == quote)
+          quote = 0;
+        end++;
+      }
+
+      if(end < source.size())
+      {
+        std::string_view tag = source.substr(pos + 1, end - pos - 1);
+        bool closing = (!tag.empty() && tag.front() == '/');
+        bool self_closed = (!closing && !tag.empty() && tag.back() == '/');
+        end++;
+
+        if(closing)
+        {
+          if(depth == 0)
+            return false;
+          depth--;
+          if(depth == 0)
+            in_root = false;
+        }
+        else
+        {
+          std::string_view name = tag.substr(0, tag.find_first_of(
+                                                      " \t\n\r\v\f/"));
+
+          /* A child of the root opens a section */
+          if(in_root && depth == 1)
+          {
+            size_t line = source.find_last_not_of(" \t", pos - 1);
+            section_start = (line == npos || source[line] == '\n') ?
+                            ((line == npos) ? 0 : line + 1) : pos;
+
+            size_t equals = tag.find('=');
+            size_t quote_start = tag.find_first_of("\"'", equals);
+            size_t quote_end = (quote_start == npos) ? npos :
+                               tag.find(tag[quote_start], quote_start + 1);
+            section = {name, "", {}};
+            if(equals != npos && quote_end != npos)
+            {
+              std::string scratch;
+              section.value = decode(tag.substr(quote_start + 1,
+                                                quote_end - quote_start - 1),
+                                     scratch);
+            }
+          }
+          else if(depth == 0 && name == root && !self_closed)
+          {
+            in_root = true;
+          }
+
+          if(!self_closed)
+            depth++;
+        }
+
+        /* The section ends where its element closes */
+        if(in_root && depth == 1 && (closing || self_closed))
+        {
+          size_t line = source.find_first_not_of(" \t\r", end);
+          if(line == npos)
+            end = source.size();
+          else if(source[line] == '\n')
+            end = line + 1;
+          section.text = source.substr(section_start, end - section_start);
+          sections.push_back(section);
+        }
+      }
+      else
+      {
+        end = npos;
+      }
+    }
+
+    if(end == npos)
+      return false;
+    pos = source.find('<', end);
+  }
+
+  return (depth == 0);
+}
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Class Name: Xxtea
+ * Date Created: October 16, 2026
+ * Inheritance: none
+ * Description: Block oriented XXTEA engine for the file encryption. A line is
+ *              a contiguous span of 32 bit words that is encrypted in place
+ *              with a sliding window of four words (wrapping at the end of
+ *              the line), so no intermediate arrays are allocated. Lines of
+ *              the same length are independent, so they can also be
+ *              decrypted several at once in vector lanes.
+ ******************************************************************************/
+#include "Xxtea.h"
+
+#include <iostream>
+
+/* Vector of lanes - one word of each line decrypted together */
+#if defined(__AVX2__)
+typedef uint32_t XxteaLanes __attribute__((vector_size(32)));
+#else
+typedef uint32_t XxteaLanes __attribute__((vector_size(16)));
+#endif
+
+/* Constant Implementation - see header file for descriptions */
+const uint32_t Xxtea::kDELTA = 2654435769u;
+const uint32_t Xxtea::kKEY[] = {1073676287u, 27644437u, 2971215073u,
+                                94418953u};
+const uint32_t Xxtea::kLANES = sizeof(XxteaLanes) / sizeof(uint32_t);
+const uint32_t Xxtea::kROUNDS = 19;
+const uint32_t Xxtea::kWINDOW = 4;
+
+/*
+ * Description: The XXTEA mix of one word, for a single word or all lanes.
+ *
+ * Inputs: T y - the following word
+ *         T z - the preceding word
+ *         uint32_t sum - the round sum
+ *         uint32_t key - the key word of the position
+ * Output: T - the mix to add (encrypt) or subtract (decrypt)
+ */
+template <typename T>
+static inline T mix(T y, T z, uint32_t sum, uint32_t key)
+{
+  return ((z >> 5 ^ y << 2) + (y >> 3 ^ z << 4)) ^ ((sum ^ y) + (key ^ z));
+}
+
+/*=============================================================================
+ * PRIVATE FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Decrypts one window of kWINDOW words in place, as per the
+ *              XXTEA algorithm.
+ *
+ * Inputs: T* data - the window of words (or vector lanes)
+ * Output: none
+ */
+template <typename T> void Xxtea::decryptWindow(T* data)
+{
+  uint32_t sum = kROUNDS * kDELTA;
+  T y = data[0];
+  T z;
+
+  do
+  {
+    uint32_t e = (sum >> 2) & 3;
+
+    for(uint32_t p = kWINDOW - 1; p > 0; p--)
+    {
+      z = data[p - 1];
+      y = data[p] -= mix(y, z, sum, kKEY[(p & 3) ^ e]);
+    }
+
+    z = data[kWINDOW - 1];
+    y = data[0] -= mix(y, z, sum, kKEY[e]);
+  } while((sum -= kDELTA) != 0);
+}
+
+/*
+ * Description: Encrypts one window of kWINDOW words in place, as per the
+ *              XXTEA algorithm.
+ *
+ * Inputs: T* data - the window of words (or vector lanes)
+ * Output: none
+ */
+template <typename T> void Xxtea::encryptWindow(T* data)
+{
+  uint32_t rounds = kROUNDS;
+  uint32_t sum = 0;
+  T y;
+  T z = data[kWINDOW - 1];
+
+  do
+  {
+    sum += kDELTA;
+    uint32_t e = (sum >> 2) & 3;
+
+    for(uint32_t p = 0; p < kWINDOW - 1; p++)
+    {
+      y = data[p + 1];
+      z = data[p] += mix(y, z, sum, kKEY[(p & 3) ^ e]);
+    }
+
+    y = data[0];
+    z = data[kWINDOW - 1] += mix(y, z, sum, kKEY[((kWINDOW - 1) & 3) ^ e]);
+  } while(--rounds);
+}
+
+/*=============================================================================
+ * PUBLIC FUNCTIONS
+ *============================================================================*/
+
+/*
+ * Description: Decrypts a line of words in place. The windows are decrypted
+ *              from the last to the first, the reverse of encrypt(). Windows
+ *              that do not wrap are decrypted directly in the line.
+ *
+ * Inputs: uint32_t* data - the line of words
+ *         uint32_t length - the number of words (at least kWINDOW)
+ * Output: bool - true if the line was decrypted
+ */
+bool Xxtea::decrypt(uint32_t* data, uint32_t length)
+{
+  uint32_t window[kWINDOW];
+
+  if(data == nullptr || length < kWINDOW)
+  {
+    std::cerr << "[ERROR] File block decryption failed on invalid data"
+              << std::endl;
+    return false;
+  }
+
+  for(uint32_t i = length; i-- > 0;)
+  {
+    if(i + kWINDOW <= length)
+    {
+      decryptWindow(data + i);
+    }
+    else
+    {
+      for(uint32_t j = 0; j < kWINDOW; j++)
+        window[j] = data[(i + j) % length];
+      decryptWindow(window);
+      for(uint32_t j = 0; j < kWINDOW; j++)
+        data[(i + j) % length] = window[j];
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Description: Decrypts up to kLANES lines of the same length in place. Each
+ *              line is a lane of the vector, so every window is decrypted
+ *              for all the lines at once. Unused lanes repeat the first line
+ *              and are discarded.
+ *
+ * Inputs: uint32_t** lines - the lines of words
+ *         uint32_t count - the number of lines (1 to kLANES)
+ *         uint32_t length - the number of words in every line
+ * Output: bool - true if the lines were decrypted
+ */
+bool Xxtea::decryptLanes(uint32_t** lines, uint32_t count, uint32_t length)
+{
+  XxteaLanes window[kWINDOW];
+
+  if(lines == nullptr || count == 0 || count > kLANES || length < kWINDOW)
+  {
+    std::cerr << "[ERROR] File block decryption failed on invalid data"
+              << std::endl;
+    return false;
+  }
+
+  for(uint32_t i = length; i-- > 0;)
+  {
+    for(uint32_t j = 0; j < kWINDOW; j++)
+    {
+      uint32_t index = (i + j) % length;
+      for(uint32_t lane = 0; lane < kLANES; lane++)
+        window[j][lane] = lines[lane < count ? lane : 0][index];
+    }
+
+    decryptWindow(window);
+
+    for(uint32_t j = 0; j < kWINDOW; j++)
+    {
+      uint32_t index = (i + j) % length;
+      for(uint32_t lane = 0; lane < count; lane++)
+        lines[lane][index] = window[j][lane];
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Description: Encrypts a line of words in place. The windows are encrypted
+ *              from the first to the last, each overlapping the previous.
+ *
+ * Inputs: uint32_t* data - the line of words
+ *         uint32_t length - the number of words (at least kWINDOW)
+ * Output: bool - true if the line was encrypted
+ */
+bool Xxtea::encrypt(uint32_t* data, uint32_t length)
+{
+  uint32_t window[kWINDOW];
+
+  if(data == nullptr || length < kWINDOW)
+  {
+    std::cerr << "[ERROR] File block encryption failed on invalid data"
+              << std::endl;
+    return false;
+  }
+
+  for(uint32_t i = 0; i < length; i++)
+  {
+    if(i + kWINDOW <= length)
+    {
+      encryptWindow(data + i);
+    }
+    else
+    {
+      for(uint32_t j = 0; j < kWINDOW; j++)
+        window[j] = data[(i + j) % length];
+      encryptWindow(window);
+      for(uint32_t j = 0; j < kWINDOW; j++)
+        data[(i + j) % length] = window[j];
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Description: Returns the minimum number of words in an encrypted line.
+ *
+ * Inputs: none
+ * Output: uint32_t - the minimum number of words
+ */
+uint32_t Xxtea::getMinLength()
+{
+  return kWINDOW;
+}